@@ -3,7 +3,7 @@ using System.Text.RegularExpressions;
 
 static class Program
 {
-    private sealed record CsModule(string Module, string CsNamespace, ApiModel Model);
+    private sealed record CsModule(string Module, string CsNamespace, ApiModel Model, int FirstOpcode);
 
     private static int Main(string[] args)
     {
@@ -35,6 +35,9 @@ static class Program
         var usedHostIds = new Dictionary<uint, string>();
         var usedCoreIds = new Dictionary<uint, string>();
         var csModules = new List<CsModule>();
+        // 稠密 opcode：按输入文件顺序、模块内声明顺序为全部 Host 函数连续编号。
+        int nextOpcode = OpcodeBase;
+        string? outCppDirAll = null;
 
         foreach (string apiFile in apiFiles)
         {
@@ -51,16 +54,22 @@ static class Program
             foreach (var fn in model.CoreFns)
                 RegisterIdOrThrow(usedCoreIds, ComputeCoreFuncId(module, fn.Name), $"C:{module}.{fn.Name}");
 
+            int firstOpcode = nextOpcode;
+            nextOpcode += model.HostFns.Count;
+            if (nextOpcode - 1 > ushort.MaxValue)
+                throw new InvalidOperationException($"Host 函数过多：opcode 超出 16 位（模块 `{module}`）。");
+
             string outCppDir = ResolveOutCppDir(repoRoot, outCpp, module);
             Directory.CreateDirectory(outCppDir);
+            outCppDirAll = outCppDir;
 
             if (clean)
                 CleanupGeneratedCs(outCs, module);
 
             string cppFileName = $"{cppNs}_bindings.generated.h";
-            File.WriteAllText(Path.Combine(outCppDir, cppFileName), CppEmitter.Emit(model, module, cppNs), new UTF8Encoding(encoderShouldEmitUTF8Identifier: false));
+            File.WriteAllText(Path.Combine(outCppDir, cppFileName), CppEmitter.Emit(model, module, cppNs, firstOpcode), new UTF8Encoding(encoderShouldEmitUTF8Identifier: false));
 
-            foreach (var file in CsEmitter.EmitFiles(model, module, csNs))
+            foreach (var file in CsEmitter.EmitFiles(model, module, csNs, firstOpcode))
             {
                 File.WriteAllText(Path.Combine(outCs, file.FileName), file.Contents, new UTF8Encoding(encoderShouldEmitUTF8Identifier: false));
             }
@@ -69,7 +78,13 @@ static class Program
             Console.WriteLine($"  C++: {outCppDir}");
             Console.WriteLine($"  C#:  {outCs}");
 
-            csModules.Add(new CsModule(module, csNs, model));
+            csModules.Add(new CsModule(module, csNs, model, firstOpcode));
+        }
+
+        if (outCppDirAll != null)
+        {
+            File.WriteAllText(Path.Combine(outCppDirAll, "bridge_host_opcodes.generated.h"), CppEmitter.EmitOpcodeTable(csModules), new UTF8Encoding(encoderShouldEmitUTF8Identifier: false));
+            File.WriteAllText(Path.Combine(outCppDirAll, "bridge_host_dispatcher.generated.h"), CppEmitter.EmitHostDispatcher(csModules), new UTF8Encoding(encoderShouldEmitUTF8Identifier: false));
         }
 
         foreach (var file in CsEmitter.EmitAggregateFiles(csModules))
@@ -88,6 +103,9 @@ static class Program
         map[id] = name;
     }
 
+    // 与 bridge.h 的 BRIDGE_CMD_OPCODE_BASE 一致（更小的值留给内置命令类型）。
+    private const int OpcodeBase = 0x100;
+
     private static uint ComputeHostFuncId(string module, string fnName)
     {
         return Fnv1a32("H:" + module + "." + fnName);
@@ -227,6 +245,15 @@ static class Program
                     continue;
                 }
 
+                // 可合并（last-writer-wins）的 Host 调用：第一个参数为合并 key，同帧同 key 的调用原地覆盖。
+                if (TryParseMacro(line, "BRIDGE_HOST_API_COALESCE", out ApiFn coalesceFn))
+                {
+                    if (coalesceFn.Args.Count == 0 || (coalesceFn.Args[0].CppType != "uint64_t" && coalesceFn.Args[0].CppType != "uint32_t"))
+                        throw new InvalidOperationException($"BRIDGE_HOST_API_COALESCE 的第一个参数必须是 uint64_t/uint32_t 合并 key：{line}");
+                    hostFns.Add(coalesceFn with { Coalesce = true });
+                    continue;
+                }
+
                 if (TryParseMacro(line, "BRIDGE_CORE_API", out ApiFn coreFn))
                 {
                     coreFns.Add(coreFn);
@@ -296,12 +323,12 @@ static class Program
         }
     }
 
-    private sealed record ApiFn(string Name, List<ApiArg> Args);
+    private sealed record ApiFn(string Name, List<ApiArg> Args, bool Coalesce = false);
     private sealed record ApiArg(string CppType, string Name);
 
     private static class CppEmitter
     {
-        public static string Emit(ApiModel model, string module, string cppNamespace)
+        public static string Emit(ApiModel model, string module, string cppNamespace, int firstOpcode)
         {
             var sb = new StringBuilder();
             sb.AppendLine("#pragma once");
@@ -312,6 +339,7 @@ static class Program
             sb.AppendLine("#include <cstdint>");
             sb.AppendLine("#include <string>");
             sb.AppendLine("#include <string_view>");
+            sb.AppendLine("#include <type_traits>");
             sb.AppendLine();
             sb.AppendLine($"namespace {cppNamespace}");
             sb.AppendLine("{");
@@ -334,6 +362,14 @@ static class Program
             sb.AppendLine("\t};");
             sb.AppendLine();
 
+            // 稠密 opcode（BRIDGE_CORE_FLAG_DENSE_OPCODES 时写入 header.type；全部模块统一编号）。
+            sb.AppendLine("\tenum class HostOpcode : uint16_t");
+            sb.AppendLine("\t{");
+            for (int i = 0; i < model.HostFns.Count; i++)
+                sb.AppendLine($"\t\t{model.HostFns[i].Name} = 0x{firstOpcode + i:X4}u,");
+            sb.AppendLine("\t};");
+            sb.AppendLine();
+
             foreach (var fn in model.HostFns)
             {
                 sb.AppendLine($"\tstruct HostArgs_{fn.Name}");
@@ -367,27 +403,357 @@ static class Program
                 }
                 sb.AppendLine(")");
                 sb.AppendLine("\t{");
-                sb.AppendLine($"\t\tHostArgs_{fn.Name} a{{}};");
+                // 字符串先落地（InternUtf8 可能向 stream 追加宣告命令），再就地构造命令，避免 payload 指针失效。
                 foreach (var arg in fn.Args)
                 {
                     if (arg.CppType == "BridgeStringView")
-                    {
-                        sb.AppendLine($"\t\ta.{ToSnake(arg.Name)} = ctx.StoreUtf8(std::string({arg.Name}));");
-                    }
+                        sb.AppendLine($"\t\tconst BridgeStringView {arg.Name}View = ctx.StoreUtf8({arg.Name});");
+                    else if (arg.CppType == "BridgeStringId")
+                        sb.AppendLine($"\t\tconst BridgeStringId {arg.Name}Id = ctx.InternUtf8({arg.Name});");
+                }
+                string id = $"static_cast<uint32_t>(HostFuncId::{fn.Name})";
+                string op = $"static_cast<uint16_t>(HostOpcode::{fn.Name})";
+                if (fn.Coalesce)
+                    sb.AppendLine($"\t\tauto* a = ctx.EmplaceCoalesced<HostArgs_{fn.Name}>({id}, {fn.Args[0].Name}, {op});");
+                else
+                    sb.AppendLine($"\t\tauto* a = ctx.Emplace<HostArgs_{fn.Name}>({id}, {op});");
+                foreach (var arg in fn.Args)
+                {
+                    if (arg.CppType == "BridgeStringView")
+                        sb.AppendLine($"\t\ta->{ToSnake(arg.Name)} = {arg.Name}View;");
+                    else if (arg.CppType == "BridgeStringId")
+                        sb.AppendLine($"\t\ta->{ToSnake(arg.Name)} = {arg.Name}Id;");
                     else
-                    {
-                        sb.AppendLine($"\t\ta.{ToSnake(arg.Name)} = {arg.Name};");
-                    }
+                        sb.AppendLine($"\t\ta->{ToSnake(arg.Name)} = {arg.Name};");
                 }
-                sb.AppendLine($"\t\tctx.CallHost(static_cast<uint32_t>(HostFuncId::{fn.Name}), &a, static_cast<uint32_t>(sizeof(a)));");
                 sb.AppendLine("\t}");
                 sb.AppendLine();
             }
 
+            if (model.CoreFns.Count > 0)
+                AppendCoreDispatcher(sb, model);
+
             sb.AppendLine($"}} // namespace {cppNamespace}");
             return sb.ToString();
         }
 
+        // 全部模块的 opcode <-> func_id 表（业务层经 bridge::SetGameHostOpcodes 登记给 Bridge_GetHostOpcodes）。
+        public static string EmitOpcodeTable(IReadOnlyList<CsModule> modules)
+        {
+            var sb = new StringBuilder();
+            sb.AppendLine("#pragma once");
+            sb.AppendLine();
+            sb.AppendLine("#include <bridge/bridge.h>");
+            sb.AppendLine();
+            sb.AppendLine("#include <span>");
+            sb.AppendLine();
+            sb.AppendLine("namespace bridge");
+            sb.AppendLine("{");
+            sb.AppendLine("\t// BridgeGen 分配的 Host opcode 表（按 opcode 递增，与生成的 C# 分发器一致）。");
+            if (modules.Any(m => m.Model.HostFns.Count > 0))
+            {
+                sb.AppendLine("\tinline constexpr BridgeHostOpcode kGeneratedHostOpcodeEntries[] = {");
+                foreach (var m in modules)
+                {
+                    for (int i = 0; i < m.Model.HostFns.Count; i++)
+                    {
+                        var fn = m.Model.HostFns[i];
+                        sb.AppendLine($"\t\t{{0x{m.FirstOpcode + i:X4}u, 0u, 0x{ComputeHostFuncId(m.Module, fn.Name):X8}u}}, // {m.Module}.{fn.Name}");
+                    }
+                }
+                sb.AppendLine("\t};");
+                sb.AppendLine();
+                sb.AppendLine("\tinline constexpr std::span<const BridgeHostOpcode> kGeneratedHostOpcodes{kGeneratedHostOpcodeEntries};");
+            }
+            else
+            {
+                sb.AppendLine("\tinline constexpr std::span<const BridgeHostOpcode> kGeneratedHostOpcodes{};");
+            }
+            sb.AppendLine("}");
+            return sb.ToString();
+        }
+
+        // C++ Host 侧分发器（header-only，对应 C# 的 BridgeAllCommandDispatcher.DispatchFast）：
+        // 按 func_id / opcode switch 到 host 的同名成员函数，模板内联、无虚调用；host 未实现的函数在编译期跳过。
+        public static string EmitHostDispatcher(IReadOnlyList<CsModule> modules)
+        {
+            var fns = new List<(string Ns, ApiFn Fn)>();
+            foreach (var m in modules)
+            {
+                foreach (var fn in m.Model.HostFns)
+                    fns.Add((CppNamespaceFromModule(m.Module), fn));
+            }
+
+            var sb = new StringBuilder();
+            sb.AppendLine("#pragma once");
+            sb.AppendLine();
+            sb.AppendLine("#include <bridge/bridge.h>");
+            sb.AppendLine();
+            foreach (var m in modules)
+                sb.AppendLine($"#include <{CppNamespaceFromModule(m.Module)}_bindings.generated.h>");
+            sb.AppendLine();
+            sb.AppendLine("#include <cstddef>");
+            sb.AppendLine("#include <cstdint>");
+            sb.AppendLine("#include <cstring>");
+            sb.AppendLine();
+            sb.AppendLine("namespace bridge");
+            sb.AppendLine("{");
+            sb.AppendLine("\t// 一条批量命令中同一函数的连续调用（按顺序排列，相邻 payload 间隔 stride 字节）。");
+            sb.AppendLine("\ttemplate <class TArgs>");
+            sb.AppendLine("\tclass HostCallBatch");
+            sb.AppendLine("\t{");
+            sb.AppendLine("\tpublic:");
+            sb.AppendLine("\t\tHostCallBatch(const uint8_t* data, uint32_t count, uint32_t stride)");
+            sb.AppendLine("\t\t\t: data_(data), count_(count), stride_(stride)");
+            sb.AppendLine("\t\t{");
+            sb.AppendLine("\t\t}");
+            sb.AppendLine();
+            sb.AppendLine("\t\tuint32_t Count() const { return count_; }");
+            sb.AppendLine();
+            sb.AppendLine("\t\tconst TArgs& operator[](uint32_t i) const");
+            sb.AppendLine("\t\t{");
+            sb.AppendLine("\t\t\treturn *reinterpret_cast<const TArgs*>(data_ + static_cast<size_t>(i) * stride_);");
+            sb.AppendLine("\t\t}");
+            sb.AppendLine();
+            sb.AppendLine("\tprivate:");
+            sb.AppendLine("\t\tconst uint8_t* data_;");
+            sb.AppendLine("\t\tuint32_t count_;");
+            sb.AppendLine("\t\tuint32_t stride_;");
+            sb.AppendLine("\t};");
+            sb.AppendLine();
+            sb.AppendLine("\tnamespace host_dispatch_detail");
+            sb.AppendLine("\t{");
+            foreach (var (ns, fn) in fns)
+            {
+                string argsType = $"{ns}::HostArgs_{fn.Name}";
+                sb.AppendLine("\t\ttemplate <class THost>");
+                sb.AppendLine($"\t\tinline void Call{fn.Name}(THost& host, const uint8_t* payload)");
+                sb.AppendLine("\t\t{");
+                sb.AppendLine($"\t\t\tif constexpr (requires(THost& h, const {argsType}& a) {{ h.{fn.Name}(a); }})");
+                sb.AppendLine("\t\t\t{");
+                sb.AppendLine($"\t\t\t\thost.{fn.Name}(*reinterpret_cast<const {argsType}*>(payload));");
+                sb.AppendLine("\t\t\t}");
+                sb.AppendLine("\t\t}");
+                sb.AppendLine();
+                sb.AppendLine("\t\ttemplate <class THost>");
+                sb.AppendLine($"\t\tinline void Call{fn.Name}Batch(THost& host, const uint8_t* payload, uint32_t count, uint32_t stride)");
+                sb.AppendLine("\t\t{");
+                sb.AppendLine($"\t\t\tif constexpr (requires(THost& h, HostCallBatch<{argsType}> b) {{ h.{fn.Name}Batch(b); }})");
+                sb.AppendLine("\t\t\t{");
+                sb.AppendLine($"\t\t\t\thost.{fn.Name}Batch(HostCallBatch<{argsType}>(payload, count, stride));");
+                sb.AppendLine("\t\t\t}");
+                sb.AppendLine("\t\t\telse");
+                sb.AppendLine("\t\t\t{");
+                sb.AppendLine("\t\t\t\tfor (uint32_t i = 0; i < count; ++i)");
+                sb.AppendLine("\t\t\t\t{");
+                sb.AppendLine($"\t\t\t\t\tCall{fn.Name}(host, payload + static_cast<size_t>(i) * stride);");
+                sb.AppendLine("\t\t\t\t}");
+                sb.AppendLine("\t\t\t}");
+                sb.AppendLine("\t\t}");
+                sb.AppendLine();
+            }
+            sb.AppendLine("\t\t// kChecked = false 时只校验命令边界（header.size），信任 payload 大小与批量条目数。");
+            sb.AppendLine("\t\ttemplate <bool kChecked, class THost>");
+            sb.AppendLine("\t\tinline uint64_t Dispatch(const void* ptr, uint32_t len, THost& host)");
+            sb.AppendLine("\t\t{");
+            sb.AppendLine("\t\t\tconst uint8_t* cursor = static_cast<const uint8_t*>(ptr);");
+            sb.AppendLine("\t\t\tconst uint8_t* const end = cursor ? cursor + len : cursor;");
+            sb.AppendLine("\t\t\tuint64_t calls = 0;");
+            sb.AppendLine();
+            sb.AppendLine("\t\t\twhile (static_cast<size_t>(end - cursor) >= sizeof(BridgeCommandHeader))");
+            sb.AppendLine("\t\t\t{");
+            sb.AppendLine("\t\t\t\tBridgeCommandHeader header{};");
+            sb.AppendLine("\t\t\t\tstd::memcpy(&header, cursor, sizeof(header));");
+            sb.AppendLine("\t\t\t\tif (header.size < sizeof(BridgeCommandHeader) || header.size > static_cast<size_t>(end - cursor))");
+            sb.AppendLine("\t\t\t\t{");
+            sb.AppendLine("\t\t\t\t\tbreak;");
+            sb.AppendLine("\t\t\t\t}");
+            sb.AppendLine();
+            sb.AppendLine("\t\t\t\tconst uint8_t* const cmd = cursor;");
+            sb.AppendLine("\t\t\t\tcursor += header.size;");
+            sb.AppendLine();
+            sb.AppendLine("\t\t\t\tif (header.type >= BRIDGE_CMD_OPCODE_BASE)");
+            sb.AppendLine("\t\t\t\t{");
+            sb.AppendLine("\t\t\t\t\tif (kChecked && header.size < sizeof(BridgeCmdCallOp))");
+            sb.AppendLine("\t\t\t\t\t{");
+            sb.AppendLine("\t\t\t\t\t\tcontinue;");
+            sb.AppendLine("\t\t\t\t\t}");
+            sb.AppendLine("\t\t\t\t\tBridgeCmdCallOp op{};");
+            sb.AppendLine("\t\t\t\t\tstd::memcpy(&op, cmd, sizeof(op));");
+            sb.AppendLine("\t\t\t\t\tconst uint8_t* payload = cmd + sizeof(BridgeCmdCallOp);");
+            sb.AppendLine("\t\t\t\t\tconst uint64_t payloadBytes = header.size - sizeof(BridgeCmdCallOp);");
+            sb.AppendLine();
+            sb.AppendLine("\t\t\t\t\tswitch (header.type)");
+            sb.AppendLine("\t\t\t\t\t{");
+            foreach (var (ns, fn) in fns)
+            {
+                string argsType = $"{ns}::HostArgs_{fn.Name}";
+                sb.AppendLine($"\t\t\t\t\tcase static_cast<uint16_t>({ns}::HostOpcode::{fn.Name}):");
+                sb.AppendLine("\t\t\t\t\t{");
+                sb.AppendLine($"\t\t\t\t\t\tconstexpr uint32_t stride = (sizeof({argsType}) + 7u) & ~7u;");
+                sb.AppendLine("\t\t\t\t\t\tif (kChecked && static_cast<uint64_t>(op.count) * stride > payloadBytes)");
+                sb.AppendLine("\t\t\t\t\t\t{");
+                sb.AppendLine("\t\t\t\t\t\t\tbreak;");
+                sb.AppendLine("\t\t\t\t\t\t}");
+                sb.AppendLine("\t\t\t\t\t\tcalls += op.count;");
+                sb.AppendLine("\t\t\t\t\t\tif (op.count == 1)");
+                sb.AppendLine("\t\t\t\t\t\t{");
+                sb.AppendLine($"\t\t\t\t\t\t\tCall{fn.Name}(host, payload);");
+                sb.AppendLine("\t\t\t\t\t\t}");
+                sb.AppendLine("\t\t\t\t\t\telse");
+                sb.AppendLine("\t\t\t\t\t\t{");
+                sb.AppendLine($"\t\t\t\t\t\t\tCall{fn.Name}Batch(host, payload, op.count, stride);");
+                sb.AppendLine("\t\t\t\t\t\t}");
+                sb.AppendLine("\t\t\t\t\t\tbreak;");
+                sb.AppendLine("\t\t\t\t\t}");
+            }
+            sb.AppendLine("\t\t\t\t\tdefault:");
+            sb.AppendLine("\t\t\t\t\t\tcalls += op.count;");
+            sb.AppendLine("\t\t\t\t\t\tbreak;");
+            sb.AppendLine("\t\t\t\t\t}");
+            sb.AppendLine("\t\t\t\t\tcontinue;");
+            sb.AppendLine("\t\t\t\t}");
+            sb.AppendLine();
+            sb.AppendLine("\t\t\t\tswitch (header.type)");
+            sb.AppendLine("\t\t\t\t{");
+            sb.AppendLine("\t\t\t\tcase BRIDGE_CMD_CALL_HOST:");
+            sb.AppendLine("\t\t\t\t{");
+            sb.AppendLine("\t\t\t\t\t++calls;");
+            sb.AppendLine("\t\t\t\t\tif (kChecked && header.size < sizeof(BridgeCmdCallHost))");
+            sb.AppendLine("\t\t\t\t\t{");
+            sb.AppendLine("\t\t\t\t\t\tbreak;");
+            sb.AppendLine("\t\t\t\t\t}");
+            sb.AppendLine("\t\t\t\t\tBridgeCmdCallHost call{};");
+            sb.AppendLine("\t\t\t\t\tstd::memcpy(&call, cmd, sizeof(call));");
+            sb.AppendLine("\t\t\t\t\tconst uint8_t* payload = cmd + sizeof(BridgeCmdCallHost);");
+            sb.AppendLine("\t\t\t\t\tconst uint32_t payloadBytes = header.size - static_cast<uint32_t>(sizeof(BridgeCmdCallHost));");
+            sb.AppendLine();
+            sb.AppendLine("\t\t\t\t\tswitch (call.func_id)");
+            sb.AppendLine("\t\t\t\t\t{");
+            foreach (var (ns, fn) in fns)
+            {
+                sb.AppendLine($"\t\t\t\t\tcase static_cast<uint32_t>({ns}::HostFuncId::{fn.Name}):");
+                sb.AppendLine($"\t\t\t\t\t\tif (!kChecked || payloadBytes >= sizeof({ns}::HostArgs_{fn.Name}))");
+                sb.AppendLine("\t\t\t\t\t\t{");
+                sb.AppendLine($"\t\t\t\t\t\t\tCall{fn.Name}(host, payload);");
+                sb.AppendLine("\t\t\t\t\t\t}");
+                sb.AppendLine("\t\t\t\t\t\tbreak;");
+            }
+            sb.AppendLine("\t\t\t\t\tdefault:");
+            sb.AppendLine("\t\t\t\t\t\tbreak;");
+            sb.AppendLine("\t\t\t\t\t}");
+            sb.AppendLine("\t\t\t\t\tbreak;");
+            sb.AppendLine("\t\t\t\t}");
+            sb.AppendLine("\t\t\t\tcase BRIDGE_CMD_CALL_HOST_BATCH:");
+            sb.AppendLine("\t\t\t\t{");
+            sb.AppendLine("\t\t\t\t\tif (kChecked && header.size < sizeof(BridgeCmdCallHostBatch))");
+            sb.AppendLine("\t\t\t\t\t{");
+            sb.AppendLine("\t\t\t\t\t\tbreak;");
+            sb.AppendLine("\t\t\t\t\t}");
+            sb.AppendLine("\t\t\t\t\tBridgeCmdCallHostBatch batch{};");
+            sb.AppendLine("\t\t\t\t\tstd::memcpy(&batch, cmd, sizeof(batch));");
+            sb.AppendLine("\t\t\t\t\tif (kChecked && static_cast<uint64_t>(batch.count) * batch.stride > header.size - sizeof(BridgeCmdCallHostBatch))");
+            sb.AppendLine("\t\t\t\t\t{");
+            sb.AppendLine("\t\t\t\t\t\tbreak;");
+            sb.AppendLine("\t\t\t\t\t}");
+            sb.AppendLine("\t\t\t\t\tcalls += batch.count;");
+            sb.AppendLine("\t\t\t\t\tconst uint8_t* payload = cmd + sizeof(BridgeCmdCallHostBatch);");
+            sb.AppendLine();
+            sb.AppendLine("\t\t\t\t\tswitch (batch.func_id)");
+            sb.AppendLine("\t\t\t\t\t{");
+            foreach (var (ns, fn) in fns)
+            {
+                sb.AppendLine($"\t\t\t\t\tcase static_cast<uint32_t>({ns}::HostFuncId::{fn.Name}):");
+                sb.AppendLine($"\t\t\t\t\t\tif (!kChecked || batch.stride >= sizeof({ns}::HostArgs_{fn.Name}))");
+                sb.AppendLine("\t\t\t\t\t\t{");
+                sb.AppendLine($"\t\t\t\t\t\t\tCall{fn.Name}Batch(host, payload, batch.count, batch.stride);");
+                sb.AppendLine("\t\t\t\t\t\t}");
+                sb.AppendLine("\t\t\t\t\t\tbreak;");
+            }
+            sb.AppendLine("\t\t\t\t\tdefault:");
+            sb.AppendLine("\t\t\t\t\t\tbreak;");
+            sb.AppendLine("\t\t\t\t\t}");
+            sb.AppendLine("\t\t\t\t\tbreak;");
+            sb.AppendLine("\t\t\t\t}");
+            sb.AppendLine("\t\t\t\tcase BRIDGE_CMD_DEFINE_STRING:");
+            sb.AppendLine("\t\t\t\t\t++calls;");
+            sb.AppendLine("\t\t\t\t\tif constexpr (requires(THost& h, const BridgeCmdDefineString& c) { h.DefineString(c); })");
+            sb.AppendLine("\t\t\t\t\t{");
+            sb.AppendLine("\t\t\t\t\t\tif (!kChecked || header.size >= sizeof(BridgeCmdDefineString))");
+            sb.AppendLine("\t\t\t\t\t\t{");
+            sb.AppendLine("\t\t\t\t\t\t\thost.DefineString(*reinterpret_cast<const BridgeCmdDefineString*>(cmd));");
+            sb.AppendLine("\t\t\t\t\t\t}");
+            sb.AppendLine("\t\t\t\t\t}");
+            sb.AppendLine("\t\t\t\t\tbreak;");
+            sb.AppendLine("\t\t\t\tdefault:");
+            sb.AppendLine("\t\t\t\t\t++calls;");
+            sb.AppendLine("\t\t\t\t\tbreak;");
+            sb.AppendLine("\t\t\t\t}");
+            sb.AppendLine("\t\t\t}");
+            sb.AppendLine("\t\t\treturn calls;");
+            sb.AppendLine("\t\t}");
+            sb.AppendLine("\t}");
+            sb.AppendLine();
+            sb.AppendLine("\t// 单次扫描 command stream，按 func_id / opcode 分发到 host 的同名成员函数（模板内联，无虚调用）：");
+            foreach (var (ns, fn) in fns)
+                sb.AppendLine($"\t//   void {fn.Name}(const {ns}::HostArgs_{fn.Name}& args);");
+            sb.AppendLine("\t// 可选：XxxBatch(bridge::HostCallBatch<HostArgs_Xxx>) 整批处理（缺省逐条调用 Xxx）、");
+            sb.AppendLine("\t// DefineString(const BridgeCmdDefineString&) 接收驻留字符串宣告。host 未实现的函数直接跳过。");
+            sb.AppendLine("\t// 返回解析的调用数（批量命令按条目计，其它命令各计 1）。");
+            sb.AppendLine("\ttemplate <class THost>");
+            sb.AppendLine("\tinline uint64_t DispatchFast(const void* ptr, uint32_t len, THost& host)");
+            sb.AppendLine("\t{");
+            sb.AppendLine("\t\treturn host_dispatch_detail::Dispatch<true>(ptr, len, host);");
+            sb.AppendLine("\t}");
+            sb.AppendLine();
+            sb.AppendLine("\t// 同 DispatchFast，但信任 stream 内容（来自同一次生成的 Core）：只校验命令边界，不校验 payload 大小。");
+            sb.AppendLine("\ttemplate <class THost>");
+            sb.AppendLine("\tinline uint64_t DispatchFastUnchecked(const void* ptr, uint32_t len, THost& host)");
+            sb.AppendLine("\t{");
+            sb.AppendLine("\t\treturn host_dispatch_detail::Dispatch<false>(ptr, len, host);");
+            sb.AppendLine("\t}");
+            sb.AppendLine("}");
+            return sb.ToString();
+        }
+
+        // Host -> Core 分发：按 CoreFuncId switch 到 TApp 的类型化处理函数（模板静态绑定，无虚调用）。
+        private static void AppendCoreDispatcher(StringBuilder sb, ApiModel model)
+        {
+            foreach (var fn in model.CoreFns)
+            {
+                sb.AppendLine($"\tstatic_assert(std::is_trivially_copyable<CoreArgs_{fn.Name}>::value && std::is_standard_layout<CoreArgs_{fn.Name}>::value, \"CoreArgs_{fn.Name} must be a POD payload\");");
+                sb.AppendLine($"\tstatic_assert(alignof(CoreArgs_{fn.Name}) <= 8, \"CoreArgs_{fn.Name} alignment must not exceed 8\");");
+            }
+            sb.AppendLine();
+            sb.AppendLine("\t// Host -> Core 调用分发（配合 bridge::CoreAppBase 使用）。TApp 需为本模块每个 Core 函数实现：");
+            foreach (var fn in model.CoreFns)
+                sb.AppendLine($"\t//   void On{fn.Name}(bridge::CoreContext& ctx, const CoreArgs_{fn.Name}& args);");
+            sb.AppendLine("\t// 返回 false 表示 funcId 不属于本模块，或 payload 大小与声明不符（该调用被丢弃）。");
+            sb.AppendLine("\ttemplate <class TApp>");
+            sb.AppendLine("\tinline bool DispatchCoreCall(TApp& app, bridge::CoreContext& ctx, uint32_t funcId, const void* payload, uint32_t payloadSize)");
+            sb.AppendLine("\t{");
+            foreach (var fn in model.CoreFns)
+                sb.AppendLine($"\t\tstatic_assert(requires(TApp& a, bridge::CoreContext& c, const CoreArgs_{fn.Name}& x) {{ a.On{fn.Name}(c, x); }}, \"TApp must implement On{fn.Name}(bridge::CoreContext&, const CoreArgs_{fn.Name}&)\");");
+            sb.AppendLine();
+            sb.AppendLine("\t\tswitch (static_cast<CoreFuncId>(funcId))");
+            sb.AppendLine("\t\t{");
+            foreach (var fn in model.CoreFns)
+            {
+                sb.AppendLine($"\t\tcase CoreFuncId::{fn.Name}:");
+                sb.AppendLine($"\t\t\tif (payloadSize != sizeof(CoreArgs_{fn.Name}))");
+                sb.AppendLine("\t\t\t{");
+                sb.AppendLine("\t\t\t\treturn false;");
+                sb.AppendLine("\t\t\t}");
+                sb.AppendLine($"\t\t\tapp.On{fn.Name}(ctx, *static_cast<const CoreArgs_{fn.Name}*>(payload));");
+                sb.AppendLine("\t\t\treturn true;");
+            }
+            sb.AppendLine("\t\tdefault:");
+            sb.AppendLine("\t\t\treturn false;");
+            sb.AppendLine("\t\t}");
+            sb.AppendLine("\t}");
+            sb.AppendLine();
+        }
+
         private static string ToSnake(string name)
         {
             if (string.IsNullOrEmpty(name))
@@ -397,7 +763,7 @@ static class Program
 
         private static string MapCppCallArgType(string cppType)
         {
-            return cppType == "BridgeStringView" ? "std::string_view" : cppType;
+            return cppType is "BridgeStringView" or "BridgeStringId" ? "std::string_view" : cppType;
         }
     }
 
@@ -405,10 +771,10 @@ static class Program
     {
         public sealed record CsFile(string FileName, string Contents);
 
-        public static List<CsFile> EmitFiles(ApiModel model, string module, string csNamespace)
+        public static List<CsFile> EmitFiles(ApiModel model, string module, string csNamespace, int firstOpcode)
         {
             var files = new List<CsFile>();
-            files.Add(new CsFile($"{module}.Ids.g.cs", EmitIds(model, module, csNamespace)));
+            files.Add(new CsFile($"{module}.Ids.g.cs", EmitIds(model, module, csNamespace, firstOpcode)));
             files.Add(new CsFile($"{module}.Structs.g.cs", EmitStructs(model, csNamespace)));
             files.Add(new CsFile($"I{module}HostApi.g.cs", EmitHostApi(model, module, csNamespace)));
             files.Add(new CsFile($"{module}.CoreCalls.g.cs", EmitCoreCalls(model, module, csNamespace)));
@@ -433,7 +799,7 @@ static class Program
             );
         }
 
-        private static string EmitIds(ApiModel model, string module, string csNamespace)
+        private static string EmitIds(ApiModel model, string module, string csNamespace, int firstOpcode)
         {
             var sb = new StringBuilder();
             sb.AppendLine(AutoHeader());
@@ -456,6 +822,12 @@ static class Program
                 sb.AppendLine($"        {model.CoreFns[i].Name} = 0x{id:X8}u,");
             }
             sb.AppendLine("    }");
+            sb.AppendLine();
+            sb.AppendLine("    public enum HostOpcode : ushort");
+            sb.AppendLine("    {");
+            for (int i = 0; i < model.HostFns.Count; i++)
+                sb.AppendLine($"        {model.HostFns[i].Name} = 0x{firstOpcode + i:X4},");
+            sb.AppendLine("    }");
             sb.AppendLine("}");
             return sb.ToString();
         }
@@ -508,13 +880,50 @@ static class Program
                     sb.AppendLine(");");
                 }
             }
+
+            // 批量处理函数：默认逐条转发，Host 可覆写为整批循环（例如按实体表一次性写入）。
+            foreach (var m in modules)
+            {
+                if (m.Model.HostFns.Count == 0)
+                    continue;
+
+                foreach (var fn in m.Model.HostFns)
+                {
+                    string argsType = $"{m.CsNamespace}.HostArgs_{fn.Name}";
+                    sb.AppendLine();
+                    sb.AppendLine($"        public virtual void {fn.Name}Batch(HostCallBatch<{argsType}> calls)");
+                    sb.AppendLine("        {");
+                    sb.AppendLine("            for (int i = 0; i < calls.Count; i++)");
+                    sb.AppendLine("            {");
+                    sb.AppendLine($"                ref readonly {argsType} a = ref calls[i];");
+                    sb.Append("                ");
+                    AppendHostCall(sb, fn, "");
+                    sb.AppendLine("            }");
+                    sb.AppendLine("        }");
+                }
+            }
             sb.AppendLine("    }");
             sb.AppendLine();
             sb.AppendLine("    /// <summary>");
-            sb.AppendLine("    /// 单次扫描 command stream，并按 func_id 分发到各模块 Host API。");
+            sb.AppendLine("    /// 单次扫描 command stream，并按 func_id（或稠密 opcode）分发到各模块 Host API。");
             sb.AppendLine("    /// </summary>");
             sb.AppendLine("    public static class BridgeAllCommandDispatcher");
             sb.AppendLine("    {");
+            sb.AppendLine("        // 本次生成分配的 Host opcode：下标 = opcode - BridgeCmdCallOp.OpcodeBase，值为对应 func_id。");
+            sb.AppendLine("        private static readonly uint[] s_hostOpcodeFuncIds =");
+            sb.AppendLine("        {");
+            foreach (var m in modules)
+            {
+                foreach (var fn in m.Model.HostFns)
+                    sb.AppendLine($"            0x{ComputeHostFuncId(m.Module, fn.Name):X8}u, // {m.Module}.{fn.Name}");
+            }
+            sb.AppendLine("        };");
+            sb.AppendLine();
+            sb.AppendLine("        /// <summary>");
+            sb.AppendLine("        /// 与 native 库握手：opcode 表完全一致时返回 true，此时才可为 core 打开 <see cref=\"BridgeCoreFlags.DenseOpcodes\"/>。");
+            sb.AppendLine("        /// </summary>");
+            sb.AppendLine("        public static bool VerifyHostOpcodes() => BridgeCore.MatchHostOpcodes(s_hostOpcodeFuncIds);");
+            sb.AppendLine();
             sb.AppendLine("        public static unsafe void DispatchFast<THost>(CommandStream stream, THost host)");
             sb.AppendLine("            where THost : BridgeAllHostApiBase");
             sb.AppendLine("        {");
@@ -535,7 +944,11 @@ static class Program
             sb.AppendLine("                if ((uint)size < (uint)sizeof(BridgeCommandHeader) || (uint)size > (uint)remaining)");
             sb.AppendLine("                    break;");
             sb.AppendLine();
-            sb.AppendLine("                if (header->Type == (ushort)BridgeCommandType.CallHost && size >= sizeof(BridgeCmdCallHost))");
+            sb.AppendLine("                if (header->Type >= BridgeCmdCallOp.OpcodeBase && size >= sizeof(BridgeCmdCallOp))");
+            sb.AppendLine("                {");
+            sb.AppendLine("                    DispatchOp(host, (BridgeCmdCallOp*)cursor, size - sizeof(BridgeCmdCallOp));");
+            sb.AppendLine("                }");
+            sb.AppendLine("                else if (header->Type == (ushort)BridgeCommandType.CallHost && size >= sizeof(BridgeCmdCallHost))");
             sb.AppendLine("                {");
             sb.AppendLine("                    var cmd = (BridgeCmdCallHost*)cursor;");
             sb.AppendLine("                    uint payloadBytes = (uint)(size - sizeof(BridgeCmdCallHost));");
@@ -588,6 +1001,18 @@ static class Program
 
             sb.AppendLine("                    }");
             sb.AppendLine("                }");
+            sb.AppendLine("                else if (header->Type == (ushort)BridgeCommandType.DefineString && size >= sizeof(BridgeCmdDefineString))");
+            sb.AppendLine("                {");
+            sb.AppendLine("                    BridgeStringTable.Define(in *(BridgeCmdDefineString*)cursor);");
+            sb.AppendLine("                }");
+            sb.AppendLine("                else if (header->Type == (ushort)BridgeCommandType.CallHostBatch && size >= sizeof(BridgeCmdCallHostBatch))");
+            sb.AppendLine("                {");
+            sb.AppendLine("                    var batch = (BridgeCmdCallHostBatch*)cursor;");
+            sb.AppendLine("                    if ((ulong)batch->Count * batch->Stride > (ulong)(size - sizeof(BridgeCmdCallHostBatch)))");
+            sb.AppendLine("                        break;");
+            sb.AppendLine();
+            sb.AppendLine("                    DispatchBatch(host, batch);");
+            sb.AppendLine("                }");
             sb.AppendLine();
             sb.AppendLine("                cursor += size;");
             sb.AppendLine("            }");
@@ -614,6 +1039,27 @@ static class Program
             sb.AppendLine("                if ((uint)size < (uint)sizeof(BridgeCmdCallHost) || (uint)size > (uint)remaining)");
             sb.AppendLine("                    break;");
             sb.AppendLine();
+            sb.AppendLine("                if (cmd->Header.Type >= BridgeCmdCallOp.OpcodeBase)");
+            sb.AppendLine("                {");
+            sb.AppendLine("                    DispatchOp(host, (BridgeCmdCallOp*)cursor, size - sizeof(BridgeCmdCallOp));");
+            sb.AppendLine("                    cursor += size;");
+            sb.AppendLine("                    continue;");
+            sb.AppendLine("                }");
+            sb.AppendLine();
+            sb.AppendLine("                if (cmd->Header.Type == (ushort)BridgeCommandType.DefineString)");
+            sb.AppendLine("                {");
+            sb.AppendLine("                    BridgeStringTable.Define(in *(BridgeCmdDefineString*)cursor);");
+            sb.AppendLine("                    cursor += size;");
+            sb.AppendLine("                    continue;");
+            sb.AppendLine("                }");
+            sb.AppendLine();
+            sb.AppendLine("                if (cmd->Header.Type == (ushort)BridgeCommandType.CallHostBatch)");
+            sb.AppendLine("                {");
+            sb.AppendLine("                    DispatchBatch(host, (BridgeCmdCallHostBatch*)cursor);");
+            sb.AppendLine("                    cursor += size;");
+            sb.AppendLine("                    continue;");
+            sb.AppendLine("                }");
+            sb.AppendLine();
             sb.AppendLine("                byte* payloadPtr = cursor + sizeof(BridgeCmdCallHost);");
             sb.AppendLine();
             sb.AppendLine("                switch (cmd->FuncId)");
@@ -667,6 +1113,66 @@ static class Program
             sb.AppendLine("        public static unsafe void DispatchFast(CommandStream stream, BridgeAllHostApiBase host)");
             sb.AppendLine("            => DispatchFast<BridgeAllHostApiBase>(stream, host);");
             sb.AppendLine();
+            sb.AppendLine("        private static unsafe void DispatchBatch<THost>(THost host, BridgeCmdCallHostBatch* batch)");
+            sb.AppendLine("            where THost : BridgeAllHostApiBase");
+            sb.AppendLine("        {");
+            sb.AppendLine("            byte* payloadPtr = (byte*)batch + sizeof(BridgeCmdCallHostBatch);");
+            sb.AppendLine("            switch (batch->FuncId)");
+            sb.AppendLine("            {");
+            foreach (var m in modules)
+            {
+                if (m.Model.HostFns.Count == 0)
+                    continue;
+
+                foreach (var fn in m.Model.HostFns)
+                {
+                    uint id = ComputeHostFuncId(m.Module, fn.Name);
+                    string argsType = $"{m.CsNamespace}.HostArgs_{fn.Name}";
+                    sb.AppendLine($"                case 0x{id:X8}u:");
+                    sb.AppendLine($"                    if (batch->Stride >= (uint)sizeof({argsType}))");
+                    sb.AppendLine($"                        host.{fn.Name}Batch(new HostCallBatch<{argsType}>(payloadPtr, (int)batch->Count, (int)batch->Stride));");
+                    sb.AppendLine("                    break;");
+                }
+            }
+            sb.AppendLine("            }");
+            sb.AppendLine("        }");
+            sb.AppendLine();
+            // 稠密 opcode 命令：header.type 直接作为 switch 值（连续常量，编译为跳表）；单条直接调用，多条走 XxxBatch。
+            sb.AppendLine("        private static unsafe void DispatchOp<THost>(THost host, BridgeCmdCallOp* op, int payloadBytes)");
+            sb.AppendLine("            where THost : BridgeAllHostApiBase");
+            sb.AppendLine("        {");
+            sb.AppendLine("            byte* payloadPtr = (byte*)op + sizeof(BridgeCmdCallOp);");
+            sb.AppendLine("            int count = (int)op->Count;");
+            sb.AppendLine("            switch (op->Header.Type)");
+            sb.AppendLine("            {");
+            foreach (var m in modules)
+            {
+                for (int k = 0; k < m.Model.HostFns.Count; k++)
+                {
+                    var fn = m.Model.HostFns[k];
+                    string argsType = $"{m.CsNamespace}.HostArgs_{fn.Name}";
+                    sb.AppendLine($"                case 0x{m.FirstOpcode + k:X4}:");
+                    sb.AppendLine("                {");
+                    sb.AppendLine($"                    int stride = (sizeof({argsType}) + 7) & ~7;");
+                    sb.AppendLine("                    if (count <= 0 || (long)count * stride > payloadBytes)");
+                    sb.AppendLine("                        break;");
+                    sb.AppendLine("                    if (count == 1)");
+                    sb.AppendLine("                    {");
+                    sb.AppendLine($"                        ref readonly {argsType} a = ref *(({argsType}*)payloadPtr);");
+                    sb.Append("                        ");
+                    AppendHostCall(sb, fn, "host.");
+                    sb.AppendLine("                    }");
+                    sb.AppendLine("                    else");
+                    sb.AppendLine("                    {");
+                    sb.AppendLine($"                        host.{fn.Name}Batch(new HostCallBatch<{argsType}>(payloadPtr, count, stride));");
+                    sb.AppendLine("                    }");
+                    sb.AppendLine("                    break;");
+                    sb.AppendLine("                }");
+                }
+            }
+            sb.AppendLine("            }");
+            sb.AppendLine("        }");
+            sb.AppendLine();
             sb.AppendLine("        public static unsafe void Dispatch<THost>(CommandStream stream, THost host)");
             sb.Append("            where THost : class");
 
@@ -699,7 +1205,39 @@ static class Program
             sb.AppendLine("                if ((uint)size < (uint)sizeof(BridgeCommandHeader) || (uint)size > (uint)remaining)");
             sb.AppendLine("                    break;");
             sb.AppendLine();
-            sb.AppendLine("                if (header->Type == (ushort)BridgeCommandType.CallHost && size >= sizeof(BridgeCmdCallHost))");
+            sb.AppendLine("                if (header->Type >= BridgeCmdCallOp.OpcodeBase && size >= sizeof(BridgeCmdCallOp))");
+            sb.AppendLine("                {");
+            sb.AppendLine("                    byte* payloadPtr = cursor + sizeof(BridgeCmdCallOp);");
+            sb.AppendLine("                    int count = (int)((BridgeCmdCallOp*)cursor)->Count;");
+            sb.AppendLine("                    int payloadBytes = size - sizeof(BridgeCmdCallOp);");
+            sb.AppendLine();
+            sb.AppendLine("                    switch (header->Type)");
+            sb.AppendLine("                    {");
+            foreach (var m in modules)
+            {
+                for (int k = 0; k < m.Model.HostFns.Count; k++)
+                {
+                    var fn = m.Model.HostFns[k];
+                    string argsType = $"{m.CsNamespace}.HostArgs_{fn.Name}";
+                    sb.AppendLine($"                            case 0x{m.FirstOpcode + k:X4}:");
+                    sb.AppendLine("                            {");
+                    sb.AppendLine($"                                int stride = (sizeof({argsType}) + 7) & ~7;");
+                    sb.AppendLine("                                if ((long)count * stride <= payloadBytes)");
+                    sb.AppendLine("                                {");
+                    sb.AppendLine("                                    for (int i = 0; i < count; i++)");
+                    sb.AppendLine("                                    {");
+                    sb.AppendLine($"                                        ref readonly {argsType} a = ref *(({argsType}*)(payloadPtr + (long)i * stride));");
+                    sb.Append("                                        ");
+                    AppendHostCall(sb, fn, "host.");
+                    sb.AppendLine("                                    }");
+                    sb.AppendLine("                                }");
+                    sb.AppendLine("                                break;");
+                    sb.AppendLine("                            }");
+                }
+            }
+            sb.AppendLine("                    }");
+            sb.AppendLine("                }");
+            sb.AppendLine("                else if (header->Type == (ushort)BridgeCommandType.CallHost && size >= sizeof(BridgeCmdCallHost))");
             sb.AppendLine("                {");
             sb.AppendLine("                    var cmd = (BridgeCmdCallHost*)cursor;");
             sb.AppendLine("                    uint payloadBytes = (uint)(size - sizeof(BridgeCmdCallHost));");
@@ -750,6 +1288,48 @@ static class Program
                 }
             }
 
+            sb.AppendLine("                    }");
+            sb.AppendLine("                }");
+            sb.AppendLine("                else if (header->Type == (ushort)BridgeCommandType.DefineString && size >= sizeof(BridgeCmdDefineString))");
+            sb.AppendLine("                {");
+            sb.AppendLine("                    BridgeStringTable.Define(in *(BridgeCmdDefineString*)cursor);");
+            sb.AppendLine("                }");
+            sb.AppendLine("                else if (header->Type == (ushort)BridgeCommandType.CallHostBatch && size >= sizeof(BridgeCmdCallHostBatch))");
+            sb.AppendLine("                {");
+            sb.AppendLine("                    var batch = (BridgeCmdCallHostBatch*)cursor;");
+            sb.AppendLine("                    if ((ulong)batch->Count * batch->Stride > (ulong)(size - sizeof(BridgeCmdCallHostBatch)))");
+            sb.AppendLine("                        break;");
+            sb.AppendLine();
+            sb.AppendLine("                    byte* payloadPtr = cursor + sizeof(BridgeCmdCallHostBatch);");
+            sb.AppendLine("                    int count = (int)batch->Count;");
+            sb.AppendLine("                    int stride = (int)batch->Stride;");
+            sb.AppendLine();
+            sb.AppendLine("                    switch (batch->FuncId)");
+            sb.AppendLine("                    {");
+            foreach (var m in modules)
+            {
+                if (m.Model.HostFns.Count == 0)
+                    continue;
+
+                foreach (var fn in m.Model.HostFns)
+                {
+                    uint id = ComputeHostFuncId(m.Module, fn.Name);
+                    string argsType = $"{m.CsNamespace}.HostArgs_{fn.Name}";
+                    sb.AppendLine($"                            case 0x{id:X8}u:");
+                    sb.AppendLine("                            {");
+                    sb.AppendLine($"                                if (stride >= sizeof({argsType}))");
+                    sb.AppendLine("                                {");
+                    sb.AppendLine("                                    for (int i = 0; i < count; i++)");
+                    sb.AppendLine("                                    {");
+                    sb.AppendLine($"                                        ref readonly {argsType} a = ref *(({argsType}*)(payloadPtr + (long)i * stride));");
+                    sb.Append("                                        ");
+                    AppendHostCall(sb, fn, "host.");
+                    sb.AppendLine("                                    }");
+                    sb.AppendLine("                                }");
+                    sb.AppendLine("                                break;");
+                    sb.AppendLine("                            }");
+                }
+            }
             sb.AppendLine("                    }");
             sb.AppendLine("                }");
             sb.AppendLine();
@@ -761,6 +1341,22 @@ static class Program
             return sb.ToString();
         }
 
+        // 写出 `<target>Fn(a.Arg0, a.Arg1, ...);`（a 为 HostArgs_Fn 的只读引用）。
+        private static void AppendHostCall(StringBuilder sb, ApiFn fn, string target)
+        {
+            sb.Append(target);
+            sb.Append(fn.Name);
+            sb.Append('(');
+            for (int i = 0; i < fn.Args.Count; i++)
+            {
+                if (i > 0) sb.Append(", ");
+                var arg = fn.Args[i];
+                string field = $"a.{ToPascal(arg.Name)}";
+                sb.Append(MapCsHostArgExpr(arg.CppType, field));
+            }
+            sb.AppendLine(");");
+        }
+
         private static string EmitStructs(ApiModel model, string csNamespace)
         {
             var sb = new StringBuilder();
@@ -837,24 +1433,28 @@ static class Program
             sb.AppendLine("    {");
             foreach (var fn in model.CoreFns)
             {
-                sb.Append($"        public static void {fn.Name}(this BridgeCore core");
-                foreach (var arg in fn.Args)
+                // 直接推送（一次 native 调用）与写入 BridgeCallWriter（之后批量提交）两个重载。
+                foreach (var (target, push) in new[] { ("BridgeCore core", "core.PushCallCore"), ("BridgeCallWriter calls", "calls.Append") })
                 {
-                    sb.Append(", ");
-                    sb.Append(MapCsCoreCallArgParamType(arg.CppType));
-                    sb.Append(' ');
-                    sb.Append(ToCamel(arg.Name));
+                    sb.Append($"        public static void {fn.Name}(this {target}");
+                    foreach (var arg in fn.Args)
+                    {
+                        sb.Append(", ");
+                        sb.Append(MapCsCoreCallArgParamType(arg.CppType));
+                        sb.Append(' ');
+                        sb.Append(ToCamel(arg.Name));
+                    }
+                    sb.AppendLine(")");
+                    sb.AppendLine("        {");
+                    sb.AppendLine($"            var a = new CoreArgs_{fn.Name}");
+                    sb.AppendLine("            {");
+                    foreach (var arg in fn.Args)
+                        sb.AppendLine($"                {ToPascal(arg.Name)} = {ToCamel(arg.Name)},");
+                    sb.AppendLine("            };");
+                    sb.AppendLine($"            {push}((uint)CoreFuncId.{fn.Name}, a);");
+                    sb.AppendLine("        }");
+                    sb.AppendLine();
                 }
-                sb.AppendLine(")");
-                sb.AppendLine("        {");
-                sb.AppendLine($"            var a = new CoreArgs_{fn.Name}");
-                sb.AppendLine("            {");
-                foreach (var arg in fn.Args)
-                    sb.AppendLine($"                {ToPascal(arg.Name)} = {ToCamel(arg.Name)},");
-                sb.AppendLine("            };");
-                sb.AppendLine($"            core.PushCallCore((uint)CoreFuncId.{fn.Name}, a);");
-                sb.AppendLine("        }");
-                sb.AppendLine();
             }
             sb.AppendLine("    }");
             sb.AppendLine("}");
@@ -888,6 +1488,7 @@ static class Program
                 "BridgeQuat" => "BridgeQuat",
                 "BridgeTransform" => "BridgeTransform",
                 "BridgeStringView" => "BridgeStringView",
+                "BridgeStringId" => "BridgeStringId",
                 _ => throw new InvalidOperationException($"未支持的 C++ 类型：{cppType}")
             };
         }
@@ -897,6 +1498,7 @@ static class Program
             return cppType switch
             {
                 "BridgeStringView" => "BridgeStringView",
+                "BridgeStringId" => "BridgeStringId",
                 "BridgeLogLevel" => "BridgeLogLevel",
                 "BridgeAssetType" => "BridgeAssetType",
                 "BridgeAssetStatus" => "BridgeAssetStatus",
@@ -920,8 +1522,8 @@ static class Program
 
         private static string MapCsCoreCallArgType(string cppType)
         {
-            if (cppType == "BridgeStringView")
-                throw new InvalidOperationException("Core API（Host->Core）禁止使用 BridgeStringView；请改为传 handle/hash/id。");
+            if (cppType == "BridgeStringView" || cppType == "BridgeStringId")
+                throw new InvalidOperationException($"Core API（Host->Core）禁止使用 {cppType}；请改为传 handle/hash/id。");
             return MapCsHostArgType(cppType);
         }
 
@@ -40,7 +40,7 @@ extern "C" {
 //------------------------------------------------------------------------------
 
 #define BRIDGE_VERSION_MAJOR 0
-#define BRIDGE_VERSION_MINOR 2
+#define BRIDGE_VERSION_MINOR 4
 #define BRIDGE_VERSION_PATCH 0
 
 typedef struct BridgeVersion
@@ -71,10 +71,41 @@ typedef enum BridgeMode : uint32_t
   BRIDGE_MODE_ROBOT = 1
 } BridgeMode;
 
+typedef enum BridgeCoreFlags : uint32_t
+{
+  BRIDGE_CORE_FLAG_NONE = 0,
+  // 双缓冲 command stream（见 BridgeCore_ReleaseStream）。
+  BRIDGE_CORE_FLAG_DOUBLE_BUFFERED = 1u << 0,
+  // 线程安全的 Host->Core 调用（见 BridgeCore_PushCallCore）。
+  BRIDGE_CORE_FLAG_CONCURRENT_CALLS = 1u << 1,
+  // v0.3 稠密 opcode 命令（见 BridgeCmdCallOp；Host 需先通过 Bridge_GetHostOpcodes 握手）。
+  BRIDGE_CORE_FLAG_DENSE_OPCODES = 1u << 2,
+  // 命令缓冲预留一段虚拟地址空间（command_bytes_reserve），按需提交物理页：stream 增长时不搬移、不复制。
+  // 不支持的平台（32 位、WebGL 等）自动退回堆缓冲。
+  BRIDGE_CORE_FLAG_VIRTUAL_COMMAND_BUFFER = 1u << 3,
+  // 与 BRIDGE_CORE_FLAG_VIRTUAL_COMMAND_BUFFER 一起使用：按 2 MB 对齐预留并提示透明大页（Linux），
+  // 提交粒度也变为 2 MB，只适合单帧很大的 stream。
+  BRIDGE_CORE_FLAG_HUGE_PAGES = 1u << 4
+} BridgeCoreFlags;
+
 typedef struct BridgeCoreConfig
 {
   uint64_t seed;
   uint32_t mode; // BridgeMode
+  // BridgeCoreFlags 按位组合；默认 0。
+  uint32_t flags;
+  // v0.4 初始缓冲容量（字节），0 表示默认值。超出后按需扩容，只影响创建时的预留与内存占用。
+  // command stream（默认 1024；双缓冲模式每个 stream 各一份）。
+  uint32_t command_bytes_capacity;
+  // 每帧字符串 arena 的首块（默认 4096；双缓冲模式每个 stream 各一份）。
+  uint32_t string_bytes_capacity;
+  // Host->Core 待分发调用缓冲（默认 256）。
+  uint32_t call_bytes_capacity;
+  // BRIDGE_CORE_FLAG_VIRTUAL_COMMAND_BUFFER 时每个 stream 预留的地址空间（默认 64 MB）；单帧超出后退回堆缓冲。
+  uint32_t command_bytes_reserve;
+  // 尖峰回收：连续 64 帧命令都不超过该字节数时，把多出的缓冲还给系统（虚拟缓冲 decommit，堆缓冲缩小）。
+  // 0 表示不回收。
+  uint32_t command_bytes_retain;
   // 预留字段（用于未来 ABI 扩展），必须为 0。
   uint32_t reserved0;
 } BridgeCoreConfig;
@@ -82,6 +113,35 @@ typedef struct BridgeCoreConfig
 BRIDGE_API BridgeCore* BRIDGE_CALL BridgeCore_Create(BridgeCoreConfig config);
 BRIDGE_API void BRIDGE_CALL BridgeCore_Destroy(BridgeCore* core);
 
+// 批量创建：configs[i] 对应 out_cores[i]。所有 core 及其初始缓冲来自同一块连续内存（slab），
+// 相邻 core 在内存中也相邻（按同样顺序交给 TickMany 时访问更集中）。
+// 每个 core 仍用 BridgeCore_Destroy 单独销毁，slab 在其最后一个 core 销毁时释放。
+// 失败时不创建任何 core，out_cores 全部置为 null。
+BRIDGE_API BridgeResult BRIDGE_CALL BridgeCore_CreateMany(
+  const BridgeCoreConfig* configs,
+  uint32_t count,
+  BridgeCore** out_cores);
+
+// 原地回收：等价于 Destroy 后用 config 重新 Create（重新创建业务层 ICoreApp，清空待分发调用、
+// 本 core 的驻留字符串宣告记录、统计与追踪开关，结束录制），但保留已分配的缓冲与 core 句柄。
+// 不能与该 core 的 Tick / 推送调用并发；双缓冲模式下必须先归还所有 stream，否则返回 BRIDGE_ERROR。
+BRIDGE_API BridgeResult BRIDGE_CALL BridgeCore_Reset(BridgeCore* core, BridgeCoreConfig config);
+
+// 克隆：从一个已预热的 core（例如已走完资源请求与 Spawn 的机器人）复制出新 core，跳过逐个启动的 Host 往返。
+// 副本得到 source 的 config（seed 换为参数 seed）、业务层状态（ICoreApp::Clone，App 据 seed 重新播种）、
+// request id 计数与 Tick 计数，缓冲按 source 当前容量预留。
+// 不复制：尚未分发的 Host->Core 调用、Host 持有的 stream、驻留字符串宣告记录（副本首次使用时重新宣告）、
+// 统计、追踪开关与录制。业务层不支持克隆时返回 null。不能与 source 的 Tick / 推送调用并发。
+BRIDGE_API BridgeCore* BRIDGE_CALL BridgeCore_Clone(const BridgeCore* source, uint64_t seed);
+
+// 批量克隆：副本 i 的 seed 为 seeds[i]，所有副本来自同一块 slab（同 BridgeCore_CreateMany）。
+// 失败时不创建任何 core，out_cores 全部置为 null。
+BRIDGE_API BridgeResult BRIDGE_CALL BridgeCore_CloneMany(
+  const BridgeCore* source,
+  const uint64_t* seeds,
+  uint32_t count,
+  BridgeCore** out_cores);
+
 //------------------------------------------------------------------------------
 // Common blittable structs
 //------------------------------------------------------------------------------
@@ -96,6 +156,11 @@ typedef struct BridgeStringView
   uint32_t reserved0;
 } BridgeStringView;
 
+// 驻留字符串 id（跨 Tick 稳定，进程内唯一；0 表示空串）。
+// Core 首次在某个 core 上使用一个字符串时，会先写入 BRIDGE_CMD_DEFINE_STRING 向 Host 宣告 id -> 内容，
+// 之后 payload 中只携带 id。
+typedef uint32_t BridgeStringId;
+
 typedef struct BridgeVec3
 {
   float x;
@@ -152,12 +217,19 @@ typedef enum BridgeCommandType : uint16_t
 {
   BRIDGE_CMD_NONE = 0,
   // 通用 Host 调用：func_id + payload（由代码生成决定 payload 结构）
-  BRIDGE_CMD_CALL_HOST = 1
+  BRIDGE_CMD_CALL_HOST = 1,
+  // 宣告驻留字符串：id -> UTF-8 内容（见 BridgeStringId）
+  BRIDGE_CMD_DEFINE_STRING = 2,
+  // 同一函数的连续调用：func_id + count 个等长 payload（见 BridgeCmdCallHostBatch）
+  BRIDGE_CMD_CALL_HOST_BATCH = 3
 } BridgeCommandType;
 
+// header.type >= BRIDGE_CMD_OPCODE_BASE 的命令为稠密 opcode 命令（见 BridgeCmdCallOp）。
+#define BRIDGE_CMD_OPCODE_BASE 0x100
+
 typedef struct BridgeCommandHeader
 {
-  uint16_t type; // BridgeCommandType
+  uint16_t type; // BridgeCommandType 或 opcode
   // 命令总大小（包含 header+后续数据），必须 8 字节对齐
   uint16_t size;
 } BridgeCommandHeader;
@@ -170,6 +242,56 @@ typedef struct BridgeCmdCallHost
   uint32_t func_id;
 } BridgeCmdCallHost;
 
+// 批量 Host 调用命令头（Runtime 自动把连续的同一 func_id 调用合并为一条）：
+// - 其后紧跟 count 个 payload，每个占 stride 字节（sizeof(payload) 按 8 字节补齐）。
+// - 第 i 个 payload 位于 (uint8_t*)cmd + sizeof(BridgeCmdCallHostBatch) + i * stride。
+// - 语义等价于按顺序执行 count 条 BRIDGE_CMD_CALL_HOST；header.size 上限决定了单条批量命令的容量，
+//   超出时 Runtime 会另起一条。
+typedef struct BridgeCmdCallHostBatch
+{
+  BridgeCommandHeader header;
+  uint32_t func_id;
+  uint32_t count;
+  uint32_t stride;
+} BridgeCmdCallHostBatch;
+
+// 稠密 opcode 调用命令（v0.3，仅在 core 打开 BRIDGE_CORE_FLAG_DENSE_OPCODES 时出现）：
+// - header.type 即 BridgeGen 分配的 opcode（见 Bridge_GetHostOpcodes），Host 可直接按 opcode 跳表分发。
+// - 其后紧跟 count 个 payload，每个占 stride = sizeof(payload) 按 8 字节补齐（由 opcode 决定，Host 编译期已知），
+//   header.size == sizeof(BridgeCmdCallOp) + count * stride。单次调用与批量调用共用这一种布局。
+// - 相比 CALL_HOST/CALL_HOST_BATCH 省去 func_id/stride：命令头总计 8 字节（payload 仍保持 8 字节对齐）。
+// - 未分配 opcode 的调用（例如 CoreContext::CallHost）仍以 BRIDGE_CMD_CALL_HOST 写出，两种命令可混排。
+typedef struct BridgeCmdCallOp
+{
+  BridgeCommandHeader header;
+  uint32_t count;
+} BridgeCmdCallOp;
+
+// Host 函数的稠密 opcode 表项（v0.3，见 BRIDGE_CORE_FLAG_DENSE_OPCODES / BridgeCmdCallOp）。
+typedef struct BridgeHostOpcode
+{
+  // 写入 BridgeCommandHeader.type 的 opcode（>= BRIDGE_CMD_OPCODE_BASE）。
+  uint16_t opcode;
+  // 预留字段（用于未来 ABI 扩展），必须为 0。
+  uint16_t reserved0;
+  // 对应的 func_id（与 BRIDGE_CMD_CALL_HOST 中的 func_id 相同）。
+  uint32_t func_id;
+} BridgeHostOpcode;
+
+// 握手：返回本库（业务层代码生成）使用的 opcode <-> func_id 表，按 opcode 递增排列，进程生命周期内有效。
+// Host 应与自己生成的表逐项比对，一致时才为 core 打开 BRIDGE_CORE_FLAG_DENSE_OPCODES。
+BRIDGE_API BridgeResult BRIDGE_CALL Bridge_GetHostOpcodes(const BridgeHostOpcode** out_entries, uint32_t* out_count);
+
+// 驻留字符串宣告：
+// - 同一 core 上每个 id 只宣告一次（先于任何引用该 id 的命令）。
+// - utf8 指向 Runtime 常驻存储，进程生命周期内有效（Host 可直接缓存解码结果）。
+typedef struct BridgeCmdDefineString
+{
+  BridgeCommandHeader header;
+  BridgeStringId id;
+  BridgeStringView utf8;
+} BridgeCmdDefineString;
+
 // Command stream view（Core -> Host）：
 // - 仅包含 ptr+len，指针由 Core 持有。
 // - 只保证在下一次 Tick（或 Destroy）前有效。
@@ -183,6 +305,18 @@ typedef struct BridgeCommandStream
 
 BRIDGE_API void BRIDGE_CALL BridgeCore_Tick(BridgeCore* core, float dt);
 
+// 双缓冲模式（BRIDGE_CORE_FLAG_DOUBLE_BUFFERED）：
+// - 两个 stream 交替写入：第 N 帧的 stream 在第 N+1 帧 Tick 期间仍然有效，
+//   Host 可以在一个线程上分发第 N 帧，同时在另一个线程上 Tick 第 N+1 帧。
+// - Host 分发完一帧后调用 BridgeCore_ReleaseStream 归还（按帧顺序，每次归还最早的一帧；
+//   可在分发线程上调用，但同一个 core 只能有一个归还线程）。
+// - 第 N+2 帧 Tick 时，若第 N 帧尚未归还，则本次 Tick 被拒绝（core 不推进）：
+//   BridgeCore_Tick 直接返回，BridgeCore_TickAndGetCommandStream 返回 BRIDGE_ERROR，
+//   批量 Tick 中该 core 输出空 stream。
+// - BridgeCoreGroup 的输出写在 group 的 arena 中，不受双缓冲保护。
+// 单缓冲模式下 ReleaseStream 为空操作（返回 BRIDGE_OK）。
+BRIDGE_API BridgeResult BRIDGE_CALL BridgeCore_ReleaseStream(BridgeCore* core);
+
 // 组合调用：Tick + GetCommandStream（减少 Host 侧 P/Invoke 次数）。
 // 等价于：
 //   BridgeCore_Tick(core, dt);
@@ -196,12 +330,106 @@ BRIDGE_API BridgeResult BRIDGE_CALL BridgeCore_TickAndGetCommandStream(
 // 批量 Tick + 获取 command streams（机器人/压测用）。
 // - cores / out_streams 均为长度为 count 的数组指针。
 // - 成功返回后：out_streams[i] 为 cores[i] 本帧的 stream。
+// - 默认在调用线程上串行执行；开启并行模式见 BridgeCore_SetTickWorkerCount。
 BRIDGE_API BridgeResult BRIDGE_CALL BridgeCore_TickManyAndGetCommandStreams(
   BridgeCore** cores,
   uint32_t count,
   float dt,
   BridgeCommandStream* out_streams);
 
+// 批量 Tick 的并行模式（opt-in，进程级设置，默认 0）。
+// - worker_count == 0：TickMany 在调用线程上串行执行。
+// - worker_count > 0：Runtime 内部常驻 worker_count 个线程，调用线程也参与执行；
+//   批次被切成若干 chunk，空闲线程会窃取其它线程未完成的 chunk（单个慢 Tick 不会拖住整批）。
+// - out_streams 的输出与串行模式完全一致；TickMany 返回时整批已完成。
+// 约束：
+// - 同一批次的 ICoreApp::Tick 会在不同线程上并发执行：业务层不得共享可变的全局状态。
+// - cores 中不能包含重复的 core。
+// - 上限 256；超出返回 BRIDGE_INVALID_ARGUMENT。
+BRIDGE_API BridgeResult BRIDGE_CALL BridgeCore_SetTickWorkerCount(uint32_t worker_count);
+
+// 异步批量 Tick 的一个已完成分片：cores[begin .. begin+count) 的 out_streams 已可读。
+typedef struct BridgeTickShard
+{
+  uint32_t begin;
+  uint32_t count;
+} BridgeTickShard;
+
+// 异步批量 Tick（与 BridgeCore_TickManyAndGetCommandStreams 输出相同，但按 shard 分批交还）：
+// - Begin 启动批次后立即返回；cores 按 chunk 切成若干 shard，由 worker 池执行。
+// - cores / out_streams 必须保持有效，直到 Poll 报告 out_remaining == 0。
+// - 同一时刻只能有一个批次；批次未结束时再次 Begin / TickMany / SetTickWorkerCount 返回 BRIDGE_ERROR。
+// - 未开启 worker 池（worker_count == 0）也可使用：shard 由 Poll 的调用线程逐个执行。
+BRIDGE_API BridgeResult BRIDGE_CALL BridgeCore_TickManyBegin(
+  BridgeCore** cores,
+  uint32_t count,
+  float dt,
+  BridgeCommandStream* out_streams);
+
+// 取出已完成的 shard（最多 capacity 个，按完成顺序）：
+// - 只要批次未结束，至少返回 1 个 shard；暂无完成的 shard 时，调用线程会亲自执行一个 chunk。
+// - out_remaining：尚未交还的 core 数；为 0 表示批次已结束（没有进行中的批次时也返回 0）。
+// - Host 可在处理已交还 shard 的同时，让其余 shard 继续在 worker 上 Tick；
+//   对已交还的 core 调用 BridgeCore_PushCallCore 是安全的，对未交还的 core 则不行。
+BRIDGE_API BridgeResult BRIDGE_CALL BridgeCore_PollCompletedShards(
+  BridgeTickShard* out_shards,
+  uint32_t capacity,
+  uint32_t* out_count,
+  uint32_t* out_remaining);
+
+// Core group：一组 core 共享的连续命令 arena（批量模式）。
+// - 通过 group 批量 Tick 时，所有 core 的命令依次写入 group 持有的 arena，
+//   out_streams[i] 为 cores[i] 在 arena 中的切片（ptr 指向 arena 内部）。
+// - Host 按下标顺序分发即为一次顺序扫描（串行模式下整批连续；并行模式下每个 chunk 内连续）。
+// - 切片只保证在该 group 的下一次 Tick、对应 core 的下一次 Tick、或 group Destroy 之前有效。
+// - 同一个 core 在 group 外单独 Tick 也是允许的（回到 core 自己的缓冲）。
+// - group 可以先于 core 销毁：core 不再引用 arena，之后 BridgeCore_GetCommandStream 仍返回同一切片（指针已失效，长度不变）。
+typedef struct BridgeCoreGroup BridgeCoreGroup;
+
+BRIDGE_API BridgeCoreGroup* BRIDGE_CALL BridgeCoreGroup_Create(void);
+BRIDGE_API void BRIDGE_CALL BridgeCoreGroup_Destroy(BridgeCoreGroup* group);
+
+// 与 BridgeCore_TickManyAndGetCommandStreams 相同（含并行模式），但命令写入 group 的连续 arena。
+BRIDGE_API BridgeResult BRIDGE_CALL BridgeCoreGroup_TickManyAndGetCommandStreams(
+  BridgeCoreGroup* group,
+  BridgeCore** cores,
+  uint32_t count,
+  float dt,
+  BridgeCommandStream* out_streams);
+
+// 按时间预算批量 Tick（GAME 模式下每帧只能给 Core 固定的时间片）：
+// - 每次调用，数组中的每个 core 都记一笔 dt 的欠账；从上次停下的位置（轮转游标）开始依次 Tick，
+//   每个 core 以它累计欠下的 dt 一次补上，耗时达到 budget_ns 即停止，下次从下一个 core 继续，每个 core 轮到的机会相同。
+// - 每次至少 Tick 一个 core，至多每个 core 一次；预算为 0 时每帧推进一个 core。
+// - 在调用线程上串行执行（不使用 BridgeCore_SetTickWorkerCount 的 worker 池）。
+// - 欠账按 cores 数组下标记：每帧应传入同一个数组；数组长度变化时新下标从本帧开始记账。
+typedef struct BridgeTickScheduler BridgeTickScheduler;
+
+typedef struct BridgeTickBudgetResult
+{
+  // 本次 Tick 的是下标 first, first+1, ... 共 count 个 core（到数组末尾后回到 0）。
+  uint32_t first;
+  uint32_t count;
+  // 本次调用的实际耗时（最后一个 core 的 Tick 可能超出预算）。
+  uint64_t elapsed_ns;
+} BridgeTickBudgetResult;
+
+BRIDGE_API BridgeTickScheduler* BRIDGE_CALL BridgeTickScheduler_Create(void);
+BRIDGE_API void BRIDGE_CALL BridgeTickScheduler_Destroy(BridgeTickScheduler* scheduler);
+
+// - out_streams[i]：轮到的 core 本帧的 stream；没轮到的（以及双缓冲下 Tick 被拒绝的）为空 stream。
+// - out_dts[i]（可为 null）：轮到的 core 本次 Tick 所用的 dt；其余 core 目前欠下的 dt（下次轮到时补上）。
+// - out_result（可为 null）：本次 Tick 的下标范围与耗时。
+BRIDGE_API BridgeResult BRIDGE_CALL BridgeTickScheduler_TickManyAndGetCommandStreams(
+  BridgeTickScheduler* scheduler,
+  BridgeCore** cores,
+  uint32_t count,
+  float dt,
+  uint64_t budget_ns,
+  BridgeCommandStream* out_streams,
+  float* out_dts,
+  BridgeTickBudgetResult* out_result);
+
 // 返回最近一次 BridgeCore_Tick 生成的 command stream（连续字节流）指针。
 // 返回的内存由 Core 持有，只保证在下一次 BridgeCore_Tick（或 BridgeCore_Destroy）前有效。
 BRIDGE_API BridgeResult BRIDGE_CALL BridgeCore_GetCommandStream(
@@ -215,12 +443,291 @@ BRIDGE_API BridgeResult BRIDGE_CALL BridgeCore_GetCommandStream(
 
 // Host 调用 Core API（由代码生成决定 func_id 与 payload 结构）。
 // - payload 指向 blittable 数据（可为 null，当 payload_size==0）
+// - 默认只能在 Tick 线程、Tick 之外调用。创建时打开 BRIDGE_CORE_FLAG_CONCURRENT_CALLS 后，
+//   PushCallCore / PushCallsCore / PushCallsMany 可在任意线程（包括 Tick 进行中）调用：调用进入无锁
+//   MPSC 队列，Tick 开始时一次性取出；Tick 期间推送的调用在下一次 Tick 分发。该模式不支持 AcquireCallBuffer。
 BRIDGE_API BridgeResult BRIDGE_CALL BridgeCore_PushCallCore(
   BridgeCore* core,
   uint32_t func_id,
   const void* payload,
   uint32_t payload_size);
 
+// 预编码的 Host->Core 调用序列（BridgeCore_PushCallsCore / BridgeCore_PushCallsMany 的输入）：
+// - 每条调用为 BridgeCallCoreHeader + payload，payload 按 8 字节补齐；多条调用首尾相接。
+// - 因此 len 必须是 8 的倍数；len==0 表示没有调用（ptr 可为 null）。
+typedef struct BridgeCallCoreHeader
+{
+  uint32_t func_id;
+  uint32_t payload_size;
+} BridgeCallCoreHeader;
+
+typedef struct BridgeCallBuffer
+{
+  const void* ptr;
+  uint32_t len;
+  uint32_t reserved0;
+} BridgeCallBuffer;
+
+// 一次推送多条调用：整段校验后以一次拷贝追加，语义等价于按顺序逐条 BridgeCore_PushCallCore。
+// 格式不合法时返回 BRIDGE_INVALID_ARGUMENT 且不追加任何调用。
+BRIDGE_API BridgeResult BRIDGE_CALL BridgeCore_PushCallsCore(
+  BridgeCore* core,
+  const void* calls,
+  uint32_t len);
+
+// 批量版本：buffers[i] 推送给 cores[i]。先校验全部输入，任一不合法则整批不生效。
+BRIDGE_API BridgeResult BRIDGE_CALL BridgeCore_PushCallsMany(
+  BridgeCore** cores,
+  const BridgeCallBuffer* buffers,
+  uint32_t count);
+
+// 零拷贝推送：在 core 的待分发缓冲末尾预留 bytes 字节的可写区域（8 字节对齐），Host 直接按
+// BridgeCallCoreHeader + payload 的格式写入，再用 BridgeCore_CommitCalls 提交实际写入的字节数。
+// - 同一 core 同时只能有一个未提交的区域；在此期间其它 Push/Acquire 调用返回 BRIDGE_ERROR。
+// - 区域只在 Commit 或下一次 Tick 之前有效；未提交就 Tick 视为放弃（不会分发）。
+// - bytes 为 0 或大于 UINT32_MAX - 7（补齐后超出 uint32_t）时返回 BRIDGE_INVALID_ARGUMENT，不预留区域。
+BRIDGE_API BridgeResult BRIDGE_CALL BridgeCore_AcquireCallBuffer(
+  BridgeCore* core,
+  uint32_t bytes,
+  void** out_ptr);
+
+// bytes_written 不能超过预留大小（0 表示放弃）。格式不合法时丢弃整个区域并返回 BRIDGE_INVALID_ARGUMENT。
+BRIDGE_API BridgeResult BRIDGE_CALL BridgeCore_CommitCalls(
+  BridgeCore* core,
+  uint32_t bytes_written);
+
+//------------------------------------------------------------------------------
+// Shared asset requests
+//------------------------------------------------------------------------------
+
+// 跨 core 的资源请求去重（可选）：挂到同一个 BridgeAssetCache 的 core 经 CoreContext::RequestSharedAsset
+// 请求资源时，同一 (asset_type, key) 只有第一个请求发给 Host，其它 core 挂到这个进行中的请求上，
+// 结果到达之后的请求直接命中缓存。Host 不需要任何改动，照常回执收到的那一个请求：
+// - 发出请求的 core 分发 Host 推来的“加载完成”调用（func_id 为 loaded_func_id，payload 以 uint64 request_id 开头）时，
+//   Runtime 把 payload 记为该 key 的结果；
+// - 其它 core 在各自下一次 Tick 开始时收到一条同样的调用（request_id 换成自己的），排在 Host 推送的调用之前，
+//   与之一起分发、统计与录制。
+// 因此共享资源的 Host 加载次数与 stream 字节数不随 core 数增长。
+// - 只缓存成功（status 为 BRIDGE_ASSET_STATUS_OK）的结果，在缓存的生命周期内一直有效；Host 卸载资源后应换用新的缓存。
+// - 失败的回执照样转给当时挂在这个请求上的 core，随后该 key 从缓存移除，之后的请求重新发给 Host。
+// - 发出请求的 core 在回执到达前被销毁、Reset 或换挂时，该 key 同样从缓存移除；已挂着的 core 收到一条
+//   status 为 BRIDGE_ASSET_STATUS_ERROR、其余字段为 0 的“加载完成”调用，可以重新请求。
+// - 并行 Tick 时，挂着的 core 在结果到达的当帧还是下一帧收到，取决于与发出请求的 core 的先后。
+// - 缓存必须比挂在上面的 core 活得久；一个进程或一个 core group 共用一个即可。
+typedef struct BridgeAssetCache BridgeAssetCache;
+
+typedef struct BridgeAssetCacheStats
+{
+  // RequestSharedAsset 的总次数，其中：发给 Host 的、挂到进行中请求的、直接命中结果的。
+  uint64_t requests;
+  uint64_t host_requests;
+  uint64_t attached;
+  uint64_t hits;
+  // 已转给等待中的 core 的结果条数。
+  uint64_t fanned_out;
+  // 当前缓存的 key 数（含进行中的请求）。
+  uint32_t entries;
+  // 预留字段（用于未来 ABI 扩展），必须为 0。
+  uint32_t reserved0;
+} BridgeAssetCacheStats;
+
+// “加载完成”调用的格式（例如生成的 AssetLoaded）：缓存据此判断回执是否成功，并为放弃的请求合成失败回执。
+typedef struct BridgeAssetCacheConfig
+{
+  // “加载完成”调用的 func_id。
+  uint32_t loaded_func_id;
+  // 该调用的 payload 字节数（以 uint64 request_id 开头）。
+  uint32_t payload_size;
+  // payload 中 BridgeAssetStatus（uint32）字段的字节偏移。
+  uint32_t status_offset;
+  // 预留字段（用于未来扩展），必须为 0。
+  uint32_t reserved0;
+} BridgeAssetCacheConfig;
+
+// config 不合法（payload 放不下 request_id 与 status，或 reserved0 非 0）时返回 null。
+BRIDGE_API BridgeAssetCache* BRIDGE_CALL BridgeAssetCache_Create(BridgeAssetCacheConfig config);
+BRIDGE_API void BRIDGE_CALL BridgeAssetCache_Destroy(BridgeAssetCache* cache);
+
+// 把一批 core 挂到 cache（null 表示摘下）。与 BridgeCore_PushCallCore（默认模式）相同：只能在 Tick 之外调用。
+// BridgeCore_Clone/CloneMany 的副本挂在模板的缓存上；BridgeCore_Reset 保留所挂的缓存。
+BRIDGE_API BridgeResult BRIDGE_CALL BridgeCore_SetAssetCache(BridgeCore** cores, uint32_t count, BridgeAssetCache* cache);
+
+BRIDGE_API BridgeResult BRIDGE_CALL BridgeAssetCache_GetStats(BridgeAssetCache* cache, BridgeAssetCacheStats* out_stats);
+
+//------------------------------------------------------------------------------
+// Statistics
+//------------------------------------------------------------------------------
+
+// 单个 core 的运行时统计（自创建或上次 BridgeCore_ResetStats 起累计）。
+// 计数在热路径上更新，需以 BRIDGE_ENABLE_STATS=ON 编译 Runtime；关闭时不产生任何开销，
+// 下列查询函数返回 BRIDGE_ERROR（输出清零）。
+typedef struct BridgeCoreStats
+{
+  // 已完成的 Tick 数。
+  uint64_t frames;
+  // Core -> Host：调用数（批量命令按条目计；合并调用原地覆盖不计）与 stream 字节数（含命令头、DEFINE_STRING）。
+  uint64_t calls_emitted;
+  uint64_t bytes_emitted;
+  // 最近一帧的调用数 / stream 字节数，以及单帧 stream 字节数的最大值。
+  uint64_t last_frame_calls;
+  uint64_t last_frame_bytes;
+  uint64_t peak_frame_bytes;
+  // CoreContext::StoreUtf8 的次数与字节数；本 core 宣告的驻留字符串数（BRIDGE_CMD_DEFINE_STRING 条数）。
+  uint64_t strings_stored;
+  uint64_t string_bytes_stored;
+  uint64_t strings_defined;
+  // Host -> Core：已分发的调用数与字节数（含 BridgeCallCoreHeader），以及单帧分发字节数的最大值。
+  uint64_t inbound_calls;
+  uint64_t inbound_bytes;
+  uint64_t peak_inbound_bytes;
+  // 缓冲重新分配次数：command stream（含 core group 的 arena）与待分发调用缓冲（并发调用模式下不计）。
+  uint64_t stream_reallocs;
+  uint64_t call_buffer_reallocs;
+  // 当前占用的容量（字节）：command stream（含字符串 arena）与待分发调用缓冲。
+  uint64_t stream_capacity_bytes;
+  uint64_t call_buffer_capacity_bytes;
+  // Tick 耗时（纳秒）：最近一次与最大值。
+  uint64_t last_tick_ns;
+  uint64_t max_tick_ns;
+  // 发出过调用的不同 func_id 个数（明细见 BridgeCore_GetFuncStats）。
+  uint64_t func_count;
+} BridgeCoreStats;
+
+// 按 func_id 的 Core -> Host 调用明细。
+typedef struct BridgeFuncStats
+{
+  uint32_t func_id;
+  // 预留字段（用于未来 ABI 扩展），必须为 0。
+  uint32_t reserved0;
+  // 调用数与 payload 字节数（按 8 字节补齐后计，不含命令头）。
+  uint64_t calls;
+  uint64_t payload_bytes;
+} BridgeFuncStats;
+
+// 与 BridgeCore_PushCallCore（默认模式）相同：只能在 Tick 线程、Tick 之外调用。
+BRIDGE_API BridgeResult BRIDGE_CALL BridgeCore_GetStats(const BridgeCore* core, BridgeCoreStats* out_stats);
+
+// 批量查询：out_per_core（可为 null）为长度 count 的数组，out_total（可为 null）为汇总。
+// 汇总中计数与容量求和；peak_*、last_tick_ns、max_tick_ns、func_count 取最大值。
+BRIDGE_API BridgeResult BRIDGE_CALL BridgeCore_GetStatsMany(
+  BridgeCore** cores,
+  uint32_t count,
+  BridgeCoreStats* out_per_core,
+  BridgeCoreStats* out_total);
+
+// 写出至多 capacity 条明细（顺序不定），out_count 返回实际的 func_id 个数（可大于 capacity）。
+BRIDGE_API BridgeResult BRIDGE_CALL BridgeCore_GetFuncStats(
+  const BridgeCore* core,
+  BridgeFuncStats* out_entries,
+  uint32_t capacity,
+  uint32_t* out_count);
+
+// 清零计数（容量类字段不受影响）。
+BRIDGE_API BridgeResult BRIDGE_CALL BridgeCore_ResetStats(BridgeCore* core);
+
+//------------------------------------------------------------------------------
+// Tracing
+//------------------------------------------------------------------------------
+
+// 帧追踪：开启后该 core 的每次 Tick 记录 Core::Tick（结束事件附带本帧 stream 字节数）、Core::DispatchCalls、
+// App::Tick 三个 zone，业务层可用 BRIDGE_TRACE_ZONE（bridge/runtime/trace.h）细分。
+// - 事件写入执行 Tick 的线程自己的无锁环形缓冲（满后覆盖最旧的事件）；未开启的 core 只多一次分支。
+// - 与 BridgeCore_PushCallCore（默认模式）相同：只能在 Tick 之外调用。
+BRIDGE_API BridgeResult BRIDGE_CALL BridgeCore_SetTraceEnabled(BridgeCore* core, uint32_t enabled);
+
+// 批量版本：对一批 core 同时开启/关闭（例如只追踪某一帧的某个批次）。
+BRIDGE_API BridgeResult BRIDGE_CALL BridgeCore_SetTraceEnabledMany(BridgeCore** cores, uint32_t count, uint32_t enabled);
+
+// 把所有线程缓冲中的事件写成 Chrome trace JSON（chrome://tracing / ui.perfetto.dev），path 为 UTF-8 文件路径。
+// 应在没有 Tick 进行时调用；不清空缓冲。
+BRIDGE_API BridgeResult BRIDGE_CALL Bridge_TraceDump(const char* path);
+
+// 丢弃已记录的事件。
+BRIDGE_API void BRIDGE_CALL Bridge_TraceClear(void);
+
+//------------------------------------------------------------------------------
+// Recording / Replay
+//------------------------------------------------------------------------------
+
+// 录制：开启后该 core 的每次 Tick 把 dt、本帧分发的 Host->Core 调用（BridgeCallCoreHeader + payload 序列）
+// 与本帧 command stream 追加到一个二进制文件，用于脱离线上环境复现与基准：
+// - 只回放 Host：把每帧 stream 交给 Host 的分发器（不运行 Core）。
+// - 只回放 Core：新建同配置的 core，逐帧 PushCallsCore(inbound) + Tick(dt)（不需要 Host）。
+//   从 core 创建后立即开始录制（header.start_tick == 0）时，回放产出的 stream 与录制逐帧一致。
+// - stream 中引用字符串的 BridgeStringView（StoreUtf8 的结果、BRIDGE_CMD_DEFINE_STRING）连同内容一起写入文件，
+//   打开录制时改写为映射内存中的地址，回放无需 Core 的字符串存储。
+// - 中途开始录制（start_tick > 0）时，core 此前已宣告的驻留字符串以 BRIDGE_CMD_DEFINE_STRING 补在第一帧 stream 的开头，
+//   只回放 Host 时每个 id 仍先宣告后引用。
+// - 录制在 Tick 线程上同步写文件（带缓冲），只用于采样/排查，不要对全部 core 长期开启。
+//
+// 文件格式（小端；所有记录 8 字节对齐）：
+//   BridgeRecordingHeader
+//   帧记录 * N：BridgeRecordedFrameHeader
+//              + inbound（inbound_len 字节）
+//              + stream（stream_len 字节；字符串 ptr 字段存放的是字符串内容相对文件起点的偏移）
+//              + relocs（reloc_count 个 uint32：stream 中字符串 ptr 字段的偏移；补齐到 8 字节）
+//              + 字符串内容（string_len 字节；补齐到 8 字节）
+
+#define BRIDGE_RECORDING_MAGIC 0x3143455245474442ull // "BDGEREC1"
+#define BRIDGE_RECORDING_FORMAT_VERSION 2
+
+typedef struct BridgeRecordingHeader
+{
+  uint64_t magic;
+  uint32_t format_version;
+  // 结束录制时回填；为 0 表示录制未正常结束（读取方按文件中完整的帧数计）。
+  uint32_t frame_count;
+  BridgeCoreConfig config;
+  // 开始录制时该 core 已完成的 Tick 数。
+  uint64_t start_tick;
+  BridgeVersion runtime_version;
+  // 预留字段（用于未来扩展），必须为 0。
+  uint32_t reserved0;
+} BridgeRecordingHeader;
+
+typedef struct BridgeRecordedFrameHeader
+{
+  // 整个帧记录的字节数（含本头与补齐）。
+  uint32_t size;
+  float dt;
+  uint32_t inbound_len;
+  uint32_t stream_len;
+  uint32_t reloc_count;
+  uint32_t string_len;
+} BridgeRecordedFrameHeader;
+
+// 开始录制到 path（UTF-8 文件路径，已存在则覆盖）。只能在 Tick 之外调用；已在录制时返回 BRIDGE_ERROR。
+BRIDGE_API BridgeResult BRIDGE_CALL BridgeCore_BeginRecording(BridgeCore* core, const char* path);
+
+// 结束录制并关闭文件（BridgeCore_Destroy 也会结束录制）。录制期间写入失败返回 BRIDGE_ERROR。
+BRIDGE_API BridgeResult BRIDGE_CALL BridgeCore_EndRecording(BridgeCore* core);
+
+// 只读打开的录制文件（整个文件以写时复制方式映射，帧数据在 Close 之前一直有效）。
+typedef struct BridgeRecording BridgeRecording;
+
+// 一帧回放数据：指针指向映射内存，直接可用（inbound 可交给 BridgeCore_PushCallsCore，stream 可交给 Host 分发）。
+typedef struct BridgeRecordedFrame
+{
+  float dt;
+  uint32_t reloc_count;
+  BridgeCallBuffer inbound;
+  BridgeCommandStream stream;
+  // stream 中字符串 ptr 字段的偏移（reloc_count 个；这些字段已改写为映射内存中的地址）。
+  const uint32_t* relocs;
+} BridgeRecordedFrame;
+
+// 打开失败（文件不存在、格式或版本不符、帧记录损坏）返回 null；末尾不完整的帧记录会被忽略。
+BRIDGE_API BridgeRecording* BRIDGE_CALL BridgeRecording_Open(const char* path);
+BRIDGE_API void BRIDGE_CALL BridgeRecording_Close(BridgeRecording* recording);
+
+// out_header 为文件头（frame_count 为实际可读的帧数）。
+BRIDGE_API BridgeResult BRIDGE_CALL BridgeRecording_GetHeader(const BridgeRecording* recording, BridgeRecordingHeader* out_header);
+
+BRIDGE_API BridgeResult BRIDGE_CALL BridgeRecording_GetFrame(
+  const BridgeRecording* recording,
+  uint32_t index,
+  BridgeRecordedFrame* out_frame);
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
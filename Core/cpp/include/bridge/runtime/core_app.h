@@ -2,10 +2,39 @@
 
 #include <bridge/bridge.h>
 
+#include <cstring>
+#include <memory>
+
 namespace bridge
 {
 	class CoreContext;
 
+	// 依次遍历一段 Host -> Core 调用（BridgeCallCoreHeader + 补齐到 8 字节的 payload），
+	// 对每条记录调用 fn(funcId, payload, payloadSize)。遇到截断的记录即停止。
+	template <class TFn>
+	inline void ForEachCallCore(const void* calls, uint32_t len, TFn&& fn)
+	{
+		const auto* cur = static_cast<const uint8_t*>(calls);
+		uint32_t remaining = cur ? len : 0;
+		while (remaining >= sizeof(BridgeCallCoreHeader))
+		{
+			BridgeCallCoreHeader hdr{};
+			std::memcpy(&hdr, cur, sizeof(hdr));
+			cur += sizeof(hdr);
+			remaining -= sizeof(hdr);
+
+			const uint32_t padded = (hdr.payload_size + 7u) & ~7u;
+			if (padded < hdr.payload_size || padded > remaining)
+			{
+				break;
+			}
+
+			fn(hdr.func_id, static_cast<const void*>(cur), hdr.payload_size);
+			cur += padded;
+			remaining -= padded;
+		}
+	}
+
 	// 可插拔的业务/玩法层（由业务库实现）。
 	//
 	// 说明：
@@ -16,5 +45,42 @@ namespace bridge
 		virtual ~ICoreApp() = default;
 		virtual void Tick(CoreContext& ctx, float dt) = 0;
 		virtual void OnCallCore(CoreContext& ctx, uint32_t funcId, const void* payload, uint32_t payloadSize) = 0;
+
+		// Runtime 每次把一整段待处理调用（已校验的 BridgeCallCoreHeader 序列）交给业务层。
+		// 默认实现逐条转发给 OnCallCore；继承 CoreAppBase 的 App 整段只经过这一次虚调用。
+		virtual void OnCallsCore(CoreContext& ctx, const void* calls, uint32_t len)
+		{
+			ForEachCallCore(calls, len, [&](uint32_t funcId, const void* payload, uint32_t payloadSize) {
+				OnCallCore(ctx, funcId, payload, payloadSize);
+			});
+		}
+
+		// 可选：复制当前全部业务状态，得到一个互不共享的新 App（BridgeCore_Clone 使用）。
+		// seed 为副本的 BridgeCoreConfig.seed：持有随机数状态的 App 应据此重新播种，让各副本之后的行为分开。
+		// 默认返回 null，表示不支持克隆。
+		virtual std::unique_ptr<ICoreApp> Clone(uint64_t seed) const
+		{
+			(void)seed;
+			return nullptr;
+		}
+	};
+
+	// CRTP 基类：把每条调用静态转发给 TDerived::DispatchCallCore(ctx, funcId, payload, payloadSize)，
+	// 后者通常串联各模块生成的 <module>::DispatchCoreCall(*this, ...)，由其 switch 到类型化的 OnXxx 处理函数。
+	template <class TDerived>
+	struct CoreAppBase : ICoreApp
+	{
+		void OnCallCore(CoreContext& ctx, uint32_t funcId, const void* payload, uint32_t payloadSize) override
+		{
+			static_cast<TDerived*>(this)->DispatchCallCore(ctx, funcId, payload, payloadSize);
+		}
+
+		void OnCallsCore(CoreContext& ctx, const void* calls, uint32_t len) override
+		{
+			auto* self = static_cast<TDerived*>(this);
+			ForEachCallCore(calls, len, [&](uint32_t funcId, const void* payload, uint32_t payloadSize) {
+				self->DispatchCallCore(ctx, funcId, payload, payloadSize);
+			});
+		}
 	};
 }
@@ -1,14 +1,42 @@
 #pragma once
 
 #include <bridge/bridge.h>
+#include <bridge/runtime/transform_store.h>
 
+#include <cstddef>
 #include <cstdint>
-#include <string>
+#include <cstring>
+#include <new>
+#include <string_view>
+#include <type_traits>
 
 struct BridgeCore;
 
 namespace bridge
 {
+	// command stream 自有缓冲的写入状态（Runtime 内部维护，业务层不要直接读写）。
+	// 放在公开头文件中，是为了让 CoreContext::Emplace 的常见情况内联完成：一次容量检查 + 直接写入。
+	struct CommandCursor
+	{
+		uint8_t* data = nullptr;
+		size_t size = 0;
+		size_t capacity = 0;
+
+		// stream 末尾的 host 调用（偏移相对本帧切片起点）：last_call_end == size 时，
+		// 下一条同函数、同 stride 的调用要并入它（批量命令，走 Runtime 的慢路径）。
+		bool has_last_call = false;
+		// 末尾调用是一条单独的合并调用（并入批量时要修正合并索引）。
+		bool last_call_coalesced = false;
+		uint32_t last_call_offset = 0;
+		uint32_t last_call_end = 0;
+		uint32_t last_call_func = 0;
+		uint32_t last_call_stride = 0;
+
+		// 本帧写入自有缓冲（不是 core group 的 arena）。
+		bool direct = true;
+		bool dense_opcodes = false;
+	};
+
 	// 业务层在 Tick/事件回调中使用的上下文对象（由 Runtime 创建并传入）。
 	//
 	// 该类型属于 C++ 侧“业务/Runtime 接口”，不属于对外 C ABI（bridge.h）。
@@ -20,15 +48,170 @@ namespace bridge
 		const BridgeCoreConfig& Config() const;
 		uint64_t AllocRequestId();
 
-		BridgeStringView StoreUtf8(std::string utf8);
+		// 把 UTF-8 字节复制进本帧的字符串 arena（稳态下零堆分配），返回的 view 在下一次 Tick 前有效。
+		BridgeStringView StoreUtf8(std::string_view utf8);
+
+		// 驻留字符串：返回跨 Tick 稳定的 id（空串返回 0）。本 core 首次使用时会自动写入一条
+		// BRIDGE_CMD_DEFINE_STRING 宣告内容，之后只需在 payload 中携带 id。
+		BridgeStringId InternUtf8(std::string_view utf8);
+
+		// 跨 core 共享的资源请求（见 bridge.h 的 BridgeAssetCache）：返回 true 时调用方照常向 Host 发出请求
+		// （本 core 未挂缓存，或是该 key 的第一个请求者）；返回 false 时不要再发，结果会在之后的 Tick 中
+		// 作为 Host->Core 的“加载完成”调用送达，request_id 为这里传入的 requestId。
+		bool RequestSharedAsset(BridgeAssetType assetType, std::string_view key, uint64_t requestId);
 
 		// 向 Host 发起一次“函数调用”（具体 func_id 与 payload 结构由代码生成定义）。
-		// payload 会被复制进 command stream，且 header.size 按 8 字节补齐。
+		// payload 会被复制进 command stream，且按 8 字节补齐。
+		// 紧邻的同一 funcId、同一 payload 大小的调用会被 Runtime 合并为一条 BRIDGE_CMD_CALL_HOST_BATCH。
 		void CallHost(uint32_t funcId, const void* payload, uint32_t payloadSize);
 
+		// “最后写入者生效”的 Host 调用（.def 中以 BRIDGE_HOST_API_COALESCE 声明）：
+		// 本帧内若 key 上最近一次合并调用是同一个 funcId，且此后只追加过合并调用，则原地覆盖那条调用
+		// （保留其在 stream 中的位置），否则照常追加。中间夹着其它命令（例如 DestroyEntity / SpawnEntity、
+		// 非合并调用或字符串宣告）时不会覆盖它之前的调用，因此新值不会跑到这些命令前面。
+		void CallHostCoalesced(uint32_t funcId, uint64_t key, const void* payload, uint32_t payloadSize);
+
+		// 编译期定长的 CallHost（生成代码使用）：在 command stream 中就地构造一次调用，返回 payload 指针，
+		// 调用方直接写字段即可。payload 的补齐大小在编译期确定；新分配的字节保证为 0（含补齐与结构体内部空洞）。
+		// 返回的指针只在下一次向本 core 写入命令之前有效。
+		// opcode 为 BridgeGen 分配的稠密 opcode：core 打开 BRIDGE_CORE_FLAG_DENSE_OPCODES 时按 BridgeCmdCallOp 写出。
+		// 常见情况（缓冲有余量、不并入前一条命令）在这里内联完成；扩容、并入批量与 group arena 走 Runtime。
+		template <class TArgs>
+		TArgs* Emplace(uint32_t funcId, uint16_t opcode = 0)
+		{
+			constexpr uint32_t stride = PayloadStride<TArgs>();
+			uint8_t* payload = TryAppendCall(funcId, stride, opcode);
+			if (!payload)
+			{
+				payload = AllocateCall(funcId, stride, opcode);
+			}
+			// 逐字段写入之前清零：stride 在这里是编译期常量，清零展开为几次定长写入。
+			std::memset(payload, 0, stride);
+			return ::new (payload) TArgs;
+		}
+
+		// Emplace 的合并版本（语义同 CallHostCoalesced）。覆盖时返回的是旧调用的 payload，调用方需写全所有字段。
+		template <class TArgs>
+		TArgs* EmplaceCoalesced(uint32_t funcId, uint64_t key, uint16_t opcode = 0)
+		{
+			constexpr uint32_t stride = PayloadStride<TArgs>();
+			uint8_t* payload = AllocateCallCoalesced(funcId, key, stride, opcode);
+			std::memset(payload, 0, stride);
+			return ::new (payload) TArgs;
+		}
+
 		static BridgeTransform IdentityTransform();
 
+		// 本 core 的 Transform 组件存储（见 bridge/runtime/transform_store.h）：本帧写入的变化在 Tick 结束前自动输出。
+		TransformStore& Transforms();
+
+		// 本 core 的追踪 id（见 bridge/runtime/trace.h）；未开启追踪时为 0。通常经 BRIDGE_TRACE_ZONE 使用。
+		uint32_t TraceId() const { return trace_id_; }
+
 	private:
+		template <class TArgs>
+		static constexpr uint32_t PayloadStride()
+		{
+			static_assert(std::is_trivially_copyable<TArgs>::value, "Payload must be trivially copyable");
+			static_assert(std::is_standard_layout<TArgs>::value, "Payload must be standard layout");
+			static_assert(alignof(TArgs) <= 8, "Payload alignment must not exceed 8");
+
+			constexpr uint32_t stride = (static_cast<uint32_t>(sizeof(TArgs)) + 7u) & ~7u;
+			static_assert(sizeof(BridgeCmdCallHost) + stride <= UINT16_MAX, "Payload too large for header.size");
+			return stride;
+		}
+
+		// 内联快路径：自有缓冲放得下时，直接追加一条单次调用，或把调用追加到末尾已有的同函数批量命令
+		// （BRIDGE_CMD_CALL_HOST_BATCH / BridgeCmdCallOp），返回 payload（未初始化）。
+		// 单条调用升级为批量（要挪动 payload）、扩容与 group arena 返回 nullptr，由 AllocateCall 处理；
+		// 统计版本（BRIDGE_ENABLE_STATS）总是走 AllocateCall 计数。
+		uint8_t* TryAppendCall(uint32_t funcId, uint32_t stride, uint16_t opcode)
+		{
+#if BRIDGE_ENABLE_STATS
+			(void)funcId;
+			(void)stride;
+			(void)opcode;
+			return nullptr;
+#else
+			static_assert(sizeof(BridgeCmdCallOp) == sizeof(BridgeCmdCallHost), "Single call headers must have the same size");
+			CommandCursor& c = *cursor_;
+			if (!c.direct)
+			{
+				return nullptr;
+			}
+
+			const bool op = c.dense_opcodes && opcode >= BRIDGE_CMD_OPCODE_BASE;
+			const bool joins = c.has_last_call && c.last_call_end == c.size &&
+				c.last_call_func == funcId && c.last_call_stride == stride;
+			if (joins)
+			{
+				uint8_t* cmd = c.data + c.last_call_offset;
+				BridgeCommandHeader header{};
+				std::memcpy(&header, cmd, sizeof(header));
+				const bool grows = op ? header.type == opcode : header.type == BRIDGE_CMD_CALL_HOST_BATCH;
+				if (!grows || header.size + stride > UINT16_MAX || c.capacity - c.size < stride)
+				{
+					return nullptr;
+				}
+
+				// 两种批量命令的 count 都紧跟在 header（及 CALL_HOST_BATCH 的 func_id）之后。
+				const size_t countOffset = op ? offsetof(BridgeCmdCallOp, count) : offsetof(BridgeCmdCallHostBatch, count);
+				uint32_t count = 0;
+				std::memcpy(&count, cmd + countOffset, sizeof(count));
+				count++;
+				std::memcpy(cmd + countOffset, &count, sizeof(count));
+
+				uint8_t* payload = cmd + header.size;
+				header.size = static_cast<uint16_t>(header.size + stride);
+				std::memcpy(cmd, &header, sizeof(header));
+
+				c.last_call_coalesced = false;
+				c.size += stride;
+				c.last_call_end = static_cast<uint32_t>(c.size);
+				return payload;
+			}
+
+			const uint32_t size = static_cast<uint32_t>(sizeof(BridgeCmdCallHost)) + stride;
+			if (c.capacity - c.size < size)
+			{
+				return nullptr;
+			}
+
+			uint8_t* cmd = c.data + c.size;
+			if (op)
+			{
+				BridgeCmdCallOp single{};
+				single.header.type = opcode;
+				single.header.size = static_cast<uint16_t>(size);
+				single.count = 1;
+				std::memcpy(cmd, &single, sizeof(single));
+			}
+			else
+			{
+				BridgeCmdCallHost single{};
+				single.header.type = BRIDGE_CMD_CALL_HOST;
+				single.header.size = static_cast<uint16_t>(size);
+				single.func_id = funcId;
+				std::memcpy(cmd, &single, sizeof(single));
+			}
+
+			c.has_last_call = true;
+			c.last_call_coalesced = false;
+			c.last_call_offset = static_cast<uint32_t>(c.size);
+			c.size += size;
+			c.last_call_end = static_cast<uint32_t>(c.size);
+			c.last_call_func = funcId;
+			c.last_call_stride = stride;
+			return cmd + sizeof(BridgeCmdCallHost);
+#endif
+		}
+
+		// 在 stream 末尾分配一次调用的 payload（stride 字节、未初始化），必要时并入前一条同函数命令。
+		uint8_t* AllocateCall(uint32_t funcId, uint32_t stride, uint16_t opcode);
+		uint8_t* AllocateCallCoalesced(uint32_t funcId, uint64_t key, uint32_t stride, uint16_t opcode);
+
 		BridgeCore& core_;
+		CommandCursor* cursor_;
+		uint32_t trace_id_ = 0;
 	};
 }
@@ -3,11 +3,17 @@
 #include <bridge/runtime/core_app.h>
 
 #include <memory>
+#include <span>
 
 namespace bridge
 {
 	// 业务层入口：由最终链接产物（业务库/插件）提供实现。
 	// Runtime 在 BridgeCore_Create 时调用该函数创建 ICoreApp。
 	std::unique_ptr<ICoreApp> CreateGameApp();
+
+	// 可选：登记业务层绑定所用的 Host opcode 表（BridgeGen 生成的 bridge_host_opcodes.generated.h），
+	// 由 Bridge_GetHostOpcodes 原样返回给 Host 握手。需在握手之前调用（通常放在业务库的静态初始化里），
+	// table 须在整个进程生命周期内有效。未登记时返回空表，Host 比对失败，不会打开 DenseOpcodes。
+	void SetGameHostOpcodes(std::span<const BridgeHostOpcode> table);
 }
 
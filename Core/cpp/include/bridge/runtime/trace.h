@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+
+namespace bridge
+{
+	// 帧追踪（BridgeCore_SetTraceEnabled 按 core 开启，Bridge_TraceDump 导出 Chrome/Perfetto JSON）。
+	//
+	// - 每个线程一个无锁环形缓冲（只有本线程写入），记录带时间戳的 zone 开始/结束事件；写满后覆盖最旧的事件。
+	// - traceId 为 0 表示该 core 未开启追踪：TraceZone 只剩一次分支，不读时钟、不写缓冲。
+	// - zone 名必须是静态存储期的字符串（通常是字面量），缓冲中只保存指针。
+	//
+	// 业务层在 Tick / OnXxx 中使用：
+	//   BRIDGE_TRACE_ZONE(ctx, "MyApp::UpdateAI");
+	void TraceBegin(const char* name, uint32_t traceId);
+	// value 会作为 args.value 写入导出的结束事件（例如本帧 stream 字节数），0 表示不附带。
+	void TraceEnd(const char* name, uint32_t traceId, uint32_t value = 0);
+
+	class TraceZone
+	{
+	public:
+		TraceZone(uint32_t traceId, const char* name)
+			: name_(name), trace_id_(traceId)
+		{
+			if (trace_id_ != 0)
+			{
+				TraceBegin(name_, trace_id_);
+			}
+		}
+
+		~TraceZone()
+		{
+			if (trace_id_ != 0)
+			{
+				TraceEnd(name_, trace_id_);
+			}
+		}
+
+		TraceZone(const TraceZone&) = delete;
+		TraceZone& operator=(const TraceZone&) = delete;
+
+	private:
+		const char* name_;
+		uint32_t trace_id_;
+	};
+}
+
+#define BRIDGE_TRACE_CONCAT_INNER(a, b) a##b
+#define BRIDGE_TRACE_CONCAT(a, b) BRIDGE_TRACE_CONCAT_INNER(a, b)
+
+// 作用域 zone：ctx 为 bridge::CoreContext（追踪是否开启由 ctx 所属的 core 决定）。
+#define BRIDGE_TRACE_ZONE(ctx, name) \
+	::bridge::TraceZone BRIDGE_TRACE_CONCAT(bridge_trace_zone_, __LINE__)((ctx).TraceId(), name)
@@ -0,0 +1,173 @@
+#pragma once
+
+#include <bridge/bridge.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace bridge
+{
+	class CoreContext;
+
+	// SetTransform 的 mask 位（与 Host 侧 ApplyTransform 的约定一致）。
+	enum TransformMask : uint32_t
+	{
+		kTransformPosition = 1u << 0,
+		kTransformRotation = 1u << 1,
+		kTransformScale = 1u << 2,
+		kTransformAll = kTransformPosition | kTransformRotation | kTransformScale,
+	};
+
+	// 实体句柄：低 32 位为槽位下标，高 32 位为槽位的代数（销毁后递增，旧句柄随之失效）；0 为无效句柄。
+	using TransformHandle = uint64_t;
+
+	// 每个 core 一份的 Transform 组件存储（CoreContext::Transforms()）：业务层只写最新的位置/旋转/缩放，
+	// Runtime 在 Tick 末尾统一输出本帧变化过的实体。
+	//
+	// - 按分量 SoA 存放，槽位连续复用（空闲链表）；每个槽位记录按分量的脏位，另有一层 64 槽一字的脏位图与脏字列表，
+	//   没有变化的实体在输出时完全不被访问。
+	// - 写入与原值相同时不置脏位，因此静止的实体不产生命令。
+	// - Flush 按槽位顺序走一遍脏实体：只有位置变了时输出 SetPosition，否则输出带 mask 的 SetTransform。
+	//   具体的 Host 函数由业务层用 BindCommands 绑定（通常转发给生成的 <module>::SetPosition / SetTransform）。
+	// - Create 的初始值不置脏位：它应由创建实体的命令（例如 SpawnEntity）一并带给 Host。
+	class TransformStore
+	{
+	public:
+		using EmitPositionFn = void (*)(CoreContext& ctx, uint64_t entityId, const BridgeVec3& position);
+		using EmitTransformFn = void (*)(CoreContext& ctx, uint64_t entityId, uint32_t mask, const BridgeTransform& transform);
+
+		// 未绑定时 Flush 只清除脏位，不输出命令。
+		void BindCommands(EmitPositionFn emitPosition, EmitTransformFn emitTransform)
+		{
+			emit_position_ = emitPosition;
+			emit_transform_ = emitTransform;
+		}
+
+		// entityId 为命令中携带的 Host 侧实体 id。
+		TransformHandle Create(uint64_t entityId, const BridgeTransform& initial);
+		// 销毁后本帧尚未输出的变化被丢弃；无效句柄忽略。
+		void Destroy(TransformHandle handle);
+		// 销毁全部实体（保留容量与 BindCommands 的绑定）。
+		void Clear();
+
+		bool IsAlive(TransformHandle handle) const { return Slot(handle) != kNoSlot; }
+		uint32_t Count() const { return static_cast<uint32_t>(generations_.size() - free_slots_.size()); }
+
+		// 以下写入对无效句柄为空操作，读取返回零值。
+		void SetPosition(TransformHandle handle, const BridgeVec3& position)
+		{
+			const uint32_t slot = Slot(handle);
+			if (slot != kNoSlot && !SameVec3(positions_[slot], position))
+			{
+				positions_[slot] = Vec3(position);
+				MarkDirty(slot, kTransformPosition);
+			}
+		}
+
+		void SetRotation(TransformHandle handle, const BridgeQuat& rotation)
+		{
+			const uint32_t slot = Slot(handle);
+			if (slot != kNoSlot && !SameQuat(rotations_[slot], rotation))
+			{
+				rotations_[slot] = rotation;
+				MarkDirty(slot, kTransformRotation);
+			}
+		}
+
+		void SetScale(TransformHandle handle, const BridgeVec3& scale)
+		{
+			const uint32_t slot = Slot(handle);
+			if (slot != kNoSlot && !SameVec3(scales_[slot], scale))
+			{
+				scales_[slot] = Vec3(scale);
+				MarkDirty(slot, kTransformScale);
+			}
+		}
+
+		void SetTransform(TransformHandle handle, const BridgeTransform& transform)
+		{
+			SetPosition(handle, transform.position);
+			SetRotation(handle, transform.rotation);
+			SetScale(handle, transform.scale);
+		}
+
+		BridgeVec3 Position(TransformHandle handle) const
+		{
+			const uint32_t slot = Slot(handle);
+			return slot != kNoSlot ? positions_[slot] : BridgeVec3{};
+		}
+
+		BridgeQuat Rotation(TransformHandle handle) const
+		{
+			const uint32_t slot = Slot(handle);
+			return slot != kNoSlot ? rotations_[slot] : BridgeQuat{};
+		}
+
+		BridgeVec3 Scale(TransformHandle handle) const
+		{
+			const uint32_t slot = Slot(handle);
+			return slot != kNoSlot ? scales_[slot] : BridgeVec3{};
+		}
+
+		bool HasDirty() const { return !dirty_words_.empty(); }
+
+		// Runtime 在业务层 Tick 之后调用：输出全部脏实体并清除脏位。
+		void Flush(CoreContext& ctx);
+
+	private:
+		static constexpr uint32_t kNoSlot = UINT32_MAX;
+
+		uint32_t Slot(TransformHandle handle) const
+		{
+			const auto slot = static_cast<uint32_t>(handle);
+			const auto generation = static_cast<uint32_t>(handle >> 32);
+			return slot < generations_.size() && generations_[slot] == generation && generation != 0 ? slot : kNoSlot;
+		}
+
+		void MarkDirty(uint32_t slot, uint32_t bit)
+		{
+			if (dirty_mask_[slot] == 0)
+			{
+				uint64_t& word = dirty_bits_[slot >> 6];
+				if (word == 0)
+				{
+					dirty_words_.push_back(slot >> 6);
+				}
+				word |= uint64_t{1} << (slot & 63u);
+			}
+			dirty_mask_[slot] |= static_cast<uint8_t>(bit);
+		}
+
+		static BridgeVec3 Vec3(const BridgeVec3& v)
+		{
+			return BridgeVec3{v.x, v.y, v.z, 0.0f};
+		}
+
+		static bool SameVec3(const BridgeVec3& a, const BridgeVec3& b)
+		{
+			return a.x == b.x && a.y == b.y && a.z == b.z;
+		}
+
+		static bool SameQuat(const BridgeQuat& a, const BridgeQuat& b)
+		{
+			return a.x == b.x && a.y == b.y && a.z == b.z && a.w == b.w;
+		}
+
+		// 按槽位的分量（SoA）。
+		std::vector<BridgeVec3> positions_;
+		std::vector<BridgeQuat> rotations_;
+		std::vector<BridgeVec3> scales_;
+		std::vector<uint64_t> entity_ids_;
+		// 槽位代数：Destroy 时递增（跳过 0），复用的槽位以新的代数发放句柄。
+		std::vector<uint32_t> generations_;
+		std::vector<uint32_t> free_slots_;
+
+		// 脏位：每槽一个 TransformMask；dirty_bits_ 每位对应一个槽位，dirty_words_ 记录本帧变为非零的字。
+		std::vector<uint8_t> dirty_mask_;
+		std::vector<uint64_t> dirty_bits_;
+		std::vector<uint32_t> dirty_words_;
+
+		EmitPositionFn emit_position_ = nullptr;
+		EmitTransformFn emit_transform_ = nullptr;
+	};
+}
@@ -1,6 +1,9 @@
 #include <bridge/bridge.h>
 
+#include "../core/asset_cache.h"
+#include "../core/core_group.h"
 #include "../core/core_instance.h"
+#include "../core/tick_scheduler.h"
 
 //------------------------------------------------------------------------------
 // C ABI 实现（绑定层）
@@ -14,6 +17,11 @@ BridgeVersion BRIDGE_CALL Bridge_GetVersion(void)
 	return bridge::GetVersion();
 }
 
+BridgeResult BRIDGE_CALL Bridge_GetHostOpcodes(const BridgeHostOpcode** out_entries, uint32_t* out_count)
+{
+	return bridge::GetHostOpcodes(out_entries, out_count);
+}
+
 BridgeCore* BRIDGE_CALL BridgeCore_Create(BridgeCoreConfig config)
 {
 	return bridge::CreateCore(config);
@@ -24,6 +32,50 @@ void BRIDGE_CALL BridgeCore_Destroy(BridgeCore* core)
 	bridge::DestroyCore(core);
 }
 
+BridgeResult BRIDGE_CALL BridgeCore_CreateMany(
+	const BridgeCoreConfig* configs,
+	uint32_t count,
+	BridgeCore** out_cores)
+{
+	if (!configs || count == 0 || !out_cores)
+	{
+		return BRIDGE_INVALID_ARGUMENT;
+	}
+	return bridge::CreateCores(configs, count, out_cores);
+}
+
+BridgeCore* BRIDGE_CALL BridgeCore_Clone(const BridgeCore* source, uint64_t seed)
+{
+	if (!source)
+	{
+		return nullptr;
+	}
+	BridgeCore* core = nullptr;
+	return bridge::CloneCores(*source, &seed, 1, &core) == BRIDGE_OK ? core : nullptr;
+}
+
+BridgeResult BRIDGE_CALL BridgeCore_CloneMany(
+	const BridgeCore* source,
+	const uint64_t* seeds,
+	uint32_t count,
+	BridgeCore** out_cores)
+{
+	if (!source || !seeds || count == 0 || !out_cores)
+	{
+		return BRIDGE_INVALID_ARGUMENT;
+	}
+	return bridge::CloneCores(*source, seeds, count, out_cores);
+}
+
+BridgeResult BRIDGE_CALL BridgeCore_Reset(BridgeCore* core, BridgeCoreConfig config)
+{
+	if (!core)
+	{
+		return BRIDGE_INVALID_ARGUMENT;
+	}
+	return bridge::ResetCore(*core, config);
+}
+
 void BRIDGE_CALL BridgeCore_Tick(BridgeCore* core, float dt)
 {
 	if (!core)
@@ -43,12 +95,26 @@ BridgeResult BRIDGE_CALL BridgeCore_TickAndGetCommandStream(
 	{
 		return BRIDGE_INVALID_ARGUMENT;
 	}
-	bridge::Tick(*core, dt);
-	*out_ptr = core->commands.Data();
-	*out_len = core->commands.Size();
+	if (!bridge::Tick(*core, dt))
+	{
+		*out_ptr = nullptr;
+		*out_len = 0;
+		return BRIDGE_ERROR;
+	}
+	*out_ptr = core->Commands().Data();
+	*out_len = core->Commands().Size();
 	return BRIDGE_OK;
 }
 
+BridgeResult BRIDGE_CALL BridgeCore_ReleaseStream(BridgeCore* core)
+{
+	if (!core)
+	{
+		return BRIDGE_INVALID_ARGUMENT;
+	}
+	return bridge::ReleaseStream(*core);
+}
+
 BridgeResult BRIDGE_CALL BridgeCore_TickManyAndGetCommandStreams(
 	BridgeCore** cores,
 	uint32_t count,
@@ -60,22 +126,90 @@ BridgeResult BRIDGE_CALL BridgeCore_TickManyAndGetCommandStreams(
 		return BRIDGE_INVALID_ARGUMENT;
 	}
 
-	for (uint32_t i = 0; i < count; i++)
+	return bridge::TickMany(cores, count, dt, out_streams);
+}
+
+BridgeResult BRIDGE_CALL BridgeCore_TickManyBegin(
+	BridgeCore** cores,
+	uint32_t count,
+	float dt,
+	BridgeCommandStream* out_streams)
+{
+	if (!cores || count == 0 || !out_streams)
 	{
-		auto* core = cores[i];
-		if (!core)
-		{
-			out_streams[i].ptr = nullptr;
-			out_streams[i].len = 0;
-			out_streams[i].reserved0 = 0;
-			continue;
-		}
+		return BRIDGE_INVALID_ARGUMENT;
+	}
+	return bridge::TickManyBegin(cores, count, dt, out_streams);
+}
 
-		bridge::Tick(*core, dt);
-		out_streams[i].ptr = core->commands.Data();
-		out_streams[i].len = core->commands.Size();
-		out_streams[i].reserved0 = 0;
+BridgeResult BRIDGE_CALL BridgeCore_PollCompletedShards(
+	BridgeTickShard* out_shards,
+	uint32_t capacity,
+	uint32_t* out_count,
+	uint32_t* out_remaining)
+{
+	if (!out_shards || capacity == 0 || !out_count || !out_remaining)
+	{
+		return BRIDGE_INVALID_ARGUMENT;
 	}
+	bridge::PollCompletedShards(out_shards, capacity, out_count, out_remaining);
+	return BRIDGE_OK;
+}
+
+BridgeResult BRIDGE_CALL BridgeCore_SetTickWorkerCount(uint32_t worker_count)
+{
+	return bridge::SetTickWorkerCount(worker_count);
+}
+
+BridgeCoreGroup* BRIDGE_CALL BridgeCoreGroup_Create(void)
+{
+	return bridge::CreateCoreGroup();
+}
+
+void BRIDGE_CALL BridgeCoreGroup_Destroy(BridgeCoreGroup* group)
+{
+	bridge::DestroyCoreGroup(group);
+}
+
+BridgeResult BRIDGE_CALL BridgeCoreGroup_TickManyAndGetCommandStreams(
+	BridgeCoreGroup* group,
+	BridgeCore** cores,
+	uint32_t count,
+	float dt,
+	BridgeCommandStream* out_streams)
+{
+	if (!group || !cores || count == 0 || !out_streams)
+	{
+		return BRIDGE_INVALID_ARGUMENT;
+	}
+	return bridge::TickMany(cores, count, dt, out_streams, group);
+}
+
+BridgeTickScheduler* BRIDGE_CALL BridgeTickScheduler_Create(void)
+{
+	return bridge::CreateTickScheduler();
+}
+
+void BRIDGE_CALL BridgeTickScheduler_Destroy(BridgeTickScheduler* scheduler)
+{
+	bridge::DestroyTickScheduler(scheduler);
+}
+
+BridgeResult BRIDGE_CALL BridgeTickScheduler_TickManyAndGetCommandStreams(
+	BridgeTickScheduler* scheduler,
+	BridgeCore** cores,
+	uint32_t count,
+	float dt,
+	uint64_t budget_ns,
+	BridgeCommandStream* out_streams,
+	float* out_dts,
+	BridgeTickBudgetResult* out_result)
+{
+	if (!scheduler || !cores || count == 0 || !out_streams)
+	{
+		return BRIDGE_INVALID_ARGUMENT;
+	}
+	bridge::TickManyWithBudget(*scheduler, cores, count, dt, budget_ns, out_streams, out_dts, out_result);
 	return BRIDGE_OK;
 }
 
@@ -88,8 +222,8 @@ BridgeResult BRIDGE_CALL BridgeCore_GetCommandStream(
 	{
 		return BRIDGE_INVALID_ARGUMENT;
 	}
-	*out_ptr = core->commands.Data();
-	*out_len = core->commands.Size();
+	*out_ptr = core->Commands().Data();
+	*out_len = core->Commands().Size();
 	return BRIDGE_OK;
 }
 
@@ -105,3 +239,217 @@ BridgeResult BRIDGE_CALL BridgeCore_PushCallCore(
 	}
 	return bridge::PushCallCore(*core, func_id, payload, payload_size);
 }
+
+BridgeResult BRIDGE_CALL BridgeCore_PushCallsCore(
+	BridgeCore* core,
+	const void* calls,
+	uint32_t len)
+{
+	if (!core)
+	{
+		return BRIDGE_INVALID_ARGUMENT;
+	}
+	return bridge::PushCallsCore(*core, calls, len);
+}
+
+BridgeResult BRIDGE_CALL BridgeCore_PushCallsMany(
+	BridgeCore** cores,
+	const BridgeCallBuffer* buffers,
+	uint32_t count)
+{
+	if (count > 0 && (!cores || !buffers))
+	{
+		return BRIDGE_INVALID_ARGUMENT;
+	}
+	return bridge::PushCallsMany(cores, buffers, count);
+}
+
+BridgeResult BRIDGE_CALL BridgeCore_AcquireCallBuffer(
+	BridgeCore* core,
+	uint32_t bytes,
+	void** out_ptr)
+{
+	if (out_ptr)
+	{
+		*out_ptr = nullptr;
+	}
+	if (!core || !out_ptr || bytes == 0)
+	{
+		return BRIDGE_INVALID_ARGUMENT;
+	}
+	return bridge::AcquireCallBuffer(*core, bytes, out_ptr);
+}
+
+BridgeResult BRIDGE_CALL BridgeCore_CommitCalls(
+	BridgeCore* core,
+	uint32_t bytes_written)
+{
+	if (!core)
+	{
+		return BRIDGE_INVALID_ARGUMENT;
+	}
+	return bridge::CommitCalls(*core, bytes_written);
+}
+
+BridgeAssetCache* BRIDGE_CALL BridgeAssetCache_Create(BridgeAssetCacheConfig config)
+{
+	return bridge::CreateAssetCache(config);
+}
+
+void BRIDGE_CALL BridgeAssetCache_Destroy(BridgeAssetCache* cache)
+{
+	bridge::DestroyAssetCache(cache);
+}
+
+BridgeResult BRIDGE_CALL BridgeCore_SetAssetCache(BridgeCore** cores, uint32_t count, BridgeAssetCache* cache)
+{
+	if (!cores || count == 0)
+	{
+		return BRIDGE_INVALID_ARGUMENT;
+	}
+	bridge::SetAssetCache(cores, count, cache);
+	return BRIDGE_OK;
+}
+
+BridgeResult BRIDGE_CALL BridgeAssetCache_GetStats(BridgeAssetCache* cache, BridgeAssetCacheStats* out_stats)
+{
+	if (!cache || !out_stats)
+	{
+		return BRIDGE_INVALID_ARGUMENT;
+	}
+	bridge::GetAssetCacheStats(*cache, out_stats);
+	return BRIDGE_OK;
+}
+
+BridgeResult BRIDGE_CALL BridgeCore_GetStats(const BridgeCore* core, BridgeCoreStats* out_stats)
+{
+	if (!core)
+	{
+		return BRIDGE_INVALID_ARGUMENT;
+	}
+	return bridge::GetStats(*core, out_stats);
+}
+
+BridgeResult BRIDGE_CALL BridgeCore_GetStatsMany(
+	BridgeCore** cores,
+	uint32_t count,
+	BridgeCoreStats* out_per_core,
+	BridgeCoreStats* out_total)
+{
+	if (count > 0 && !cores)
+	{
+		return BRIDGE_INVALID_ARGUMENT;
+	}
+	return bridge::GetStatsMany(cores, count, out_per_core, out_total);
+}
+
+BridgeResult BRIDGE_CALL BridgeCore_GetFuncStats(
+	const BridgeCore* core,
+	BridgeFuncStats* out_entries,
+	uint32_t capacity,
+	uint32_t* out_count)
+{
+	if (!core)
+	{
+		return BRIDGE_INVALID_ARGUMENT;
+	}
+	return bridge::GetFuncStats(*core, out_entries, capacity, out_count);
+}
+
+BridgeResult BRIDGE_CALL BridgeCore_ResetStats(BridgeCore* core)
+{
+	if (!core)
+	{
+		return BRIDGE_INVALID_ARGUMENT;
+	}
+	return bridge::ResetStats(*core);
+}
+
+BridgeResult BRIDGE_CALL BridgeCore_SetTraceEnabled(BridgeCore* core, uint32_t enabled)
+{
+	if (!core)
+	{
+		return BRIDGE_INVALID_ARGUMENT;
+	}
+	bridge::SetTraceEnabled(&core, 1, enabled != 0);
+	return BRIDGE_OK;
+}
+
+BridgeResult BRIDGE_CALL BridgeCore_SetTraceEnabledMany(BridgeCore** cores, uint32_t count, uint32_t enabled)
+{
+	if (count > 0 && !cores)
+	{
+		return BRIDGE_INVALID_ARGUMENT;
+	}
+	bridge::SetTraceEnabled(cores, count, enabled != 0);
+	return BRIDGE_OK;
+}
+
+BridgeResult BRIDGE_CALL Bridge_TraceDump(const char* path)
+{
+	if (!path || !*path)
+	{
+		return BRIDGE_INVALID_ARGUMENT;
+	}
+	return bridge::DumpTrace(path) ? BRIDGE_OK : BRIDGE_ERROR;
+}
+
+void BRIDGE_CALL Bridge_TraceClear(void)
+{
+	bridge::ClearTrace();
+}
+
+BridgeResult BRIDGE_CALL BridgeCore_BeginRecording(BridgeCore* core, const char* path)
+{
+	if (!core || !path || !*path)
+	{
+		return BRIDGE_INVALID_ARGUMENT;
+	}
+	return bridge::BeginRecording(*core, path);
+}
+
+BridgeResult BRIDGE_CALL BridgeCore_EndRecording(BridgeCore* core)
+{
+	if (!core)
+	{
+		return BRIDGE_INVALID_ARGUMENT;
+	}
+	return bridge::EndRecording(*core);
+}
+
+BridgeRecording* BRIDGE_CALL BridgeRecording_Open(const char* path)
+{
+	if (!path || !*path)
+	{
+		return nullptr;
+	}
+	return bridge::OpenRecording(path);
+}
+
+void BRIDGE_CALL BridgeRecording_Close(BridgeRecording* recording)
+{
+	bridge::CloseRecording(recording);
+}
+
+BridgeResult BRIDGE_CALL BridgeRecording_GetHeader(const BridgeRecording* recording, BridgeRecordingHeader* out_header)
+{
+	if (!recording || !out_header)
+	{
+		return BRIDGE_INVALID_ARGUMENT;
+	}
+	*out_header = recording->header;
+	return BRIDGE_OK;
+}
+
+BridgeResult BRIDGE_CALL BridgeRecording_GetFrame(
+	const BridgeRecording* recording,
+	uint32_t index,
+	BridgeRecordedFrame* out_frame)
+{
+	if (!recording || !out_frame || index >= recording->frames.size())
+	{
+		return BRIDGE_INVALID_ARGUMENT;
+	}
+	*out_frame = recording->frames[index];
+	return BRIDGE_OK;
+}
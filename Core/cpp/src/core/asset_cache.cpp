@@ -0,0 +1,210 @@
+#include "asset_cache.h"
+
+#include <bridge/runtime/core_app.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+	// 缓存 key：asset_type（4 字节）+ key 的 UTF-8 字节；不同类型的同名资源互不命中。
+	static void EncodeKey(std::string& out, BridgeAssetType assetType, std::string_view key)
+	{
+		const uint32_t type = static_cast<uint32_t>(assetType);
+		out.assign(reinterpret_cast<const char*>(&type), sizeof(type));
+		out.append(key);
+	}
+
+	// 把 asset 移出 entries（之后的请求重新发给 Host）；已挂着的 core 仍持有它，放进 retired。调用方持有 mutex。
+	static void Unpublish(BridgeAssetCache& cache, bridge::SharedAsset* asset)
+	{
+		const auto it = cache.entries.find(asset->key);
+		if (it != cache.entries.end() && it->second.get() == asset)
+		{
+			cache.retired.push_back(std::move(it->second));
+			cache.entries.erase(it);
+		}
+	}
+}
+
+namespace bridge
+{
+	BridgeAssetCache* CreateAssetCache(const BridgeAssetCacheConfig& config)
+	{
+		if (config.reserved0 != 0 || config.status_offset < sizeof(uint64_t) ||
+			config.status_offset > config.payload_size || config.payload_size - config.status_offset < sizeof(uint32_t))
+		{
+			return nullptr;
+		}
+		auto* cache = new BridgeAssetCache();
+		cache->config = config;
+		return cache;
+	}
+
+	void DestroyAssetCache(BridgeAssetCache* cache)
+	{
+		delete cache;
+	}
+
+	void GetAssetCacheStats(BridgeAssetCache& cache, BridgeAssetCacheStats* outStats)
+	{
+		std::lock_guard<std::mutex> lock(cache.mutex);
+		*outStats = BridgeAssetCacheStats{};
+		outStats->requests = cache.requests;
+		outStats->host_requests = cache.host_requests;
+		outStats->attached = cache.attached;
+		outStats->hits = cache.hits;
+		outStats->fanned_out = cache.fanned_out.load(std::memory_order_relaxed);
+		outStats->entries = static_cast<uint32_t>(cache.entries.size());
+	}
+
+	void CoreAssetRequests::Attach(BridgeAssetCache* cache)
+	{
+		if (cache == cache_)
+		{
+			return;
+		}
+		Abandon();
+		cache_ = cache;
+	}
+
+	void CoreAssetRequests::Abandon()
+	{
+		if (!owned_.empty())
+		{
+			std::lock_guard<std::mutex> lock(cache_->mutex);
+			for (const Pending& pending : owned_)
+			{
+				Unpublish(*cache_, pending.asset);
+
+				// 回执不会再到达：给已挂着的 core 一条失败回执（request_id 在转发时填入）。
+				SharedAsset* asset = pending.asset;
+				const uint32_t status = BRIDGE_ASSET_STATUS_ERROR;
+				asset->result.assign(cache_->config.payload_size, 0);
+				std::memcpy(asset->result.data() + cache_->config.status_offset, &status, sizeof(status));
+				asset->ready.store(true, std::memory_order_release);
+			}
+		}
+		owned_.clear();
+		waiting_.clear();
+	}
+
+	void CoreAssetRequests::CopyFrom(const CoreAssetRequests& source)
+	{
+		Attach(source.cache_);
+		waiting_ = source.waiting_;
+		waiting_.insert(waiting_.end(), source.owned_.begin(), source.owned_.end());
+	}
+
+	bool CoreAssetRequests::Request(BridgeAssetType assetType, std::string_view key, uint64_t requestId)
+	{
+		if (!cache_)
+		{
+			return true;
+		}
+
+		// 查找用的 key 缓冲按线程复用：命中时不分配。
+		thread_local std::string encoded;
+		EncodeKey(encoded, assetType, key);
+
+		std::lock_guard<std::mutex> lock(cache_->mutex);
+		cache_->requests++;
+		const auto it = cache_->entries.find(std::string_view(encoded));
+		if (it != cache_->entries.end())
+		{
+			SharedAsset* asset = it->second.get();
+			if (asset->ready.load(std::memory_order_acquire))
+			{
+				cache_->hits++;
+			}
+			else
+			{
+				cache_->attached++;
+			}
+			waiting_.push_back(Pending{requestId, asset});
+			return false;
+		}
+
+		auto asset = std::make_unique<SharedAsset>();
+		asset->key = encoded;
+		owned_.push_back(Pending{requestId, asset.get()});
+		cache_->entries.emplace(asset->key, std::move(asset));
+		cache_->host_requests++;
+		return true;
+	}
+
+	void CoreAssetRequests::OnInbound(const uint8_t* bytes, size_t len)
+	{
+		const BridgeAssetCacheConfig& config = cache_->config;
+		ForEachCallCore(bytes, static_cast<uint32_t>(len), [&](uint32_t funcId, const void* payload, uint32_t payloadSize) {
+			if (funcId != config.loaded_func_id || payloadSize < sizeof(uint64_t))
+			{
+				return;
+			}
+			uint64_t requestId = 0;
+			std::memcpy(&requestId, payload, sizeof(requestId));
+
+			const auto it = std::find_if(owned_.begin(), owned_.end(), [&](const Pending& p) { return p.request_id == requestId; });
+			if (it == owned_.end())
+			{
+				return;
+			}
+			SharedAsset* asset = it->asset;
+			const auto* p = static_cast<const uint8_t*>(payload);
+			uint32_t status = BRIDGE_ASSET_STATUS_ERROR;
+			if (payloadSize >= config.status_offset + sizeof(status))
+			{
+				std::memcpy(&status, p + config.status_offset, sizeof(status));
+			}
+			if (status != BRIDGE_ASSET_STATUS_OK)
+			{
+				// 失败的结果不缓存：只转给已挂着的 core，之后的请求重新发给 Host。
+				std::lock_guard<std::mutex> lock(cache_->mutex);
+				Unpublish(*cache_, asset);
+			}
+			asset->result.assign(p, p + payloadSize);
+			asset->ready.store(true, std::memory_order_release);
+			owned_.erase(it);
+		});
+	}
+
+	uint32_t CoreAssetRequests::Deliver(ByteBuffer& out, CoreStats& stats)
+	{
+		const uint32_t loadedFuncId = cache_->config.loaded_func_id;
+		uint32_t delivered = 0;
+		auto keep = waiting_.begin();
+		for (auto it = waiting_.begin(); it != waiting_.end(); ++it)
+		{
+			SharedAsset* asset = it->asset;
+			if (!asset->ready.load(std::memory_order_acquire))
+			{
+				*keep++ = *it;
+				continue;
+			}
+
+			BridgeCallCoreHeader hdr{};
+			hdr.func_id = loadedFuncId;
+			hdr.payload_size = static_cast<uint32_t>(asset->result.size());
+			const size_t padded = (asset->result.size() + 7u) & ~size_t{7};
+
+			const size_t oldSize = out.size();
+			const size_t oldCapacity = out.capacity();
+			out.resize(oldSize + sizeof(hdr) + padded);
+			stats.OnCallBufferAppend(oldCapacity, out.capacity());
+
+			uint8_t* dst = out.data() + oldSize;
+			std::memcpy(dst, &hdr, sizeof(hdr));
+			std::memcpy(dst + sizeof(hdr), asset->result.data(), asset->result.size());
+			std::memcpy(dst + sizeof(hdr), &it->request_id, sizeof(it->request_id));
+			std::memset(dst + sizeof(hdr) + asset->result.size(), 0, padded - asset->result.size());
+			delivered++;
+		}
+		waiting_.erase(keep, waiting_.end());
+
+		if (delivered != 0)
+		{
+			cache_->fanned_out.fetch_add(delivered, std::memory_order_relaxed);
+		}
+		return delivered;
+	}
+}
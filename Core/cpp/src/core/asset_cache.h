@@ -0,0 +1,114 @@
+#pragma once
+
+#include <bridge/bridge.h>
+
+#include "core_slab.h"
+#include "core_stats.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace bridge
+{
+	// 共享缓存中的一个 key：进行中的请求，或已到达的结果。
+	struct SharedAsset
+	{
+		// (asset_type, key) 编码后的缓存 key。
+		std::string key;
+		// Host 回执的 payload 原样保存（转发时替换开头的 request_id）；ready 置位（release）之后只读。
+		// 失败的回执、以及发出请求的 core 放弃时合成的失败回执也经这里转给等待者，但 key 已从缓存移除。
+		std::vector<uint8_t> result;
+		std::atomic<bool> ready{false};
+	};
+}
+
+// 跨 core 的资源请求去重（见 bridge.h 的 BridgeAssetCache）。
+//
+// 只有 core 第一次请求某个 key 时才会进入这里（加锁）；结果的发布与转发只读写 SharedAsset::ready 与 result。
+struct BridgeAssetCache
+{
+	BridgeAssetCacheConfig config{};
+
+	struct Hash
+	{
+		using is_transparent = void;
+		size_t operator()(std::string_view s) const noexcept
+		{
+			return std::hash<std::string_view>{}(s);
+		}
+	};
+
+	std::mutex mutex;
+	std::unordered_map<std::string, std::unique_ptr<bridge::SharedAsset>, Hash, std::equal_to<>> entries;
+	// 已移出 entries 的失败结果（含被放弃的请求）：可能仍被等待的 core 引用，随缓存一起释放。
+	std::vector<std::unique_ptr<bridge::SharedAsset>> retired;
+
+	// 以下计数受 mutex 保护；fanned_out 在各 core 的 Tick 线程上累加。
+	uint64_t requests = 0;
+	uint64_t host_requests = 0;
+	uint64_t attached = 0;
+	uint64_t hits = 0;
+	std::atomic<uint64_t> fanned_out{0};
+};
+
+namespace bridge
+{
+	BridgeAssetCache* CreateAssetCache(const BridgeAssetCacheConfig& config);
+	void DestroyAssetCache(BridgeAssetCache* cache);
+	void GetAssetCacheStats(BridgeAssetCache& cache, BridgeAssetCacheStats* outStats);
+
+	// 一个 core 在共享缓存上的请求（BridgeCore::assets）：自己发给 Host、等待回执的，与挂在别的 core 请求上的。
+	// 除 RequestSharedAsset 外都只在 Tick 线程上、由该 core 自己调用。
+	class CoreAssetRequests
+	{
+	public:
+		CoreAssetRequests() = default;
+		~CoreAssetRequests() { Abandon(); }
+
+		CoreAssetRequests(const CoreAssetRequests&) = delete;
+		CoreAssetRequests& operator=(const CoreAssetRequests&) = delete;
+
+		BridgeAssetCache* Cache() const { return cache_; }
+
+		// 换挂到 cache（null 表示摘下）；已有的请求按 Abandon 处理。
+		void Attach(BridgeAssetCache* cache);
+
+		// 放弃本 core 的全部请求：自己发出、回执未到的 key 从缓存移除，并给挂在上面的 core 一条失败回执；
+		// 本 core 挂着的等待直接丢弃（保持挂在原缓存上）。
+		void Abandon();
+
+		// 克隆：挂到 source 的缓存，并等待 source 的全部请求（source 自己发出的也改为等待）。
+		void CopyFrom(const CoreAssetRequests& source);
+
+		// 返回 true 表示调用方应照常向 Host 发出请求（未挂缓存，或本 core 是该 key 的第一个请求者）。
+		bool Request(BridgeAssetType assetType, std::string_view key, uint64_t requestId);
+
+		bool HasOwned() const { return !owned_.empty(); }
+		bool HasWaiting() const { return !waiting_.empty(); }
+
+		// 分发 Host->Core 调用之前：在其中找本 core 所发请求的回执，记为对应 key 的结果（失败的结果只转给当前的等待者）。
+		void OnInbound(const uint8_t* bytes, size_t len);
+
+		// 把已到达的结果编码成 Host->Core 调用追加到 out（request_id 换成本 core 的），返回追加的条数。
+		uint32_t Deliver(ByteBuffer& out, CoreStats& stats);
+
+	private:
+		struct Pending
+		{
+			uint64_t request_id;
+			SharedAsset* asset;
+		};
+
+		BridgeAssetCache* cache_ = nullptr;
+		std::vector<Pending> owned_;
+		std::vector<Pending> waiting_;
+	};
+}
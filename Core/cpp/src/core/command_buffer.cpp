@@ -0,0 +1,298 @@
+#include "command_buffer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+#if defined(_WIN32)
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+	#include <windows.h>
+	#define BRIDGE_HAS_VIRTUAL_MEMORY 1
+#elif (defined(__unix__) || defined(__APPLE__)) && !defined(__EMSCRIPTEN__)
+	#include <sys/mman.h>
+	#include <unistd.h>
+	#define BRIDGE_HAS_VIRTUAL_MEMORY 1
+#else
+	#define BRIDGE_HAS_VIRTUAL_MEMORY 0
+#endif
+
+namespace
+{
+	constexpr size_t kMinHeapCapacity = 256;
+
+#if BRIDGE_HAS_VIRTUAL_MEMORY
+	// Commit granularity on top of the page size: fewer syscalls for growing streams.
+	constexpr size_t kCommitChunk = 64 * 1024;
+	constexpr size_t kHugePageSize = 2 * 1024 * 1024;
+	// Start offsets cycle through this many cache lines of the first page.
+	constexpr size_t kColorCount = 64;
+	constexpr size_t kCacheLine = 64;
+
+	std::atomic<uint32_t> g_nextColor{0};
+
+	size_t RoundUp(size_t x, size_t multiple)
+	{
+		return (x + multiple - 1) / multiple * multiple;
+	}
+
+	#if defined(_WIN32)
+	size_t PageSize()
+	{
+		SYSTEM_INFO info{};
+		GetSystemInfo(&info);
+		return info.dwPageSize;
+	}
+
+	uint8_t* ReserveRange(size_t bytes, bool /*hugePages*/)
+	{
+		// Large pages on Windows need SeLockMemoryPrivilege and cannot be
+		// committed incrementally, so the hint is ignored here.
+		return static_cast<uint8_t*>(VirtualAlloc(nullptr, bytes, MEM_RESERVE, PAGE_NOACCESS));
+	}
+
+	void ReleaseRange(uint8_t* base, size_t /*bytes*/)
+	{
+		VirtualFree(base, 0, MEM_RELEASE);
+	}
+
+	bool CommitRange(uint8_t* p, size_t bytes)
+	{
+		return VirtualAlloc(p, bytes, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+	}
+
+	void DecommitRange(uint8_t* p, size_t bytes)
+	{
+		VirtualFree(p, bytes, MEM_DECOMMIT);
+	}
+	#else
+	size_t PageSize()
+	{
+		const long size = sysconf(_SC_PAGESIZE);
+		return size > 0 ? static_cast<size_t>(size) : 4096;
+	}
+
+	uint8_t* ReserveRange(size_t bytes, bool hugePages)
+	{
+		int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+		#if defined(MAP_NORESERVE)
+		flags |= MAP_NORESERVE;
+		#endif
+
+		// Transparent huge pages need 2 MB aligned ranges: over-reserve and trim.
+		const size_t slack = hugePages ? kHugePageSize : 0;
+		void* p = mmap(nullptr, bytes + slack, PROT_NONE, flags, -1, 0);
+		if (p == MAP_FAILED)
+		{
+			return nullptr;
+		}
+
+		auto* base = static_cast<uint8_t*>(p);
+		if (slack != 0)
+		{
+			const auto addr = reinterpret_cast<uintptr_t>(base);
+			auto* aligned = reinterpret_cast<uint8_t*>(RoundUp(addr, kHugePageSize));
+			const size_t head = static_cast<size_t>(aligned - base);
+			if (head != 0)
+			{
+				munmap(base, head);
+			}
+			if (slack - head != 0)
+			{
+				munmap(aligned + bytes, slack - head);
+			}
+			base = aligned;
+		#if defined(MADV_HUGEPAGE)
+			madvise(base, bytes, MADV_HUGEPAGE);
+		#endif
+		}
+		return base;
+	}
+
+	void ReleaseRange(uint8_t* base, size_t bytes)
+	{
+		munmap(base, bytes);
+	}
+
+	bool CommitRange(uint8_t* p, size_t bytes)
+	{
+		return mprotect(p, bytes, PROT_READ | PROT_WRITE) == 0;
+	}
+
+	void DecommitRange(uint8_t* p, size_t bytes)
+	{
+		// Drop the pages first (the range reads back as zero-fill on demand), then fence it off again.
+		madvise(p, bytes, MADV_DONTNEED);
+		mprotect(p, bytes, PROT_NONE);
+	}
+	#endif
+#endif
+}
+
+namespace bridge
+{
+	CommandBuffer::~CommandBuffer()
+	{
+#if BRIDGE_HAS_VIRTUAL_MEMORY
+		if (reserved_ != 0)
+		{
+			ReleaseRange(base_, reserved_);
+			return;
+		}
+#endif
+		FreeHeap();
+	}
+
+	bool CommandBuffer::ReserveVirtual(size_t reserveBytes, bool hugePages)
+	{
+#if BRIDGE_HAS_VIRTUAL_MEMORY
+		if (reserved_ != 0)
+		{
+			return true;
+		}
+		if (sizeof(void*) < 8)
+		{
+			return false;
+		}
+
+		const size_t granularity = hugePages ? kHugePageSize : std::max(PageSize(), kCommitChunk);
+		const size_t offset = (g_nextColor.fetch_add(1, std::memory_order_relaxed) % kColorCount) * kCacheLine;
+		const size_t reserve = RoundUp(offset + std::max(reserveBytes, c_.capacity), granularity);
+		uint8_t* base = ReserveRange(reserve, hugePages);
+		if (!base)
+		{
+			return false;
+		}
+
+		const size_t commit = c_.capacity != 0 ? RoundUp(offset + c_.capacity, granularity) : 0;
+		if (commit != 0 && !CommitRange(base, commit))
+		{
+			ReleaseRange(base, reserve);
+			return false;
+		}
+		if (c_.size != 0)
+		{
+			std::memcpy(base + offset, c_.data, c_.size);
+		}
+		FreeHeap();
+
+		base_ = base;
+		reserved_ = reserve;
+		committed_ = commit;
+		granularity_ = granularity;
+		offset_ = offset;
+		c_.data = base + offset;
+		c_.capacity = commit != 0 ? commit - offset : 0;
+		idle_frames_ = 0;
+		return true;
+#else
+		(void)reserveBytes;
+		(void)hugePages;
+		return false;
+#endif
+	}
+
+	void CommandBuffer::Grow(size_t minCapacity)
+	{
+#if BRIDGE_HAS_VIRTUAL_MEMORY
+		if (reserved_ != 0)
+		{
+			const size_t need = offset_ + minCapacity;
+			if (need <= reserved_)
+			{
+				// Geometric like the heap backend, but growing in place: nothing is copied.
+				const size_t target = std::min(RoundUp(std::max(need, committed_ * 2), granularity_), reserved_);
+				if (CommitRange(base_ + committed_, target - committed_))
+				{
+					committed_ = target;
+					c_.capacity = target - offset_;
+					return;
+				}
+			}
+			MoveToHeap(minCapacity);
+			return;
+		}
+#endif
+		const size_t target = std::max({minCapacity, c_.capacity * 2, kMinHeapCapacity});
+		uint8_t* p = alloc_.allocate(target);
+		if (c_.size != 0)
+		{
+			std::memcpy(p, c_.data, c_.size);
+		}
+		FreeHeap();
+		c_.data = p;
+		c_.capacity = target;
+	}
+
+	void CommandBuffer::MoveToHeap(size_t minCapacity)
+	{
+#if BRIDGE_HAS_VIRTUAL_MEMORY
+		uint8_t* base = base_;
+		const size_t reserved = reserved_;
+
+		const size_t target = std::max({minCapacity, c_.capacity * 2, kMinHeapCapacity});
+		uint8_t* p = alloc_.allocate(target);
+		if (c_.size != 0)
+		{
+			std::memcpy(p, c_.data, c_.size);
+		}
+		c_.data = p;
+		c_.capacity = target;
+		base_ = nullptr;
+		reserved_ = 0;
+		committed_ = 0;
+		granularity_ = 0;
+		offset_ = 0;
+		ReleaseRange(base, reserved);
+#else
+		(void)minCapacity;
+#endif
+	}
+
+	void CommandBuffer::Trim()
+	{
+		// Called from Clear() with c_.size still holding the frame that just ended.
+		if (c_.size > retain_)
+		{
+			idle_frames_ = 0;
+			return;
+		}
+		if (++idle_frames_ < kTrimIdleFrames)
+		{
+			return;
+		}
+		idle_frames_ = 0;
+
+#if BRIDGE_HAS_VIRTUAL_MEMORY
+		if (reserved_ != 0)
+		{
+			const size_t keep = RoundUp(offset_ + retain_, granularity_);
+			if (keep < committed_)
+			{
+				DecommitRange(base_ + keep, committed_ - keep);
+				committed_ = keep;
+				c_.capacity = keep - offset_;
+			}
+			return;
+		}
+#endif
+		// The frame is being discarded, so the smaller block starts empty.
+		FreeHeap();
+		c_.data = alloc_.allocate(retain_);
+		c_.capacity = retain_;
+	}
+
+	void CommandBuffer::FreeHeap()
+	{
+		if (c_.data && reserved_ == 0)
+		{
+			alloc_.deallocate(c_.data, c_.capacity);
+		}
+		c_.data = nullptr;
+		c_.capacity = 0;
+	}
+}
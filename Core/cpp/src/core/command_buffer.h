@@ -0,0 +1,110 @@
+#pragma once
+
+#include "core_slab.h"
+
+#include <bridge/runtime/core_context.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace bridge
+{
+	// Growable byte buffer behind a core's own command stream.
+	//
+	// Append() hands out uninitialized bytes: the stream writes every byte of a
+	// command itself, so nothing is zero-filled first. Two backends:
+	// - heap (default): geometric growth that copies the frame on reallocation.
+	//   The first block may come from the core's slab region.
+	// - virtual (ReserveVirtual): one address range is reserved up front and
+	//   pages are committed as the stream grows, so the data never moves and
+	//   growth never copies. A frame that outgrows the reservation (or a failed
+	//   commit) moves the buffer to the heap backend for good.
+	//
+	// Retain policy: Clear() gives back committed bytes above `retain` once
+	// kTrimIdleFrames consecutive frames stayed within it, so a core that spiked
+	// once does not keep the spike's memory forever. retain == 0 never trims.
+	class CommandBuffer
+	{
+	public:
+		// Frames in a row that must fit in `retain` before the excess is released.
+		static constexpr uint32_t kTrimIdleFrames = 64;
+
+		explicit CommandBuffer(CommandCursor& cursor) : c_(cursor) {}
+		~CommandBuffer();
+
+		CommandBuffer(const CommandBuffer&) = delete;
+		CommandBuffer& operator=(const CommandBuffer&) = delete;
+
+		// Heap backend: take the first block from `region` when it fits. Must be
+		// called before the first allocation.
+		void SetRegion(BufferRegion* region) { alloc_ = RegionAllocator<uint8_t>(region); }
+
+		// Switch to the virtual backend with `reserveBytes` of address space.
+		// Returns false (and keeps the heap backend) where reserving is not
+		// supported, e.g. 32-bit targets, or when the reservation fails.
+		bool ReserveVirtual(size_t reserveBytes, bool hugePages);
+
+		void SetRetain(size_t retainBytes) { retain_ = retainBytes; }
+
+		void Reserve(size_t capacity)
+		{
+			if (capacity > c_.capacity)
+			{
+				Grow(capacity);
+			}
+		}
+
+		uint8_t* Append(size_t size)
+		{
+			if (c_.capacity - c_.size < size)
+			{
+				Grow(c_.size + size);
+			}
+			uint8_t* p = c_.data + c_.size;
+			c_.size += size;
+			return p;
+		}
+
+		void Clear()
+		{
+			if (retain_ != 0 && c_.capacity > retain_)
+			{
+				Trim();
+			}
+			c_.size = 0;
+		}
+
+		uint8_t* Data() { return c_.data; }
+		const uint8_t* Data() const { return c_.data; }
+		size_t Size() const { return c_.size; }
+
+		// Bytes currently usable without growing (committed pages for the virtual backend).
+		size_t Capacity() const { return c_.capacity; }
+		bool IsVirtual() const { return reserved_ != 0; }
+
+	private:
+		void Grow(size_t minCapacity);
+		void MoveToHeap(size_t minCapacity);
+		void Trim();
+		void FreeHeap();
+
+		// data/size/capacity live in the owning stream's cursor (see CommandCursor).
+		CommandCursor& c_;
+
+		RegionAllocator<uint8_t> alloc_;
+
+		// Virtual backend: [base_, base_ + reserved_) is reserved and the first
+		// committed_ bytes are committed, in multiples of granularity_. c_.data
+		// starts offset_ bytes in: every range is page aligned, and staggering
+		// the first cache line keeps thousands of small streams from all mapping
+		// to the same L1 sets.
+		uint8_t* base_ = nullptr;
+		size_t reserved_ = 0;
+		size_t committed_ = 0;
+		size_t granularity_ = 0;
+		size_t offset_ = 0;
+
+		size_t retain_ = 0;
+		uint32_t idle_frames_ = 0;
+	};
+}
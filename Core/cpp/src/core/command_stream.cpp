@@ -1,36 +1,355 @@
 #include "command_stream.h"
 
+#include <algorithm>
+
+namespace
+{
+	constexpr size_t kStringBlockSize = 4096;
+	constexpr size_t kInitialCoalesceSlots = 64;
+
+	size_t HashKey(uint64_t key)
+	{
+		// splitmix64 finalizer: entity ids are often sequential.
+		key ^= key >> 30;
+		key *= 0xbf58476d1ce4e5b9ull;
+		key ^= key >> 27;
+		key *= 0x94d049bb133111ebull;
+		key ^= key >> 31;
+		return static_cast<size_t>(key);
+	}
+}
+
 namespace bridge
 {
-	void CommandStream::Reserve(size_t commandBytesCapacity, size_t stringCountCapacity)
+	void CommandStream::Reserve(size_t commandBytesCapacity, size_t stringBytesCapacity, BufferRegion* region)
 	{
-		bytes_.reserve(commandBytesCapacity);
-		strings_.reserve(stringCountCapacity);
+		if (region && bytes_.Capacity() == 0 && !bytes_.IsVirtual())
+		{
+			bytes_.SetRegion(region);
+		}
+		bytes_.Reserve(commandBytesCapacity);
+		if (string_blocks_.empty() && stringBytesCapacity > 0)
+		{
+			StringBlock block;
+			block.capacity = stringBytesCapacity;
+			block.data = region ? static_cast<char*>(region->Take(block.capacity)) : nullptr;
+			if (!block.data)
+			{
+				block.owned = std::make_unique<char[]>(block.capacity);
+				block.data = block.owned.get();
+			}
+			string_blocks_.push_back(std::move(block));
+		}
 	}
 
 	void CommandStream::Clear()
 	{
-		bytes_.clear();
-		strings_used_ = 0;
+		bytes_.Clear();
+		string_block_ = 0;
+		string_used_ = 0;
+
+		cursor_.has_last_call = false;
+		cursor_.last_call_coalesced = false;
+
+		coalesce_count_ = 0;
+		coalesce_end_ = 0;
+		coalesce_barrier_ = 0;
+		if (++coalesce_stamp_ == 0)
+		{
+			// Stamp wrapped: forget every slot explicitly so stale ones cannot match.
+			std::fill(coalesce_slots_.begin(), coalesce_slots_.end(), CoalesceSlot{});
+			coalesce_stamp_ = 1;
+		}
+
+		external_ = nullptr;
+		cursor_.direct = true;
+		base_ = 0;
+		sealed_end_ = 0;
+		sealed_ = false;
+		detached_ = false;
+		detached_data_ = nullptr;
+		detached_size_ = 0;
 	}
 
-	BridgeStringView CommandStream::StoreUtf8(std::string utf8)
+	size_t CommandStream::StringCapacity() const
 	{
-		if (strings_used_ >= strings_.size())
+		size_t bytes = 0;
+		for (const StringBlock& block : string_blocks_)
 		{
-			strings_.emplace_back(std::make_unique<std::string>());
+			bytes += block.capacity;
 		}
+		return bytes;
+	}
 
-		std::string* stored = strings_[strings_used_].get();
-		*stored = std::move(utf8);
+	void CommandStream::BeginExternal(ByteBuffer& arena)
+	{
+		external_ = &arena;
+		cursor_.direct = false;
+		base_ = arena.size();
+		sealed_ = false;
+	}
+
+	void CommandStream::EndExternal()
+	{
+		if (!external_)
+		{
+			return;
+		}
+		sealed_end_ = external_->size();
+		sealed_ = true;
+	}
 
-		const char* p = stored->data();
-		const uint32_t len = static_cast<uint32_t>(stored->size());
-		strings_used_++;
+	void CommandStream::DetachExternal()
+	{
+		if (!external_)
+		{
+			return;
+		}
+		detached_size_ = Size();
+		detached_data_ = detached_size_ == 0 ? nullptr : external_->data() + base_;
+		detached_ = true;
+		external_ = nullptr;
+		base_ = 0;
+	}
 
+	BridgeStringView CommandStream::StoreUtf8(std::string_view utf8)
+	{
 		BridgeStringView view{};
-		view.ptr = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(p));
-		view.len = len;
+		if (utf8.empty())
+		{
+			return view;
+		}
+
+		const size_t len = utf8.size();
+		while (string_block_ < string_blocks_.size() &&
+			string_blocks_[string_block_].capacity - string_used_ < len)
+		{
+			// Does not fit: move on to the next block (the tail is wasted for this frame only).
+			string_block_++;
+			string_used_ = 0;
+		}
+		if (string_block_ == string_blocks_.size())
+		{
+			StringBlock block;
+			block.capacity = std::max(len, kStringBlockSize);
+			block.owned = std::make_unique<char[]>(block.capacity);
+			block.data = block.owned.get();
+			string_blocks_.push_back(std::move(block));
+		}
+
+		char* dst = string_blocks_[string_block_].data + string_used_;
+		std::memcpy(dst, utf8.data(), len);
+		string_used_ += len;
+
+		view.ptr = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(dst));
+		view.len = static_cast<uint32_t>(len);
 		return view;
 	}
+
+	uint8_t* CommandStream::AllocateOp(uint32_t funcId, uint16_t opcode, uint32_t stride)
+	{
+		const uint32_t offset = Size();
+		if (cursor_.has_last_call && cursor_.last_call_end == offset &&
+			cursor_.last_call_func == funcId && cursor_.last_call_stride == stride)
+		{
+			BridgeCmdCallOp op{};
+			std::memcpy(&op, BufferData() + base_ + cursor_.last_call_offset, sizeof(op));
+
+			if (op.header.type == opcode && op.header.size + stride <= UINT16_MAX)
+			{
+				const uint32_t payloadOffset = op.header.size;
+				Allocate(stride);
+				uint8_t* cmd = BufferData() + base_ + cursor_.last_call_offset;
+				op.header.size = static_cast<uint16_t>(payloadOffset + stride);
+				op.count++;
+				std::memcpy(cmd, &op, sizeof(op));
+				cursor_.last_call_end = Size();
+				cursor_.last_call_coalesced = false;
+				return cmd + payloadOffset;
+			}
+		}
+
+		uint8_t* cmd = Allocate(sizeof(BridgeCmdCallOp) + stride);
+		BridgeCmdCallOp op{};
+		op.header.type = opcode;
+		op.header.size = static_cast<uint16_t>(sizeof(BridgeCmdCallOp) + stride);
+		op.count = 1;
+		std::memcpy(cmd, &op, sizeof(op));
+
+		cursor_.has_last_call = true;
+		cursor_.last_call_offset = offset;
+		cursor_.last_call_end = Size();
+		cursor_.last_call_func = funcId;
+		cursor_.last_call_stride = stride;
+		cursor_.last_call_coalesced = false;
+		return cmd + sizeof(BridgeCmdCallOp);
+	}
+
+	uint8_t* CommandStream::AllocateCall(uint32_t funcId, uint32_t stride, uint16_t opcode)
+	{
+		if (cursor_.dense_opcodes && opcode >= BRIDGE_CMD_OPCODE_BASE)
+		{
+			return AllocateOp(funcId, opcode, stride);
+		}
+
+		const uint32_t offset = Size();
+		if (cursor_.has_last_call && cursor_.last_call_end == offset &&
+			cursor_.last_call_func == funcId && cursor_.last_call_stride == stride)
+		{
+			BridgeCommandHeader header{};
+			std::memcpy(&header, BufferData() + base_ + cursor_.last_call_offset, sizeof(header));
+
+			if (header.type == BRIDGE_CMD_CALL_HOST_BATCH &&
+				header.size + stride <= UINT16_MAX)
+			{
+				Allocate(stride);
+				uint8_t* cmd = BufferData() + base_ + cursor_.last_call_offset;
+				auto* batch = reinterpret_cast<BridgeCmdCallHostBatch*>(cmd);
+				batch->header.size = static_cast<uint16_t>(header.size + stride);
+				batch->count++;
+				cursor_.last_call_end = Size();
+				cursor_.last_call_coalesced = false;
+				return cmd + header.size;
+			}
+
+			constexpr uint32_t kGrow = sizeof(BridgeCmdCallHostBatch) - sizeof(BridgeCmdCallHost);
+			const uint32_t batchSize = static_cast<uint32_t>(sizeof(BridgeCmdCallHostBatch)) + 2 * stride;
+			if (header.type == BRIDGE_CMD_CALL_HOST && batchSize <= UINT16_MAX)
+			{
+				// Promote the single call to a batch: the header grows, so shift its payload.
+				Allocate(kGrow + stride);
+				uint8_t* cmd = BufferData() + base_ + cursor_.last_call_offset;
+				std::memmove(cmd + sizeof(BridgeCmdCallHostBatch), cmd + sizeof(BridgeCmdCallHost), stride);
+
+				BridgeCmdCallHostBatch batch{};
+				batch.header.type = BRIDGE_CMD_CALL_HOST_BATCH;
+				batch.header.size = static_cast<uint16_t>(batchSize);
+				batch.func_id = funcId;
+				batch.count = 2;
+				batch.stride = stride;
+				std::memcpy(cmd, &batch, sizeof(batch));
+
+				if (cursor_.last_call_coalesced)
+				{
+					CoalesceSlot* slot = FindCoalesceSlot(last_call_key_);
+					const uint32_t oldPayload = cursor_.last_call_offset + static_cast<uint32_t>(sizeof(BridgeCmdCallHost));
+					if (slot && slot->offset == oldPayload)
+					{
+						slot->offset = oldPayload + kGrow;
+					}
+				}
+
+				cursor_.last_call_end = Size();
+				cursor_.last_call_coalesced = false;
+				return cmd + sizeof(BridgeCmdCallHostBatch) + stride;
+			}
+		}
+
+		uint8_t* cmd = Allocate(sizeof(BridgeCmdCallHost) + stride);
+		BridgeCmdCallHost single{};
+		single.header.type = BRIDGE_CMD_CALL_HOST;
+		single.header.size = static_cast<uint16_t>(sizeof(BridgeCmdCallHost) + stride);
+		single.func_id = funcId;
+		std::memcpy(cmd, &single, sizeof(single));
+
+		cursor_.has_last_call = true;
+		cursor_.last_call_offset = offset;
+		cursor_.last_call_end = Size();
+		cursor_.last_call_func = funcId;
+		cursor_.last_call_stride = stride;
+		cursor_.last_call_coalesced = false;
+		return cmd + sizeof(BridgeCmdCallHost);
+	}
+
+	uint8_t* CommandStream::AllocateCallCoalesced(uint32_t funcId, uint64_t key, uint32_t stride, uint16_t opcode)
+	{
+		if ((coalesce_count_ + 1) * 2 > coalesce_slots_.size())
+		{
+			GrowCoalesceIndex();
+		}
+
+		const uint32_t end = Size();
+		if (end != coalesce_end_)
+		{
+			coalesce_barrier_ = end;
+		}
+
+		const size_t mask = coalesce_slots_.size() - 1;
+		size_t i = HashKey(key) & mask;
+		while (coalesce_slots_[i].stamp == coalesce_stamp_ && coalesce_slots_[i].key != key)
+		{
+			i = (i + 1) & mask;
+		}
+
+		CoalesceSlot& slot = coalesce_slots_[i];
+		if (slot.stamp == coalesce_stamp_)
+		{
+			if (slot.func_id == funcId && slot.stride == stride && slot.offset >= coalesce_barrier_)
+			{
+				return BufferData() + base_ + slot.offset;
+			}
+		}
+		else
+		{
+			slot.key = key;
+			slot.stamp = coalesce_stamp_;
+			coalesce_count_++;
+		}
+
+		uint8_t* payload = AllocateCall(funcId, stride, opcode);
+		// AllocateCall never grows the index, so `slot` is still valid here.
+		slot.offset = static_cast<uint32_t>(payload - (BufferData() + base_));
+		slot.func_id = funcId;
+		slot.stride = stride;
+
+		// Only a single BRIDGE_CMD_CALL_HOST moves its payload when promoted to a batch.
+		BridgeCommandHeader tail{};
+		std::memcpy(&tail, BufferData() + base_ + cursor_.last_call_offset, sizeof(tail));
+		const bool single = tail.type == BRIDGE_CMD_CALL_HOST;
+		cursor_.last_call_coalesced = single;
+		last_call_key_ = key;
+		coalesce_end_ = Size();
+		return payload;
+	}
+
+	CommandStream::CoalesceSlot* CommandStream::FindCoalesceSlot(uint64_t key)
+	{
+		if (coalesce_slots_.empty())
+		{
+			return nullptr;
+		}
+		const size_t mask = coalesce_slots_.size() - 1;
+		size_t i = HashKey(key) & mask;
+		while (coalesce_slots_[i].stamp == coalesce_stamp_)
+		{
+			if (coalesce_slots_[i].key == key)
+			{
+				return &coalesce_slots_[i];
+			}
+			i = (i + 1) & mask;
+		}
+		return nullptr;
+	}
+
+	void CommandStream::GrowCoalesceIndex()
+	{
+		std::vector<CoalesceSlot> old;
+		old.swap(coalesce_slots_);
+		coalesce_slots_.resize(old.empty() ? kInitialCoalesceSlots : old.size() * 2);
+
+		const size_t mask = coalesce_slots_.size() - 1;
+		for (const CoalesceSlot& slot : old)
+		{
+			if (slot.stamp != coalesce_stamp_)
+			{
+				continue;
+			}
+			size_t i = HashKey(slot.key) & mask;
+			while (coalesce_slots_[i].stamp == coalesce_stamp_)
+			{
+				i = (i + 1) & mask;
+			}
+			coalesce_slots_[i] = slot;
+		}
+	}
 }
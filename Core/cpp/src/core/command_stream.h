@@ -2,10 +2,14 @@
 
 #include <bridge/bridge.h>
 
+#include "command_buffer.h"
+#include "core_slab.h"
+#include "core_stats.h"
+
 #include <cstdint>
 #include <cstring>
 #include <memory>
-#include <string>
+#include <string_view>
 #include <type_traits>
 #include <vector>
 
@@ -17,24 +21,95 @@ namespace bridge
 	// Lifetime:
 	// - Returned pointers are valid until the next Core tick clears the stream
 	//   (or the core is destroyed).
+	//
+	// Batch mode:
+	// - BeginExternal() redirects writes into a shared arena (owned by a core group)
+	//   so that many cores' commands end up contiguous in memory.
+	// - Data()/Size() then describe this core's slice of the arena; the pointer is
+	//   recomputed on read, so it stays valid while the arena is only appended to.
+	// - DetachExternal() ends the batch: the slice is kept as a raw pointer +
+	//   length and the arena is never dereferenced again (the group may be
+	//   destroyed; the pointer is then stale like the Host's copy of it).
 	class CommandStream
 	{
 	public:
-		void Reserve(size_t commandBytesCapacity, size_t stringCountCapacity);
+		CommandStream() : bytes_(cursor_) {}
+
+		CommandStream(const CommandStream&) = delete;
+		CommandStream& operator=(const CommandStream&) = delete;
+
+		// Write state of the own buffer, shared with CoreContext's inline
+		// Emplace fast path (see CommandCursor).
+		CommandCursor& Cursor() { return cursor_; }
+
+		// Reserve the initial command buffer and the first string block. With a
+		// `region` (a core created by BridgeCore_CreateMany) both are carved out of
+		// it; later growth falls back to the heap.
+		void Reserve(size_t commandBytesCapacity, size_t stringBytesCapacity, BufferRegion* region = nullptr);
+
+		// Back the own command buffer with a reserved address range instead of the
+		// heap (BRIDGE_CORE_FLAG_VIRTUAL_COMMAND_BUFFER, see CommandBuffer). Call
+		// before Reserve(); returns false where unsupported (the heap is kept).
+		bool ReserveVirtual(size_t reserveBytes, bool hugePages) { return bytes_.ReserveVirtual(reserveBytes, hugePages); }
+
+		// Command bytes kept committed once a spike has passed (0: keep everything).
+		void SetRetainBytes(size_t retainBytes) { bytes_.SetRetain(retainBytes); }
 		void Clear();
 
-		// Store UTF-8 bytes and return a view that remains valid until Clear().
-		BridgeStringView StoreUtf8(std::string utf8);
+		// Append this frame's commands to `arena` instead of the core's own buffer.
+		// Must be called right after Clear(); the slice ends at EndExternal().
+		void BeginExternal(ByteBuffer& arena);
+		void EndExternal();
+		// Call once the whole batch has been written (the arena no longer moves).
+		void DetachExternal();
+
+		// Copy UTF-8 bytes into the per-frame string arena and return a view that
+		// remains valid until Clear(). No heap allocation once the arena has grown
+		// to the frame's high-water mark.
+		BridgeStringView StoreUtf8(std::string_view utf8);
+
+		// Dense opcode mode (BRIDGE_CORE_FLAG_DENSE_OPCODES): calls that carry an
+		// opcode are written as BridgeCmdCallOp instead of CALL_HOST/CALL_HOST_BATCH.
+		void SetDenseOpcodes(bool enabled) { cursor_.dense_opcodes = enabled; }
+
+		// Append a host call for `funcId` and return its payload bytes (`stride`
+		// bytes, a multiple of 8, uninitialized). A call to the same function with the
+		// same stride as the command right before it is folded into that command:
+		// a BRIDGE_CMD_CALL_HOST becomes a BRIDGE_CMD_CALL_HOST_BATCH, and a batch
+		// grows by one entry until header.size would overflow. In dense opcode mode
+		// a non-zero `opcode` selects the BridgeCmdCallOp layout, which grows in
+		// place (its payloads never move).
+		uint8_t* AllocateCall(uint32_t funcId, uint32_t stride, uint16_t opcode = 0);
+
+		// Last-writer-wins variant of AllocateCall. If the most recent coalesced
+		// call for `key` in this frame has the same func_id and stride, and nothing
+		// but coalesced calls has been appended since, its payload is returned for
+		// overwriting in place (it keeps its original position in the stream,
+		// inside a batch or not). Otherwise a call is appended as above and becomes
+		// the latest one for `key`.
+		uint8_t* AllocateCallCoalesced(uint32_t funcId, uint64_t key, uint32_t stride, uint16_t opcode = 0);
 
+		// Append `size` bytes to the stream. The new bytes are uninitialized: the
+		// caller writes all of them (AllocateCall leaves the payload to its caller,
+		// CoreContext::Emplace zero-fills its compile-time stride).
 		uint8_t* Allocate(size_t size)
 		{
 			if (size == 0)
 			{
 				return nullptr;
 			}
-			const size_t oldSize = bytes_.size();
-			bytes_.resize(oldSize + size);
-			return bytes_.data() + oldSize;
+			if (external_)
+			{
+				return AllocateExternal(size);
+			}
+#if BRIDGE_ENABLE_STATS
+			const uint8_t* oldData = bytes_.Data();
+			uint8_t* dst = bytes_.Append(size);
+			grow_count_ += bytes_.Data() != oldData;
+			return dst;
+#else
+			return bytes_.Append(size);
+#endif
 		}
 
 		void PushBytes(const void* data, size_t size)
@@ -71,17 +146,132 @@ namespace bridge
 
 		const uint8_t* Data() const
 		{
-			return bytes_.empty() ? nullptr : bytes_.data();
+			if (detached_)
+			{
+				return detached_size_ == 0 ? nullptr : detached_data_;
+			}
+			return Size() == 0 ? nullptr : BufferData() + base_;
 		}
 
 		uint32_t Size() const
 		{
-			return static_cast<uint32_t>(bytes_.size());
+			if (detached_)
+			{
+				return detached_size_;
+			}
+			const size_t end = sealed_ ? sealed_end_ : (external_ ? external_->size() : bytes_.Size());
+			return static_cast<uint32_t>(end - base_);
+		}
+
+		// Statistics (BRIDGE_ENABLE_STATS): how often Allocate() had to reallocate
+		// the buffer it writes to since the last call (always 0 when disabled).
+		uint32_t TakeGrowCount()
+		{
+#if BRIDGE_ENABLE_STATS
+			const uint32_t count = grow_count_;
+			grow_count_ = 0;
+			return count;
+#else
+			return 0;
+#endif
 		}
 
+		// Capacity of the own command buffer and of the string arena (all blocks).
+		size_t CommandCapacity() const { return bytes_.Capacity(); }
+		size_t StringCapacity() const;
+
+#if BRIDGE_ENABLE_STATS
+		// Bytes currently reserved by this stream (own command buffer + string arena).
+		size_t CapacityBytes() const { return CommandCapacity() + StringCapacity(); }
+#endif
+
 	private:
-		std::vector<uint8_t> bytes_;
-		std::vector<std::unique_ptr<std::string>> strings_;
-		size_t strings_used_ = 0;
+		uint8_t* BufferData()
+		{
+			return external_ ? external_->data() : bytes_.Data();
+		}
+
+		const uint8_t* BufferData() const
+		{
+			return external_ ? external_->data() : bytes_.Data();
+		}
+
+		// The shared arena is a vector (other cores append to it too), so it still
+		// grows by resize; only the own buffer skips the zero-fill.
+		uint8_t* AllocateExternal(size_t size)
+		{
+			const size_t oldSize = external_->size();
+#if BRIDGE_ENABLE_STATS
+			const size_t oldCapacity = external_->capacity();
+			external_->resize(oldSize + size);
+			grow_count_ += external_->capacity() != oldCapacity;
+#else
+			external_->resize(oldSize + size);
+#endif
+			return external_->data() + oldSize;
+		}
+
+		uint8_t* AllocateOp(uint32_t funcId, uint16_t opcode, uint32_t stride);
+
+		// Declared before bytes_, which keeps its data/size/capacity here.
+		CommandCursor cursor_;
+		CommandBuffer bytes_;
+#if BRIDGE_ENABLE_STATS
+		uint32_t grow_count_ = 0;
+#endif
+
+		// Batch mode slice: [base_, sealed_end_) of *external_.
+		ByteBuffer* external_ = nullptr;
+		size_t base_ = 0;
+		size_t sealed_end_ = 0;
+		bool sealed_ = false;
+		// Set by DetachExternal(): the slice, no longer tied to the arena.
+		bool detached_ = false;
+		const uint8_t* detached_data_ = nullptr;
+		uint32_t detached_size_ = 0;
+
+		// String arena: a list of fixed blocks (never reallocated, so returned views
+		// stay valid while the arena grows). Clear() rewinds to the first block.
+		struct StringBlock
+		{
+			std::unique_ptr<char[]> owned; // null when the block lives in a BufferRegion
+			char* data = nullptr;
+			size_t capacity = 0;
+		};
+
+		std::vector<StringBlock> string_blocks_;
+		size_t string_block_ = 0;
+		size_t string_used_ = 0;
+
+		// The tail call (cursor_.has_last_call etc.) is tracked in the cursor so
+		// that the inline fast path can see it. When it is a single coalesced
+		// command, turning it into a batch moves its payload, so the index entry
+		// for this key is patched.
+		uint64_t last_call_key_ = 0;
+
+		// Coalescing index: open addressing, key -> payload offset (relative to
+		// base_) of the latest coalesced call. Slots from earlier frames are
+		// recognised by their stamp, so Clear() resets the index in O(1).
+		struct CoalesceSlot
+		{
+			uint64_t key = 0;
+			uint32_t offset = 0;
+			uint32_t func_id = 0;
+			uint32_t stride = 0;
+			uint32_t stamp = 0;
+		};
+
+		CoalesceSlot* FindCoalesceSlot(uint64_t key);
+		void GrowCoalesceIndex();
+
+		std::vector<CoalesceSlot> coalesce_slots_;
+		uint32_t coalesce_count_ = 0;
+		uint32_t coalesce_stamp_ = 1;
+		// Stream end after the latest coalesced call. Anything else appended after
+		// it (another command, a DEFINE_STRING, a plain call) moves the barrier:
+		// payloads before the barrier are never overwritten, so a later value
+		// cannot jump ahead of a command the Host must see first.
+		uint32_t coalesce_end_ = 0;
+		uint32_t coalesce_barrier_ = 0;
 	};
 }
@@ -0,0 +1,62 @@
+#include "core_group.h"
+
+#include "core_instance.h"
+
+namespace bridge
+{
+	BridgeCoreGroup* CreateCoreGroup()
+	{
+		return new BridgeCoreGroup();
+	}
+
+	void DestroyCoreGroup(BridgeCoreGroup* group)
+	{
+		delete group;
+	}
+
+	void PrepareGroupChunks(BridgeCoreGroup& group, uint32_t chunkCount)
+	{
+		if (group.arenas.size() < chunkCount)
+		{
+			group.arenas.resize(chunkCount);
+		}
+	}
+
+	void TickGroupChunk(
+		BridgeCoreGroup& group,
+		uint32_t chunk,
+		BridgeCore** cores,
+		uint32_t begin,
+		uint32_t end,
+		float dt,
+		BridgeCommandStream* outStreams)
+	{
+		ByteBuffer& arena = group.arenas[chunk];
+		arena.clear();
+
+		for (uint32_t i = begin; i < end; i++)
+		{
+			if (cores[i])
+			{
+				Tick(*cores[i], dt, &arena);
+			}
+		}
+
+		// arena 在本 chunk 内可能扩容，切片指针必须等整个 chunk 写完后再取。
+		// 取完即与 arena 脱钩：之后 core 只保存指针与长度，销毁 group 不会让 core 访问已释放的 arena。
+		for (uint32_t i = begin; i < end; i++)
+		{
+			BridgeCommandStream& out = outStreams[i];
+			out.reserved0 = 0;
+			if (!cores[i])
+			{
+				out.ptr = nullptr;
+				out.len = 0;
+				continue;
+			}
+			cores[i]->Commands().DetachExternal();
+			out.ptr = cores[i]->Commands().Data();
+			out.len = cores[i]->Commands().Size();
+		}
+	}
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <bridge/bridge.h>
+
+#include "core_slab.h"
+
+#include <cstdint>
+#include <vector>
+
+// 一组 core 共享的批量输出 arena（BridgeCoreGroup_TickManyAndGetCommandStreams 使用）。
+//
+// 批量 Tick 按 chunk（连续的 cores 区间）执行，每个 chunk 的所有 core 依次把命令追加到同一个 arena，
+// out_streams[i] 即 cores[i] 在 arena 中的切片。Host 按下标顺序分发时是一次顺序扫描，
+// 不再在上万个互不相邻的 per-core 缓冲之间跳转。
+//
+// 串行模式下整批只有一个 chunk（一个 arena）；并行模式下每个 chunk 一个 arena（chunk 内连续）。
+// arena 在帧间复用（clear 保留容量），稳定后不再分配。
+struct BridgeCoreGroup
+{
+	std::vector<bridge::ByteBuffer> arenas;
+};
+
+namespace bridge
+{
+	BridgeCoreGroup* CreateCoreGroup();
+	void DestroyCoreGroup(BridgeCoreGroup* group);
+
+	// 确保有 chunkCount 个 arena 可用（由调度方在批次开始前、单线程调用）。
+	void PrepareGroupChunks(BridgeCoreGroup& group, uint32_t chunkCount);
+
+	// Tick cores[begin..end)，命令写入 arenas[chunk]，并填充对应的 outStreams。
+	void TickGroupChunk(
+		BridgeCoreGroup& group,
+		uint32_t chunk,
+		BridgeCore** cores,
+		uint32_t begin,
+		uint32_t end,
+		float dt,
+		BridgeCommandStream* outStreams);
+}
@@ -1,4 +1,5 @@
 #include "core_instance.h"
+#include "tick_pool.h"
 
 #include <bridge/runtime/core_context.h>
 #include <bridge/runtime/game_entry.h>
@@ -6,26 +7,129 @@
 #include <algorithm>
 #include <cassert>
 #include <cstring>
+#include <new>
 #include <string>
 
 namespace
 {
-	struct PendingCallHeader
-	{
-		uint32_t func_id = 0;
-		uint32_t payload_size = 0;
-	};
+	// BridgeCore_SetTickWorkerCount 的上限（防止误传导致创建海量线程）。
+	constexpr uint32_t kMaxTickWorkers = 256;
+
+	// BridgeCoreConfig 中缓冲容量为 0 时的默认值。
+	constexpr uint32_t kDefaultCommandBytes = 1024;
+	constexpr uint32_t kDefaultStringBytes = 4096;
+	constexpr uint32_t kDefaultCallBytes = 256;
+	constexpr uint32_t kDefaultCommandReserve = 64u * 1024u * 1024u;
+
+	// slab 内每个 core 与缓冲区域的对齐（并行 Tick 时相邻 core 不共享 cache line）。
+	constexpr size_t kSlabAlign = 64;
 
 	static uint32_t Align8(uint32_t x)
 	{
 		return (x + 7u) & ~7u;
 	}
+
+	static size_t AlignSlab(size_t x)
+	{
+		return (x + kSlabAlign - 1) & ~(kSlabAlign - 1);
+	}
+
+	static uint32_t CapacityOr(uint32_t capacity, uint32_t fallback)
+	{
+		return capacity != 0 ? capacity : fallback;
+	}
+
+	// 一个 core 的初始缓冲在 slab 中占用的字节数（与 InitBuffers 的预留一一对应；虚拟命令缓冲不占 slab）。
+	static size_t BufferRegionBytes(const BridgeCoreConfig& config)
+	{
+		const size_t commandBytes = (config.flags & BRIDGE_CORE_FLAG_VIRTUAL_COMMAND_BUFFER)
+			? 0
+			: Align8(CapacityOr(config.command_bytes_capacity, kDefaultCommandBytes));
+		const size_t streamBytes = commandBytes + Align8(CapacityOr(config.string_bytes_capacity, kDefaultStringBytes));
+		const size_t streamCount = (config.flags & BRIDGE_CORE_FLAG_DOUBLE_BUFFERED) ? 2 : 1;
+		return AlignSlab(streamBytes * streamCount + Align8(CapacityOr(config.call_bytes_capacity, kDefaultCallBytes)));
+	}
+
+	// 按 core.config 预留缓冲（优先使用 core.buffers；已有足够容量时不变）。
+	static void InitBuffers(BridgeCore& core)
+	{
+		const BridgeCoreConfig& config = core.config;
+		const uint32_t commandBytes = CapacityOr(config.command_bytes_capacity, kDefaultCommandBytes);
+		const uint32_t stringBytes = CapacityOr(config.string_bytes_capacity, kDefaultStringBytes);
+
+		const uint32_t streamCount = (config.flags & BRIDGE_CORE_FLAG_DOUBLE_BUFFERED) ? 2 : 1;
+		for (uint32_t i = 0; i < streamCount; i++)
+		{
+			bridge::CommandStream& stream = core.streams[i];
+			if (config.flags & BRIDGE_CORE_FLAG_VIRTUAL_COMMAND_BUFFER)
+			{
+				// 失败（平台不支持或地址空间不足）时保持堆缓冲。
+				stream.ReserveVirtual(
+					CapacityOr(config.command_bytes_reserve, kDefaultCommandReserve),
+					(config.flags & BRIDGE_CORE_FLAG_HUGE_PAGES) != 0);
+			}
+			stream.Reserve(commandBytes, stringBytes, &core.buffers);
+			stream.SetRetainBytes(config.command_bytes_retain);
+		}
+		if (core.pending_call_bytes.capacity() == 0)
+		{
+			core.pending_call_bytes = bridge::ByteBuffer(bridge::RegionAllocator<uint8_t>(&core.buffers));
+		}
+		core.pending_call_bytes.reserve(CapacityOr(config.call_bytes_capacity, kDefaultCallBytes));
+
+		const bool dense = (config.flags & BRIDGE_CORE_FLAG_DENSE_OPCODES) != 0;
+		core.streams[0].SetDenseOpcodes(dense);
+		core.streams[1].SetDenseOpcodes(dense);
+	}
+
+	// 把一段 BridgeCallCoreHeader + payload 序列整体交给业务层（一次虚调用，逐条解析由 App 完成）。
+	static void DispatchCalls(bridge::ICoreApp& app, bridge::CoreContext& ctx, const uint8_t* bytes, size_t len)
+	{
+		if (bytes && len > 0)
+		{
+			app.OnCallsCore(ctx, bytes, static_cast<uint32_t>(len));
+		}
+	}
+
+	// 预编码调用序列的格式校验：每条 header + 补齐后的 payload 都必须完整落在 [calls, calls+len) 内。
+	static bool IsValidCallBuffer(const void* calls, uint32_t len)
+	{
+		if (len == 0)
+		{
+			return true;
+		}
+		if (!calls || (len & 7u) != 0)
+		{
+			return false;
+		}
+
+		const auto* bytes = static_cast<const uint8_t*>(calls);
+		uint32_t offset = 0;
+		while (offset < len)
+		{
+			if (len - offset < sizeof(BridgeCallCoreHeader))
+			{
+				return false;
+			}
+			BridgeCallCoreHeader hdr{};
+			std::memcpy(&hdr, bytes + offset, sizeof(hdr));
+			offset += static_cast<uint32_t>(sizeof(hdr));
+
+			const uint64_t aligned = (static_cast<uint64_t>(hdr.payload_size) + 7u) & ~uint64_t{7};
+			if (aligned > len - offset)
+			{
+				return false;
+			}
+			offset += static_cast<uint32_t>(aligned);
+		}
+		return true;
+	}
 }
 
 namespace bridge
 {
 	CoreContext::CoreContext(BridgeCore& core)
-		: core_(core)
+		: core_(core), cursor_(&core.Commands().Cursor()), trace_id_(core.trace_enabled ? core.trace_id : 0)
 	{
 	}
 
@@ -39,9 +143,54 @@ namespace bridge
 		return core_.next_request_id++;
 	}
 
-	BridgeStringView CoreContext::StoreUtf8(std::string utf8)
+	BridgeStringView CoreContext::StoreUtf8(std::string_view utf8)
 	{
-		return core_.commands.StoreUtf8(std::move(utf8));
+		core_.stats.OnStringStored(utf8.size());
+		const BridgeStringView view = core_.Commands().StoreUtf8(utf8);
+		if (core_.recorder)
+		{
+			core_.recorder->OnStringStored(view);
+		}
+		return view;
+	}
+
+	BridgeStringId CoreContext::InternUtf8(std::string_view utf8)
+	{
+		if (utf8.empty())
+		{
+			return 0;
+		}
+
+		auto it = core_.interned_strings.find(utf8);
+		if (it != core_.interned_strings.end())
+		{
+			return it->second;
+		}
+
+		std::string_view stored;
+		const BridgeStringId id = StringInterner::Instance().Intern(utf8, &stored);
+		core_.interned_strings.emplace(stored, id);
+
+		// 本 core 首次使用：先宣告，保证 Host 在解析到引用该 id 的命令之前已拿到内容。
+		BridgeCmdDefineString cmd{};
+		cmd.header.type = BRIDGE_CMD_DEFINE_STRING;
+		cmd.header.size = static_cast<uint16_t>(sizeof(cmd));
+		cmd.id = id;
+		cmd.utf8.ptr = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(stored.data()));
+		cmd.utf8.len = static_cast<uint32_t>(stored.size());
+		core_.Commands().Push(cmd);
+		core_.stats.OnStringDefined();
+		return id;
+	}
+
+	TransformStore& CoreContext::Transforms()
+	{
+		return core_.transforms;
+	}
+
+	bool CoreContext::RequestSharedAsset(BridgeAssetType assetType, std::string_view key, uint64_t requestId)
+	{
+		return core_.assets.Request(assetType, key, requestId);
 	}
 
 	void CoreContext::CallHost(uint32_t funcId, const void* payload, uint32_t payloadSize)
@@ -51,34 +200,64 @@ namespace bridge
 			return;
 		}
 
-		const uint32_t totalSize = static_cast<uint32_t>(sizeof(BridgeCmdCallHost)) + payloadSize;
-		const uint32_t alignedTotal = Align8(totalSize);
-		if (alignedTotal > UINT16_MAX)
+		const uint32_t stride = Align8(payloadSize);
+		if (sizeof(BridgeCmdCallHost) + stride > UINT16_MAX)
 		{
 			return;
 		}
 
-		BridgeCmdCallHost cmd{};
-		cmd.header.type = BRIDGE_CMD_CALL_HOST;
-		cmd.header.size = static_cast<uint16_t>(alignedTotal);
-		cmd.func_id = funcId;
+		uint8_t* dst = core_.Commands().AllocateCall(funcId, stride);
+		core_.stats.OnHostCall(funcId, stride);
+		// stream 分配的字节未初始化：复制 payload，只清零补齐部分。
+		if (payloadSize > 0)
+		{
+			std::memcpy(dst, payload, payloadSize);
+		}
+		std::memset(dst + payloadSize, 0, stride - payloadSize);
+	}
+
+	void CoreContext::CallHostCoalesced(uint32_t funcId, uint64_t key, const void* payload, uint32_t payloadSize)
+	{
+		if (payloadSize > 0 && !payload)
+		{
+			return;
+		}
 
-		uint8_t* dst = core_.commands.Allocate(static_cast<size_t>(alignedTotal));
-		if (!dst)
+		const uint32_t stride = Align8(payloadSize);
+		if (sizeof(BridgeCmdCallHost) + stride > UINT16_MAX)
 		{
 			return;
 		}
 
-		std::memcpy(dst, &cmd, sizeof(cmd));
+		// 同 CallHost：复制 payload，只清零补齐部分（覆盖旧调用时也写全 stride 字节）。
+		uint8_t* dst = AllocateCallCoalesced(funcId, key, stride, 0);
 		if (payloadSize > 0)
 		{
-			std::memcpy(dst + sizeof(cmd), payload, payloadSize);
+			std::memcpy(dst, payload, payloadSize);
 		}
-		const uint32_t pad = alignedTotal - static_cast<uint32_t>(sizeof(cmd)) - payloadSize;
-		if (pad > 0)
+		std::memset(dst + payloadSize, 0, stride - payloadSize);
+	}
+
+	uint8_t* CoreContext::AllocateCall(uint32_t funcId, uint32_t stride, uint16_t opcode)
+	{
+		core_.stats.OnHostCall(funcId, stride);
+		return core_.Commands().AllocateCall(funcId, stride, opcode);
+	}
+
+	uint8_t* CoreContext::AllocateCallCoalesced(uint32_t funcId, uint64_t key, uint32_t stride, uint16_t opcode)
+	{
+#if BRIDGE_ENABLE_STATS
+		// 原地覆盖不产生新调用：只有 stream 变长时才计数。
+		const uint32_t before = core_.Commands().Size();
+		uint8_t* payload = core_.Commands().AllocateCallCoalesced(funcId, key, stride, opcode);
+		if (core_.Commands().Size() != before)
 		{
-			std::memset(dst + sizeof(cmd) + payloadSize, 0, pad);
+			core_.stats.OnHostCall(funcId, stride);
 		}
+#else
+		uint8_t* payload = core_.Commands().AllocateCallCoalesced(funcId, key, stride, opcode);
+#endif
+		return payload;
 	}
 
 	BridgeTransform CoreContext::IdentityTransform()
@@ -98,65 +277,344 @@ namespace bridge
 			BRIDGE_VERSION_PATCH};
 	}
 
+	// 业务层登记的 opcode 表（常量初始化，不受静态初始化顺序影响）。
+	static std::span<const BridgeHostOpcode> g_gameHostOpcodes;
+
+	void SetGameHostOpcodes(std::span<const BridgeHostOpcode> table)
+	{
+		g_gameHostOpcodes = table;
+	}
+
+	BridgeResult GetHostOpcodes(const BridgeHostOpcode** outEntries, uint32_t* outCount)
+	{
+		if (!outEntries || !outCount)
+		{
+			return BRIDGE_INVALID_ARGUMENT;
+		}
+		*outEntries = g_gameHostOpcodes.data();
+		*outCount = static_cast<uint32_t>(g_gameHostOpcodes.size());
+		return BRIDGE_OK;
+	}
+
 	BridgeCore* CreateCore(BridgeCoreConfig config)
 	{
-		auto* core = new BridgeCore();
-		core->config = config;
-		core->commands.Reserve(/*commandBytesCapacity*/ 1024, /*stringCountCapacity*/ 32);
-		core->pending_call_bytes.reserve(256);
-		core->app = CreateGameApp();
-		if (!core->app)
+		BridgeCore* core = nullptr;
+		return CreateCores(&config, 1, &core) == BRIDGE_OK ? core : nullptr;
+	}
+
+	// 在一块 slab 上构造 count 个 core 并按各自 config 预留缓冲；业务层 App 由调用方创建。
+	static void ConstructCores(const BridgeCoreConfig* configs, uint32_t count, BridgeCore** outCores)
+	{
+		static_assert(alignof(BridgeCore) <= kSlabAlign, "BridgeCore must fit the slab alignment");
+
+		// 布局：[CoreSlab][core 0][core 1]...[core n-1][缓冲区域 0][缓冲区域 1]...
+		const size_t headerBytes = AlignSlab(sizeof(CoreSlab));
+		const size_t coreStride = AlignSlab(sizeof(BridgeCore));
+		size_t totalBytes = headerBytes + coreStride * count;
+		for (uint32_t i = 0; i < count; i++)
 		{
-			delete core;
-			return nullptr;
+			totalBytes += BufferRegionBytes(configs[i]);
+		}
+
+		auto* base = static_cast<uint8_t*>(::operator new(totalBytes, std::align_val_t{kSlabAlign}));
+		auto* slab = new (base) CoreSlab();
+		slab->live_cores.store(count, std::memory_order_relaxed);
+
+		uint8_t* region = base + headerBytes + coreStride * count;
+		for (uint32_t i = 0; i < count; i++)
+		{
+			auto* core = new (base + headerBytes + coreStride * i) BridgeCore();
+			core->slab = slab;
+			const size_t regionBytes = BufferRegionBytes(configs[i]);
+			core->buffers.Assign(region, regionBytes);
+			region += regionBytes;
+
+			core->config = configs[i];
+			core->trace_id = AllocTraceId();
+			InitBuffers(*core);
+			outCores[i] = core;
+		}
+	}
+
+	static void DestroyCores(BridgeCore** cores, uint32_t count)
+	{
+		for (uint32_t i = 0; i < count; i++)
+		{
+			DestroyCore(cores[i]);
+			cores[i] = nullptr;
 		}
-		return core;
+	}
+
+	BridgeResult CreateCores(const BridgeCoreConfig* configs, uint32_t count, BridgeCore** outCores)
+	{
+		ConstructCores(configs, count, outCores);
+		for (uint32_t i = 0; i < count; i++)
+		{
+			outCores[i]->app = CreateGameApp();
+			if (!outCores[i]->app)
+			{
+				DestroyCores(outCores, count);
+				return BRIDGE_ERROR;
+			}
+		}
+		return BRIDGE_OK;
+	}
+
+	BridgeResult CloneCores(const BridgeCore& source, const uint64_t* seeds, uint32_t count, BridgeCore** outCores)
+	{
+		// 副本按模板当前（已预热）的容量预留缓冲，首帧不必再扩容。
+		BridgeCoreConfig config = source.config;
+		const auto warmed = [](uint32_t configured, uint32_t fallback, size_t current) {
+			return static_cast<uint32_t>(std::min<size_t>(std::max<size_t>(CapacityOr(configured, fallback), current), UINT32_MAX));
+		};
+		config.command_bytes_capacity = warmed(config.command_bytes_capacity, kDefaultCommandBytes,
+			std::max(source.streams[0].CommandCapacity(), source.streams[1].CommandCapacity()));
+		config.string_bytes_capacity = warmed(config.string_bytes_capacity, kDefaultStringBytes,
+			std::max(source.streams[0].StringCapacity(), source.streams[1].StringCapacity()));
+		config.call_bytes_capacity = warmed(config.call_bytes_capacity, kDefaultCallBytes, source.pending_call_bytes.capacity());
+
+		std::vector<BridgeCoreConfig> configs(count, config);
+		for (uint32_t i = 0; i < count; i++)
+		{
+			configs[i].seed = seeds[i];
+		}
+
+		ConstructCores(configs.data(), count, outCores);
+		for (uint32_t i = 0; i < count; i++)
+		{
+			BridgeCore& core = *outCores[i];
+			core.app = source.app->Clone(seeds[i]);
+			if (!core.app)
+			{
+				DestroyCores(outCores, count);
+				return BRIDGE_ERROR;
+			}
+			// App 中记下的 request id 仍需匹配 Host 的回执；tick_count 让副本上的录制不被当作从创建开始。
+			core.next_request_id = source.next_request_id;
+			core.tick_count = source.tick_count;
+			// 副本挂到同一个共享缓存，模板进行中的请求改为等待（Host 只会回执模板本身）。
+			core.assets.CopyFrom(source.assets);
+			// App 中的 TransformHandle 指向这里的槽位，与 App 一起复制（含本帧未输出的变化与命令绑定）。
+			core.transforms = source.transforms;
+		}
+		return BRIDGE_OK;
 	}
 
 	void DestroyCore(BridgeCore* core)
 	{
-		delete core;
+		if (!core)
+		{
+			return;
+		}
+
+		CoreSlab* slab = core->slab;
+		core->~BridgeCore();
+		if (slab->live_cores.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			slab->~CoreSlab();
+			::operator delete(slab, std::align_val_t{kSlabAlign});
+		}
+	}
+
+	BridgeResult ResetCore(BridgeCore& core, BridgeCoreConfig config)
+	{
+		// Host 仍持有的 stream 不能被清空。
+		if (core.stream_held[0].load(std::memory_order_acquire) || core.stream_held[1].load(std::memory_order_acquire))
+		{
+			return BRIDGE_ERROR;
+		}
+
+		// 先创建新的业务层：失败时 core 保持原状。
+		std::unique_ptr<ICoreApp> app = CreateGameApp();
+		if (!app)
+		{
+			return BRIDGE_ERROR;
+		}
+
+		core.recorder.reset();
+		core.config = config;
+		core.next_request_id = 1;
+
+		core.streams[0].Clear();
+		core.streams[1].Clear();
+		core.current_stream = 0;
+		core.held_frame[0] = 0;
+		core.held_frame[1] = 0;
+		core.frame_index = 0;
+
+		core.pending_call_bytes.clear();
+		core.call_buffer_acquired = false;
+		core.acquired_offset = 0;
+		core.concurrent_calls.Drain([](const uint8_t*, size_t) {});
+
+		// 新一局的 Host 视图从空开始：驻留字符串在首次使用时重新宣告。
+		core.interned_strings.clear();
+		// 上一局的共享资源请求作废（仍挂在原缓存上）。
+		core.assets.Abandon();
+		// 实体随上一局一起销毁；命令绑定属于旧 App，新 App 需重新绑定。
+		core.transforms.Clear();
+		core.transforms.BindCommands(nullptr, nullptr);
+		core.stats.Reset();
+		core.trace_enabled = false;
+		core.tick_count = 0;
+
+		// 新配置可能要求更大的缓冲、双缓冲或稠密 opcode；已有容量保留。
+		InitBuffers(core);
+		core.app = std::move(app);
+		return BRIDGE_OK;
 	}
 
-	void Tick(BridgeCore& core, float dt)
+	bool Tick(BridgeCore& core, float dt, ByteBuffer* arena)
 	{
+		// 双缓冲：写入另一个 stream，上一帧的 stream 保持有效直到 Host 归还（group arena 模式不参与）。
+		const bool doubleBuffered = !arena && (core.config.flags & BRIDGE_CORE_FLAG_DOUBLE_BUFFERED) != 0;
+		if (doubleBuffered)
+		{
+			const uint32_t next = core.current_stream ^ 1u;
+			if (core.stream_held[next].load(std::memory_order_acquire))
+			{
+				return false;
+			}
+			core.current_stream = next;
+		}
+
 		// Per-frame command buffer. Data pointers become invalid after Clear().
-		core.commands.Clear();
+		core.Commands().Clear();
+		if (arena)
+		{
+			core.Commands().BeginExternal(*arena);
+		}
 
 		CoreContext ctx(core);
+		core.stats.BeginFrame();
+
+		const uint32_t traceId = ctx.TraceId();
+		if (traceId != 0)
+		{
+			TraceBegin("Core::Tick", traceId);
+		}
+
+		// 未提交的预留区域视为放弃。
+		if (core.call_buffer_acquired)
+		{
+			core.pending_call_bytes.resize(core.acquired_offset);
+			core.call_buffer_acquired = false;
+		}
 
 		// 先分发 Host->Core 调用，再跑本帧逻辑。
-		const uint8_t* cur = core.pending_call_bytes.data();
-		size_t remaining = core.pending_call_bytes.size();
-		while (cur && remaining >= sizeof(PendingCallHeader))
 		{
-			PendingCallHeader hdr{};
-			std::memcpy(&hdr, cur, sizeof(hdr));
-			cur += sizeof(hdr);
-			remaining -= sizeof(hdr);
+			TraceZone zone(traceId, "Core::DispatchCalls");
 
-			if (hdr.payload_size > remaining)
+			const auto dispatch = [&](const uint8_t* bytes, size_t len) {
+				core.stats.OnInboundCalls(bytes, len);
+				if (core.recorder)
+				{
+					core.recorder->OnInbound(bytes, len);
+				}
+				if (core.assets.HasOwned())
+				{
+					core.assets.OnInbound(bytes, len);
+				}
+				DispatchCalls(*core.app, ctx, bytes, len);
+			};
+
+			// 共享缓存转来的结果单独写入 shared_call_bytes，排在 Host 推送的调用之前分发（与之一起统计、录制）。
+			if (core.assets.HasWaiting() && core.assets.Deliver(core.shared_call_bytes, core.stats) != 0)
 			{
-				break;
+				dispatch(core.shared_call_bytes.data(), core.shared_call_bytes.size());
+				core.shared_call_bytes.clear();
 			}
 
-			const void* payload = cur;
-			cur += hdr.payload_size;
-			remaining -= hdr.payload_size;
+			if (core.config.flags & BRIDGE_CORE_FLAG_CONCURRENT_CALLS)
+			{
+				if (!core.pending_call_bytes.empty())
+				{
+					dispatch(core.pending_call_bytes.data(), core.pending_call_bytes.size());
+					core.pending_call_bytes.clear();
+				}
+				core.concurrent_calls.Drain(dispatch);
+			}
+			else
+			{
+				dispatch(core.pending_call_bytes.data(), core.pending_call_bytes.size());
+				core.pending_call_bytes.clear();
+			}
+		}
 
-			const uint32_t pad = Align8(hdr.payload_size) - hdr.payload_size;
-			if (pad > remaining)
+		{
+			TraceZone zone(traceId, "App::Tick");
+			core.app->Tick(ctx, std::max(0.0f, dt));
+			if (core.transforms.HasDirty())
 			{
-				break;
+				core.transforms.Flush(ctx);
 			}
-			cur += pad;
-			remaining -= pad;
+		}
 
-			core.app->OnCallCore(ctx, hdr.func_id, payload, hdr.payload_size);
+		if (arena)
+		{
+			core.Commands().EndExternal();
+		}
+		core.stats.EndFrame(core.Commands().Size(), core.Commands().TakeGrowCount());
+		if (core.recorder)
+		{
+			core.recorder->EndFrame(dt, core.Commands().Data(), core.Commands().Size());
+		}
+		core.tick_count++;
+		if (traceId != 0)
+		{
+			TraceEnd("Core::Tick", traceId, core.Commands().Size());
 		}
-		core.pending_call_bytes.clear();
 
-		core.app->Tick(ctx, std::max(0.0f, dt));
+		if (doubleBuffered)
+		{
+			core.held_frame[core.current_stream] = ++core.frame_index;
+			core.stream_held[core.current_stream].store(true, std::memory_order_release);
+		}
+		return true;
+	}
+
+	void TickToStream(BridgeCore* core, float dt, BridgeCommandStream& out)
+	{
+		out.reserved0 = 0;
+		if (!core)
+		{
+			out.ptr = nullptr;
+			out.len = 0;
+			return;
+		}
+
+		if (!Tick(*core, dt))
+		{
+			out.ptr = nullptr;
+			out.len = 0;
+			return;
+		}
+		out.ptr = core->Commands().Data();
+		out.len = core->Commands().Size();
+	}
+
+	BridgeResult TickMany(BridgeCore** cores, uint32_t count, float dt, BridgeCommandStream* outStreams, BridgeCoreGroup* group)
+	{
+		return TickWorkerPool::Instance().TickMany(cores, count, dt, outStreams, group) ? BRIDGE_OK : BRIDGE_ERROR;
+	}
+
+	BridgeResult SetTickWorkerCount(uint32_t workerCount)
+	{
+		if (workerCount > kMaxTickWorkers)
+		{
+			return BRIDGE_INVALID_ARGUMENT;
+		}
+		return TickWorkerPool::Instance().SetWorkerCount(workerCount) ? BRIDGE_OK : BRIDGE_ERROR;
+	}
+
+	BridgeResult TickManyBegin(BridgeCore** cores, uint32_t count, float dt, BridgeCommandStream* outStreams)
+	{
+		return TickWorkerPool::Instance().BeginTickMany(cores, count, dt, outStreams) ? BRIDGE_OK : BRIDGE_ERROR;
+	}
+
+	void PollCompletedShards(BridgeTickShard* outShards, uint32_t capacity, uint32_t* outCount, uint32_t* outRemaining)
+	{
+		TickWorkerPool::Instance().PollCompleted(outShards, capacity, outCount, outRemaining);
 	}
 
 	BridgeResult GetCommandStream(
@@ -169,8 +627,33 @@ namespace bridge
 			return BRIDGE_INVALID_ARGUMENT;
 		}
 
-		*out_ptr = core.commands.Data();
-		*out_len = core.commands.Size();
+		*out_ptr = core.Commands().Data();
+		*out_len = core.Commands().Size();
+		return BRIDGE_OK;
+	}
+
+	BridgeResult ReleaseStream(BridgeCore& core)
+	{
+		if ((core.config.flags & BRIDGE_CORE_FLAG_DOUBLE_BUFFERED) == 0)
+		{
+			return BRIDGE_OK;
+		}
+
+		// 归还最早的一帧。Tick 只会改写未被持有的 stream，因此这里读 held_frame 不会与之竞争。
+		int oldest = -1;
+		for (int i = 0; i < 2; i++)
+		{
+			if (core.stream_held[i].load(std::memory_order_acquire) &&
+				(oldest < 0 || core.held_frame[i] < core.held_frame[oldest]))
+			{
+				oldest = i;
+			}
+		}
+		if (oldest < 0)
+		{
+			return BRIDGE_ERROR;
+		}
+		core.stream_held[oldest].store(false, std::memory_order_release);
 		return BRIDGE_OK;
 	}
 
@@ -180,14 +663,25 @@ namespace bridge
 		{
 			return BRIDGE_INVALID_ARGUMENT;
 		}
+		if (core.config.flags & BRIDGE_CORE_FLAG_CONCURRENT_CALLS)
+		{
+			core.concurrent_calls.Push(funcId, payload, payloadSize);
+			return BRIDGE_OK;
+		}
+		if (core.call_buffer_acquired)
+		{
+			return BRIDGE_ERROR;
+		}
 
-		PendingCallHeader hdr{};
+		BridgeCallCoreHeader hdr{};
 		hdr.func_id = funcId;
 		hdr.payload_size = payloadSize;
 
 		const size_t oldSize = core.pending_call_bytes.size();
+		const size_t oldCapacity = core.pending_call_bytes.capacity();
 		const uint32_t alignedPayload = Align8(payloadSize);
 		core.pending_call_bytes.resize(oldSize + sizeof(hdr) + alignedPayload);
+		core.stats.OnCallBufferAppend(oldCapacity, core.pending_call_bytes.capacity());
 
 		std::memcpy(core.pending_call_bytes.data() + oldSize, &hdr, sizeof(hdr));
 		if (payloadSize > 0)
@@ -200,4 +694,249 @@ namespace bridge
 		}
 		return BRIDGE_OK;
 	}
+
+	BridgeResult PushCallsCore(BridgeCore& core, const void* calls, uint32_t len)
+	{
+		if (!IsValidCallBuffer(calls, len))
+		{
+			return BRIDGE_INVALID_ARGUMENT;
+		}
+		if (core.config.flags & BRIDGE_CORE_FLAG_CONCURRENT_CALLS)
+		{
+			core.concurrent_calls.PushEncoded(calls, len);
+			return BRIDGE_OK;
+		}
+		if (core.call_buffer_acquired)
+		{
+			return BRIDGE_ERROR;
+		}
+		if (len > 0)
+		{
+			const auto* bytes = static_cast<const uint8_t*>(calls);
+			const size_t oldCapacity = core.pending_call_bytes.capacity();
+			core.pending_call_bytes.insert(core.pending_call_bytes.end(), bytes, bytes + len);
+			core.stats.OnCallBufferAppend(oldCapacity, core.pending_call_bytes.capacity());
+		}
+		return BRIDGE_OK;
+	}
+
+	BridgeResult PushCallsMany(BridgeCore** cores, const BridgeCallBuffer* buffers, uint32_t count)
+	{
+		for (uint32_t i = 0; i < count; i++)
+		{
+			if (!cores[i] || !IsValidCallBuffer(buffers[i].ptr, buffers[i].len))
+			{
+				return BRIDGE_INVALID_ARGUMENT;
+			}
+			if (cores[i]->call_buffer_acquired)
+			{
+				return BRIDGE_ERROR;
+			}
+		}
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			if (buffers[i].len == 0)
+			{
+				continue;
+			}
+			if (cores[i]->config.flags & BRIDGE_CORE_FLAG_CONCURRENT_CALLS)
+			{
+				cores[i]->concurrent_calls.PushEncoded(buffers[i].ptr, buffers[i].len);
+				continue;
+			}
+			const auto* bytes = static_cast<const uint8_t*>(buffers[i].ptr);
+			const size_t oldCapacity = cores[i]->pending_call_bytes.capacity();
+			cores[i]->pending_call_bytes.insert(cores[i]->pending_call_bytes.end(), bytes, bytes + buffers[i].len);
+			cores[i]->stats.OnCallBufferAppend(oldCapacity, cores[i]->pending_call_bytes.capacity());
+		}
+		return BRIDGE_OK;
+	}
+
+	BridgeResult AcquireCallBuffer(BridgeCore& core, uint32_t bytes, void** outPtr)
+	{
+		// 并发模式下待分发缓冲不归 Host 线程独占，无法就地预留。
+		if (core.call_buffer_acquired || (core.config.flags & BRIDGE_CORE_FLAG_CONCURRENT_CALLS))
+		{
+			return BRIDGE_ERROR;
+		}
+		// 补齐到 8 字节后会超出 uint32_t（Align8 回绕为 0）。
+		if (bytes > UINT32_MAX - 7u)
+		{
+			return BRIDGE_INVALID_ARGUMENT;
+		}
+
+		// 已有内容总是 8 字节的整数倍，因此区域起点保持 8 字节对齐。
+		core.acquired_offset = core.pending_call_bytes.size();
+		const size_t oldCapacity = core.pending_call_bytes.capacity();
+		core.pending_call_bytes.resize(core.acquired_offset + Align8(bytes));
+		core.stats.OnCallBufferAppend(oldCapacity, core.pending_call_bytes.capacity());
+		core.call_buffer_acquired = true;
+		*outPtr = core.pending_call_bytes.data() + core.acquired_offset;
+		return BRIDGE_OK;
+	}
+
+	BridgeResult CommitCalls(BridgeCore& core, uint32_t bytesWritten)
+	{
+		if (!core.call_buffer_acquired)
+		{
+			return BRIDGE_ERROR;
+		}
+		core.call_buffer_acquired = false;
+
+		const size_t reserved = core.pending_call_bytes.size() - core.acquired_offset;
+		if (bytesWritten > reserved ||
+			!IsValidCallBuffer(core.pending_call_bytes.data() + core.acquired_offset, bytesWritten))
+		{
+			core.pending_call_bytes.resize(core.acquired_offset);
+			return BRIDGE_INVALID_ARGUMENT;
+		}
+		core.pending_call_bytes.resize(core.acquired_offset + bytesWritten);
+		return BRIDGE_OK;
+	}
+
+	BridgeResult GetStats(const BridgeCore& core, BridgeCoreStats* outStats)
+	{
+		if (!outStats)
+		{
+			return BRIDGE_INVALID_ARGUMENT;
+		}
+#if BRIDGE_ENABLE_STATS
+		*outStats = core.stats.Totals();
+		outStats->stream_capacity_bytes = core.streams[0].CapacityBytes() + core.streams[1].CapacityBytes();
+		outStats->call_buffer_capacity_bytes = core.pending_call_bytes.capacity();
+		return BRIDGE_OK;
+#else
+		(void)core;
+		*outStats = BridgeCoreStats{};
+		return BRIDGE_ERROR;
+#endif
+	}
+
+	BridgeResult GetStatsMany(BridgeCore** cores, uint32_t count, BridgeCoreStats* outPerCore, BridgeCoreStats* outTotal)
+	{
+		for (uint32_t i = 0; i < count; i++)
+		{
+			if (!cores[i])
+			{
+				return BRIDGE_INVALID_ARGUMENT;
+			}
+		}
+
+		BridgeCoreStats total{};
+		for (uint32_t i = 0; i < count; i++)
+		{
+			BridgeCoreStats s{};
+			GetStats(*cores[i], &s);
+			if (outPerCore)
+			{
+				outPerCore[i] = s;
+			}
+
+			total.frames += s.frames;
+			total.calls_emitted += s.calls_emitted;
+			total.bytes_emitted += s.bytes_emitted;
+			total.last_frame_calls += s.last_frame_calls;
+			total.last_frame_bytes += s.last_frame_bytes;
+			total.peak_frame_bytes = std::max(total.peak_frame_bytes, s.peak_frame_bytes);
+			total.strings_stored += s.strings_stored;
+			total.string_bytes_stored += s.string_bytes_stored;
+			total.strings_defined += s.strings_defined;
+			total.inbound_calls += s.inbound_calls;
+			total.inbound_bytes += s.inbound_bytes;
+			total.peak_inbound_bytes = std::max(total.peak_inbound_bytes, s.peak_inbound_bytes);
+			total.stream_reallocs += s.stream_reallocs;
+			total.call_buffer_reallocs += s.call_buffer_reallocs;
+			total.stream_capacity_bytes += s.stream_capacity_bytes;
+			total.call_buffer_capacity_bytes += s.call_buffer_capacity_bytes;
+			total.last_tick_ns = std::max(total.last_tick_ns, s.last_tick_ns);
+			total.max_tick_ns = std::max(total.max_tick_ns, s.max_tick_ns);
+			total.func_count = std::max(total.func_count, s.func_count);
+		}
+		if (outTotal)
+		{
+			*outTotal = total;
+		}
+#if BRIDGE_ENABLE_STATS
+		return BRIDGE_OK;
+#else
+		return BRIDGE_ERROR;
+#endif
+	}
+
+	BridgeResult GetFuncStats(const BridgeCore& core, BridgeFuncStats* outEntries, uint32_t capacity, uint32_t* outCount)
+	{
+		if (!outCount || (capacity > 0 && !outEntries))
+		{
+			return BRIDGE_INVALID_ARGUMENT;
+		}
+#if BRIDGE_ENABLE_STATS
+		*outCount = core.stats.CopyFuncStats(outEntries, capacity);
+		return BRIDGE_OK;
+#else
+		(void)core;
+		*outCount = 0;
+		return BRIDGE_ERROR;
+#endif
+	}
+
+	BridgeResult ResetStats(BridgeCore& core)
+	{
+#if BRIDGE_ENABLE_STATS
+		core.stats.Reset();
+		return BRIDGE_OK;
+#else
+		(void)core;
+		return BRIDGE_ERROR;
+#endif
+	}
+
+	void SetTraceEnabled(BridgeCore** cores, uint32_t count, bool enabled)
+	{
+		for (uint32_t i = 0; i < count; i++)
+		{
+			if (cores[i])
+			{
+				cores[i]->trace_enabled = enabled;
+			}
+		}
+	}
+
+	void SetAssetCache(BridgeCore** cores, uint32_t count, BridgeAssetCache* cache)
+	{
+		for (uint32_t i = 0; i < count; i++)
+		{
+			if (cores[i])
+			{
+				cores[i]->assets.Attach(cache);
+			}
+		}
+	}
+
+	BridgeResult BeginRecording(BridgeCore& core, const char* path)
+	{
+		if (core.recorder)
+		{
+			return BRIDGE_ERROR;
+		}
+		auto recorder = std::make_unique<CoreRecorder>();
+		if (!recorder->Open(path, core.config, core.tick_count))
+		{
+			return BRIDGE_ERROR;
+		}
+		recorder->DeclareStrings(core.interned_strings);
+		core.recorder = std::move(recorder);
+		return BRIDGE_OK;
+	}
+
+	BridgeResult EndRecording(BridgeCore& core)
+	{
+		if (!core.recorder)
+		{
+			return BRIDGE_ERROR;
+		}
+		const bool ok = core.recorder->Close();
+		core.recorder.reset();
+		return ok ? BRIDGE_OK : BRIDGE_ERROR;
+	}
 }
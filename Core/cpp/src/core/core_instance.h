@@ -2,9 +2,18 @@
 
 #include <bridge/bridge.h>
 #include <bridge/runtime/core_app.h>
+#include <bridge/runtime/transform_store.h>
 
+#include "asset_cache.h"
 #include "command_stream.h"
+#include "core_recording.h"
+#include "core_slab.h"
+#include "core_stats.h"
+#include "trace_buffer.h"
+#include "inbound_call_queue.h"
+#include "string_interner.h"
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
 #include <vector>
@@ -12,27 +21,123 @@
 struct BridgeCore
 {
 	BridgeCoreConfig config{};
+
+	// 所属 slab 与本 core 在其中的初始缓冲区域（见 BridgeCore_CreateMany）；须先于下面的缓冲声明，最后析构。
+	bridge::CoreSlab* slab = nullptr;
+	bridge::BufferRegion buffers;
+
 	uint64_t next_request_id = 1;
 
-	bridge::CommandStream commands;
-	std::vector<uint8_t> pending_call_bytes;
+	// 命令缓冲：单缓冲模式只用 streams[0]；双缓冲模式下两个 stream 交替写入（见 BridgeCore_ReleaseStream）。
+	bridge::CommandStream streams[2];
+	uint32_t current_stream = 0;
+
+	// 双缓冲模式：streams[i] 已交给 Host 且尚未归还。由 Tick 线程置位，Host 的归还线程清除；
+	// held_frame[i] 在置位前写入，用于按帧顺序归还。
+	std::atomic<bool> stream_held[2]{};
+	uint64_t held_frame[2]{};
+	uint64_t frame_index = 0;
+
+	// Host->Core 待分发调用：BridgeCallCoreHeader + payload（8 字节补齐），下一次 Tick 开始时分发。
+	bridge::ByteBuffer pending_call_bytes;
+	// BridgeCore_AcquireCallBuffer 预留的区域：[acquired_offset, 末尾)，提交前不参与分发。
+	bool call_buffer_acquired = false;
+	size_t acquired_offset = 0;
+	// BRIDGE_CORE_FLAG_CONCURRENT_CALLS 模式下 Host->Core 调用走这里（任意线程推送，Tick 开始时取出）。
+	bridge::InboundCallQueue concurrent_calls;
+
+	// 已在本 core 的 stream 中宣告过的驻留字符串（跨 Tick 保留）。
+	bridge::CoreStringCache interned_strings;
+
+	// 共享资源请求（BridgeCore_SetAssetCache）：本 core 发出、等待回执的请求，与挂在其它 core 请求上的等待。
+	bridge::CoreAssetRequests assets;
+	// 共享缓存转来的结果（格式同 pending_call_bytes）：Tick 开始时先于 Host 推送的调用分发，随即清空。
+	bridge::ByteBuffer shared_call_bytes;
 
 	std::unique_ptr<bridge::ICoreApp> app;
+
+	// 业务层的 Transform 组件（CoreContext::Transforms）；脏实体在每次 App::Tick 之后输出。
+	bridge::TransformStore transforms;
+
+	// 运行时统计（BRIDGE_ENABLE_STATS=OFF 时为空类型）。
+	bridge::CoreStats stats;
+
+	// 帧追踪：trace_id 创建时分配（进程内唯一，导出时作为 args.core），trace_enabled 由 BridgeCore_SetTraceEnabled 设置。
+	uint32_t trace_id = 0;
+	bool trace_enabled = false;
+
+	// 已完成的 Tick 数（录制文件头的 start_tick）；recorder 非空表示正在录制（BridgeCore_BeginRecording）。
+	uint64_t tick_count = 0;
+	std::unique_ptr<bridge::CoreRecorder> recorder;
+
+	bridge::CommandStream& Commands() { return streams[current_stream]; }
+	const bridge::CommandStream& Commands() const { return streams[current_stream]; }
 };
 
 namespace bridge
 {
 	BridgeVersion GetVersion();
+	BridgeResult GetHostOpcodes(const BridgeHostOpcode** outEntries, uint32_t* outCount);
 
 	BridgeCore* CreateCore(BridgeCoreConfig config);
 	void DestroyCore(BridgeCore* core);
 
-	void Tick(BridgeCore& core, float dt);
+	// 在一块 slab 上创建 count 个 core（CreateCore 即 count = 1）；失败时 outCores 全部置为 null。
+	BridgeResult CreateCores(const BridgeCoreConfig* configs, uint32_t count, BridgeCore** outCores);
+
+	// 从已预热的 source 复制 count 个 core（副本 i 的 seed 为 seeds[i]，见 BridgeCore_CloneMany）。
+	// source 的 App 不支持克隆时返回 BRIDGE_ERROR，outCores 全部置为 null。
+	BridgeResult CloneCores(const BridgeCore& source, const uint64_t* seeds, uint32_t count, BridgeCore** outCores);
+
+	// 原地回收：换上新的 ICoreApp 并清空每局状态，保留缓冲（见 BridgeCore_Reset）。
+	BridgeResult ResetCore(BridgeCore& core, BridgeCoreConfig config);
+
+	// arena 非空时，本帧命令追加到该共享 arena（批量模式，见 core_group.h）。
+	// 双缓冲模式下若要写入的 stream 尚未被 Host 归还，则不推进并返回 false。
+	bool Tick(BridgeCore& core, float dt, ByteBuffer* arena = nullptr);
+
+	// Tick 单个 core，并把本帧 stream 写入 out（core 为 null 时写入空 stream）。
+	void TickToStream(BridgeCore* core, float dt, BridgeCommandStream& out);
+
+	// 批量 Tick：未开启 worker 池时在调用线程串行执行，否则交给 TickWorkerPool 并行执行。
+	// group 非空时，所有命令写入 group 的连续 arena（见 core_group.h）。
+	BridgeResult TickMany(BridgeCore** cores, uint32_t count, float dt, BridgeCommandStream* outStreams, BridgeCoreGroup* group = nullptr);
+	BridgeResult SetTickWorkerCount(uint32_t workerCount);
+
+	// 异步批量 Tick：Begin 立即返回，PollCompletedShards 按 shard 交还已完成的 streams。
+	BridgeResult TickManyBegin(BridgeCore** cores, uint32_t count, float dt, BridgeCommandStream* outStreams);
+	void PollCompletedShards(BridgeTickShard* outShards, uint32_t capacity, uint32_t* outCount, uint32_t* outRemaining);
 
 	BridgeResult GetCommandStream(
 		const BridgeCore& core,
 		const void** out_ptr,
 		uint32_t* out_len);
 
+	BridgeResult ReleaseStream(BridgeCore& core);
+
 	BridgeResult PushCallCore(BridgeCore& core, uint32_t funcId, const void* payload, uint32_t payloadSize);
+
+	// 预编码调用序列（格式见 bridge.h 的 BridgeCallCoreHeader）：校验后一次性追加到 pending_call_bytes。
+	BridgeResult PushCallsCore(BridgeCore& core, const void* calls, uint32_t len);
+	BridgeResult PushCallsMany(BridgeCore** cores, const BridgeCallBuffer* buffers, uint32_t count);
+
+	// 零拷贝推送：在 pending_call_bytes 末尾预留区域，Host 写完后 Commit（校验并裁剪到实际大小）。
+	BridgeResult AcquireCallBuffer(BridgeCore& core, uint32_t bytes, void** outPtr);
+	BridgeResult CommitCalls(BridgeCore& core, uint32_t bytesWritten);
+
+	// 运行时统计（见 bridge.h 的 BridgeCoreStats）；未编译统计时返回 BRIDGE_ERROR。
+	BridgeResult GetStats(const BridgeCore& core, BridgeCoreStats* outStats);
+	BridgeResult GetStatsMany(BridgeCore** cores, uint32_t count, BridgeCoreStats* outPerCore, BridgeCoreStats* outTotal);
+	BridgeResult GetFuncStats(const BridgeCore& core, BridgeFuncStats* outEntries, uint32_t capacity, uint32_t* outCount);
+	BridgeResult ResetStats(BridgeCore& core);
+
+	// 帧追踪（见 bridge/runtime/trace.h）：开启后 Tick 记录 Core::Tick / Core::DispatchCalls / App::Tick 三个 zone。
+	void SetTraceEnabled(BridgeCore** cores, uint32_t count, bool enabled);
+
+	// 共享资源请求：把一批 core 挂到 cache（null 表示摘下），换挂时已有的请求作废。
+	void SetAssetCache(BridgeCore** cores, uint32_t count, BridgeAssetCache* cache);
+
+	// 录制（格式见 bridge.h 的 BridgeRecordingHeader）：Tick 结束时追加本帧 dt、已分发的调用与 stream。
+	BridgeResult BeginRecording(BridgeCore& core, const char* path);
+	BridgeResult EndRecording(BridgeCore& core);
 }
@@ -0,0 +1,433 @@
+#include "core_recording.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string_view>
+#include <utility>
+
+#if defined(_WIN32)
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+	#include <windows.h>
+
+	#include <string>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+namespace
+{
+	static uint64_t Align8(uint64_t x)
+	{
+		return (x + 7u) & ~uint64_t{7};
+	}
+
+#if defined(_WIN32)
+	// path 为 UTF-8：Windows 上转成 UTF-16 再调用宽字符 API。
+	static std::wstring WidenUtf8(const char* path)
+	{
+		const int len = MultiByteToWideChar(CP_UTF8, 0, path, -1, nullptr, 0);
+		if (len <= 0)
+		{
+			return std::wstring();
+		}
+		std::wstring wide(static_cast<size_t>(len), L'\0');
+		MultiByteToWideChar(CP_UTF8, 0, path, -1, wide.data(), len);
+		wide.resize(static_cast<size_t>(len - 1));
+		return wide;
+	}
+
+	static std::FILE* OpenForWrite(const char* path)
+	{
+		const std::wstring wide = WidenUtf8(path);
+		return wide.empty() ? nullptr : _wfopen(wide.c_str(), L"wb");
+	}
+
+	static bool MapFile(const char* path, BridgeRecording& rec)
+	{
+		const std::wstring wide = WidenUtf8(path);
+		if (wide.empty())
+		{
+			return false;
+		}
+		HANDLE file = CreateFileW(wide.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+		{
+			return false;
+		}
+		LARGE_INTEGER size{};
+		if (!GetFileSizeEx(file, &size) || size.QuadPart <= 0)
+		{
+			CloseHandle(file);
+			return false;
+		}
+		// 写时复制：打开时就地改写字符串指针，不影响磁盘上的文件。
+		HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+		CloseHandle(file);
+		if (!mapping)
+		{
+			return false;
+		}
+		void* view = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+		if (!view)
+		{
+			CloseHandle(mapping);
+			return false;
+		}
+		rec.base = static_cast<uint8_t*>(view);
+		rec.size = static_cast<size_t>(size.QuadPart);
+		rec.mapping = mapping;
+		return true;
+	}
+
+	static void UnmapFile(BridgeRecording& rec)
+	{
+		if (rec.base)
+		{
+			UnmapViewOfFile(rec.base);
+			CloseHandle(rec.mapping);
+		}
+		rec.base = nullptr;
+		rec.mapping = nullptr;
+	}
+#else
+	static std::FILE* OpenForWrite(const char* path)
+	{
+		return std::fopen(path, "wb");
+	}
+
+	static bool MapFile(const char* path, BridgeRecording& rec)
+	{
+		const int fd = open(path, O_RDONLY);
+		if (fd < 0)
+		{
+			return false;
+		}
+		struct stat st{};
+		if (fstat(fd, &st) != 0 || st.st_size <= 0)
+		{
+			close(fd);
+			return false;
+		}
+		// 写时复制：打开时就地改写字符串指针，不影响磁盘上的文件。
+		void* view = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+		close(fd);
+		if (view == MAP_FAILED)
+		{
+			return false;
+		}
+		rec.base = static_cast<uint8_t*>(view);
+		rec.size = static_cast<size_t>(st.st_size);
+		return true;
+	}
+
+	static void UnmapFile(BridgeRecording& rec)
+	{
+		if (rec.base)
+		{
+			munmap(rec.base, rec.size);
+		}
+		rec.base = nullptr;
+	}
+#endif
+
+	// 校验全部帧记录并改写字符串指针。末尾不完整的帧记录（录制未正常结束）被忽略，其它不一致视为损坏。
+	static bool ParseFrames(BridgeRecording& rec)
+	{
+		if (rec.size < sizeof(BridgeRecordingHeader))
+		{
+			return false;
+		}
+		std::memcpy(&rec.header, rec.base, sizeof(rec.header));
+		if (rec.header.magic != BRIDGE_RECORDING_MAGIC || rec.header.format_version != BRIDGE_RECORDING_FORMAT_VERSION)
+		{
+			return false;
+		}
+
+		const uint32_t expected = rec.header.frame_count;
+		size_t offset = sizeof(BridgeRecordingHeader);
+		while (rec.size - offset >= sizeof(BridgeRecordedFrameHeader) && (expected == 0 || rec.frames.size() < expected))
+		{
+			BridgeRecordedFrameHeader fh{};
+			std::memcpy(&fh, rec.base + offset, sizeof(fh));
+			if (fh.size > rec.size - offset)
+			{
+				break;
+			}
+
+			const uint64_t relocBytes = Align8(static_cast<uint64_t>(fh.reloc_count) * sizeof(uint32_t));
+			const uint64_t need = sizeof(fh) + static_cast<uint64_t>(fh.inbound_len) + fh.stream_len + relocBytes + Align8(fh.string_len);
+			if (need != fh.size || (fh.inbound_len & 7u) != 0 || (fh.stream_len & 7u) != 0)
+			{
+				return false;
+			}
+
+			uint8_t* inbound = rec.base + offset + sizeof(fh);
+			uint8_t* stream = inbound + fh.inbound_len;
+			const auto* relocs = reinterpret_cast<const uint32_t*>(stream + fh.stream_len);
+			const uint64_t stringsBegin = static_cast<uint64_t>(stream + fh.stream_len + relocBytes - rec.base);
+			for (uint32_t i = 0; i < fh.reloc_count; i++)
+			{
+				const uint32_t field = relocs[i];
+				if ((field & 7u) != 0 || static_cast<uint64_t>(field) + sizeof(BridgeStringView) > fh.stream_len)
+				{
+					return false;
+				}
+				BridgeStringView view{};
+				std::memcpy(&view, stream + field, sizeof(view));
+				if (view.ptr < stringsBegin || view.len > fh.string_len || view.ptr - stringsBegin > fh.string_len - view.len)
+				{
+					return false;
+				}
+				view.ptr += static_cast<uint64_t>(reinterpret_cast<uintptr_t>(rec.base));
+				std::memcpy(stream + field, &view, sizeof(view));
+			}
+
+			BridgeRecordedFrame frame{};
+			frame.dt = fh.dt;
+			frame.reloc_count = fh.reloc_count;
+			frame.inbound.ptr = fh.inbound_len > 0 ? inbound : nullptr;
+			frame.inbound.len = fh.inbound_len;
+			frame.stream.ptr = fh.stream_len > 0 ? stream : nullptr;
+			frame.stream.len = fh.stream_len;
+			frame.relocs = fh.reloc_count > 0 ? relocs : nullptr;
+			rec.frames.push_back(frame);
+
+			offset += fh.size;
+		}
+
+		if (expected != 0 && rec.frames.size() != expected)
+		{
+			return false;
+		}
+		rec.header.frame_count = static_cast<uint32_t>(rec.frames.size());
+		return true;
+	}
+}
+
+namespace bridge
+{
+	CoreRecorder::~CoreRecorder()
+	{
+		Close();
+	}
+
+	bool CoreRecorder::Open(const char* path, const BridgeCoreConfig& config, uint64_t startTick)
+	{
+		file_ = OpenForWrite(path);
+		if (!file_)
+		{
+			return false;
+		}
+
+		BridgeRecordingHeader header{};
+		header.magic = BRIDGE_RECORDING_MAGIC;
+		header.format_version = BRIDGE_RECORDING_FORMAT_VERSION;
+		header.config = config;
+		header.start_tick = startTick;
+		header.runtime_version = BridgeVersion{BRIDGE_VERSION_MAJOR, BRIDGE_VERSION_MINOR, BRIDGE_VERSION_PATCH};
+		Write(&header, sizeof(header));
+		return !failed_;
+	}
+
+	void CoreRecorder::DeclareStrings(const CoreStringCache& strings)
+	{
+		std::vector<std::pair<BridgeStringId, std::string_view>> sorted;
+		sorted.reserve(strings.size());
+		for (const auto& [utf8, id] : strings)
+		{
+			sorted.emplace_back(id, utf8);
+		}
+		std::sort(sorted.begin(), sorted.end());
+
+		preamble_.resize(sorted.size() * sizeof(BridgeCmdDefineString));
+		for (size_t i = 0; i < sorted.size(); i++)
+		{
+			BridgeCmdDefineString cmd{};
+			cmd.header.type = BRIDGE_CMD_DEFINE_STRING;
+			cmd.header.size = static_cast<uint16_t>(sizeof(cmd));
+			cmd.id = sorted[i].first;
+			cmd.utf8.ptr = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(sorted[i].second.data()));
+			cmd.utf8.len = static_cast<uint32_t>(sorted[i].second.size());
+			std::memcpy(preamble_.data() + i * sizeof(cmd), &cmd, sizeof(cmd));
+		}
+	}
+
+	bool CoreRecorder::Close()
+	{
+		if (!file_)
+		{
+			return !failed_;
+		}
+
+		if (!failed_ &&
+			(std::fseek(file_, static_cast<long>(offsetof(BridgeRecordingHeader, frame_count)), SEEK_SET) != 0 ||
+				std::fwrite(&frame_count_, sizeof(frame_count_), 1, file_) != 1))
+		{
+			failed_ = true;
+		}
+		if (std::fclose(file_) != 0)
+		{
+			failed_ = true;
+		}
+		file_ = nullptr;
+		return !failed_;
+	}
+
+	void CoreRecorder::Write(const void* data, size_t len)
+	{
+		if (!failed_ && len > 0 && std::fwrite(data, 1, len, file_) != len)
+		{
+			failed_ = true;
+		}
+		file_size_ += len;
+	}
+
+	bool CoreRecorder::IsStored(const BridgeStringView& view) const
+	{
+		auto it = std::lower_bound(stored_.begin(), stored_.end(), view.ptr,
+			[](const BridgeStringView& s, uint64_t ptr) { return s.ptr < ptr; });
+		return it != stored_.end() && it->ptr == view.ptr && it->len == view.len;
+	}
+
+	void CoreRecorder::Relocate(uint32_t fieldOffset, const BridgeStringView& view)
+	{
+		// 先记录相对字符串区的偏移，帧记录布局确定后再加上字符串区在文件中的起点。
+		const uint64_t rel = strings_.size();
+		std::memcpy(stream_.data() + fieldOffset, &rel, sizeof(rel));
+		const auto* bytes = reinterpret_cast<const uint8_t*>(static_cast<uintptr_t>(view.ptr));
+		strings_.insert(strings_.end(), bytes, bytes + view.len);
+		relocs_.push_back(fieldOffset);
+	}
+
+	void CoreRecorder::EndFrame(float dt, const uint8_t* stream, uint32_t len)
+	{
+		if (!file_ || failed_)
+		{
+			inbound_.clear();
+			stored_.clear();
+			return;
+		}
+
+		// 补宣告的字符串按普通 DEFINE_STRING 处理（下面一并改写）。
+		stream_.assign(preamble_.begin(), preamble_.end());
+		stream_.insert(stream_.end(), stream, stream + len);
+		len = static_cast<uint32_t>(stream_.size());
+		preamble_.clear();
+		relocs_.clear();
+		strings_.clear();
+		std::sort(stored_.begin(), stored_.end(),
+			[](const BridgeStringView& a, const BridgeStringView& b) { return a.ptr < b.ptr; });
+
+		uint32_t offset = 0;
+		while (len - offset >= sizeof(BridgeCommandHeader))
+		{
+			BridgeCommandHeader hdr{};
+			std::memcpy(&hdr, stream_.data() + offset, sizeof(hdr));
+			if (hdr.size < sizeof(hdr) || hdr.size > len - offset)
+			{
+				break;
+			}
+
+			if (hdr.type == BRIDGE_CMD_DEFINE_STRING && hdr.size >= sizeof(BridgeCmdDefineString))
+			{
+				const uint32_t field = offset + static_cast<uint32_t>(offsetof(BridgeCmdDefineString, utf8));
+				BridgeStringView view{};
+				std::memcpy(&view, stream_.data() + field, sizeof(view));
+				if (view.len > 0)
+				{
+					Relocate(field, view);
+				}
+			}
+			else if (!stored_.empty())
+			{
+				// payload 布局由代码生成决定，Runtime 不知道字段位置：按 8 字节步长查找与本帧 StoreUtf8 结果
+				// (ptr, len) 完全一致的 BridgeStringView（ptr 是本帧字符串 arena 的地址，不会与普通数据巧合相等）。
+				for (uint32_t field = offset + 8; field + sizeof(BridgeStringView) <= offset + hdr.size; field += 8)
+				{
+					BridgeStringView view{};
+					std::memcpy(&view, stream_.data() + field, sizeof(view));
+					if (view.len > 0 && view.reserved0 == 0 && IsStored(view))
+					{
+						Relocate(field, view);
+						field += 8;
+					}
+				}
+			}
+			offset += hdr.size;
+		}
+
+		const uint64_t relocBytes = Align8(relocs_.size() * sizeof(uint32_t));
+		const uint64_t size = sizeof(BridgeRecordedFrameHeader) + inbound_.size() + stream_.size() + relocBytes + Align8(strings_.size());
+		if (size > UINT32_MAX)
+		{
+			failed_ = true;
+			inbound_.clear();
+			stored_.clear();
+			return;
+		}
+
+		const uint64_t stringsBegin = file_size_ + sizeof(BridgeRecordedFrameHeader) + inbound_.size() + stream_.size() + relocBytes;
+		for (uint32_t field : relocs_)
+		{
+			uint64_t ptr = 0;
+			std::memcpy(&ptr, stream_.data() + field, sizeof(ptr));
+			ptr += stringsBegin;
+			std::memcpy(stream_.data() + field, &ptr, sizeof(ptr));
+		}
+
+		BridgeRecordedFrameHeader fh{};
+		fh.size = static_cast<uint32_t>(size);
+		fh.dt = dt;
+		fh.inbound_len = static_cast<uint32_t>(inbound_.size());
+		fh.stream_len = len;
+		fh.reloc_count = static_cast<uint32_t>(relocs_.size());
+		fh.string_len = static_cast<uint32_t>(strings_.size());
+
+		static const uint8_t kZeros[8] = {};
+		Write(&fh, sizeof(fh));
+		Write(inbound_.data(), inbound_.size());
+		Write(stream_.data(), stream_.size());
+		Write(relocs_.data(), relocs_.size() * sizeof(uint32_t));
+		Write(kZeros, relocBytes - relocs_.size() * sizeof(uint32_t));
+		Write(strings_.data(), strings_.size());
+		Write(kZeros, Align8(strings_.size()) - strings_.size());
+		frame_count_++;
+
+		inbound_.clear();
+		stored_.clear();
+	}
+
+	BridgeRecording* OpenRecording(const char* path)
+	{
+		auto rec = std::make_unique<BridgeRecording>();
+		if (!MapFile(path, *rec))
+		{
+			return nullptr;
+		}
+		if (!ParseFrames(*rec))
+		{
+			UnmapFile(*rec);
+			return nullptr;
+		}
+		return rec.release();
+	}
+
+	void CloseRecording(BridgeRecording* recording)
+	{
+		if (recording)
+		{
+			UnmapFile(*recording);
+			delete recording;
+		}
+	}
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <bridge/bridge.h>
+
+#include "string_interner.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+// 只读打开的录制文件（BridgeRecording_Open）：整个文件以写时复制方式映射，打开时一次性把 stream 中的
+// 字符串偏移改写为映射地址（只有含字符串的页会被复制），frames 预先解析好每帧的 view。
+struct BridgeRecording
+{
+	BridgeRecordingHeader header{};
+	std::vector<BridgeRecordedFrame> frames;
+
+	uint8_t* base = nullptr;
+	size_t size = 0;
+#if defined(_WIN32)
+	void* mapping = nullptr;
+#endif
+};
+
+namespace bridge
+{
+	// 单个 core 的录制器（格式见 bridge.h 的 BridgeRecordingHeader）。只在该 core 的 Tick 线程上使用：
+	// Tick 中收集本帧分发的 Host->Core 调用与 StoreUtf8 产出的字符串，EndFrame 时改写字符串指针并追加一个帧记录。
+	class CoreRecorder
+	{
+	public:
+		CoreRecorder() = default;
+		~CoreRecorder();
+
+		CoreRecorder(const CoreRecorder&) = delete;
+		CoreRecorder& operator=(const CoreRecorder&) = delete;
+
+		bool Open(const char* path, const BridgeCoreConfig& config, uint64_t startTick);
+
+		// 中途开始录制：core 此前已宣告的字符串之后不会再宣告，把它们作为 BRIDGE_CMD_DEFINE_STRING
+		// 补在第一帧 stream 的开头（按 id 排序），只回放 Host 时也能解析之后引用这些 id 的命令。
+		void DeclareStrings(const CoreStringCache& strings);
+
+		// 回填 frame_count 并关闭文件；返回录制期间是否全部写入成功。
+		bool Close();
+
+		void OnInbound(const uint8_t* bytes, size_t len)
+		{
+			if (bytes && len > 0)
+			{
+				inbound_.insert(inbound_.end(), bytes, bytes + len);
+			}
+		}
+
+		void OnStringStored(const BridgeStringView& view)
+		{
+			if (view.len > 0)
+			{
+				stored_.push_back(view);
+			}
+		}
+
+		void EndFrame(float dt, const uint8_t* stream, uint32_t len);
+
+	private:
+		// stream_[fieldOffset] 处的 BridgeStringView 引用了 view：复制内容，并记下待改写的 ptr 字段。
+		void Relocate(uint32_t fieldOffset, const BridgeStringView& view);
+		bool IsStored(const BridgeStringView& view) const;
+		void Write(const void* data, size_t len);
+
+		std::FILE* file_ = nullptr;
+		bool failed_ = false;
+		uint32_t frame_count_ = 0;
+		uint64_t file_size_ = 0;
+
+		// 待补在下一帧 stream 开头的 DEFINE_STRING（见 DeclareStrings）。
+		std::vector<uint8_t> preamble_;
+
+		// 本帧收集的数据（帧间复用容量）。
+		std::vector<uint8_t> inbound_;
+		std::vector<BridgeStringView> stored_;
+		std::vector<uint8_t> stream_;
+		std::vector<uint32_t> relocs_;
+		std::vector<uint8_t> strings_;
+	};
+
+	BridgeRecording* OpenRecording(const char* path);
+	void CloseRecording(BridgeRecording* recording);
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace bridge
+{
+	// BridgeCore_CreateMany 的一次分配：本头之后依次是各 core 的 BridgeCore，再之后是各 core 的初始缓冲区域
+	// （均按 cache line 对齐）。每个 core 单独销毁，最后一个销毁的 core 释放整块内存。
+	struct CoreSlab
+	{
+		std::atomic<uint32_t> live_cores{0};
+	};
+
+	// 预先划给某个 core 的一段连续字节（位于 BridgeCore_CreateMany 的 slab 中）。
+	// 初始缓冲按顺序从这里切出；区域用完后的分配（扩容）回到堆上。区域内的内存不单独释放，随 slab 一起归还。
+	class BufferRegion
+	{
+	public:
+		void Assign(uint8_t* begin, size_t size)
+		{
+			begin_ = begin;
+			cur_ = begin;
+			end_ = begin + size;
+		}
+
+		// 放不下时返回 null（调用方改用堆）。
+		void* Take(size_t bytes)
+		{
+			bytes = (bytes + 7u) & ~size_t{7};
+			if (bytes == 0 || static_cast<size_t>(end_ - cur_) < bytes)
+			{
+				return nullptr;
+			}
+			void* p = cur_;
+			cur_ += bytes;
+			return p;
+		}
+
+		bool Owns(const void* p) const
+		{
+			const auto addr = reinterpret_cast<uintptr_t>(p);
+			return addr >= reinterpret_cast<uintptr_t>(begin_) && addr < reinterpret_cast<uintptr_t>(end_);
+		}
+
+	private:
+		uint8_t* begin_ = nullptr;
+		uint8_t* cur_ = nullptr;
+		uint8_t* end_ = nullptr;
+	};
+
+	// 优先从 BufferRegion 分配的 allocator；region 为 null 时与 std::allocator 相同。
+	template <class T>
+	class RegionAllocator
+	{
+	public:
+		using value_type = T;
+		using propagate_on_container_move_assignment = std::true_type;
+		using propagate_on_container_swap = std::true_type;
+
+		RegionAllocator() = default;
+		explicit RegionAllocator(BufferRegion* region) : region_(region) {}
+
+		template <class U>
+		RegionAllocator(const RegionAllocator<U>& other) : region_(other.Region())
+		{
+		}
+
+		T* allocate(size_t n)
+		{
+			if (region_)
+			{
+				if (void* p = region_->Take(n * sizeof(T)))
+				{
+					return static_cast<T*>(p);
+				}
+			}
+			return std::allocator<T>().allocate(n);
+		}
+
+		void deallocate(T* p, size_t n)
+		{
+			if (region_ && region_->Owns(p))
+			{
+				return;
+			}
+			std::allocator<T>().deallocate(p, n);
+		}
+
+		BufferRegion* Region() const { return region_; }
+
+		friend bool operator==(const RegionAllocator& a, const RegionAllocator& b) { return a.region_ == b.region_; }
+		friend bool operator!=(const RegionAllocator& a, const RegionAllocator& b) { return a.region_ != b.region_; }
+
+	private:
+		static_assert(alignof(T) <= 8, "BufferRegion only guarantees 8-byte alignment");
+
+		BufferRegion* region_ = nullptr;
+	};
+
+	// command stream / 待分发调用 / group arena 共用的字节缓冲类型。
+	using ByteBuffer = std::vector<uint8_t, RegionAllocator<uint8_t>>;
+}
@@ -0,0 +1,115 @@
+#include "core_stats.h"
+
+#if BRIDGE_ENABLE_STATS
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+	constexpr size_t kInitialFuncSlots = 16;
+
+	size_t HashFuncId(uint32_t funcId)
+	{
+		// func_id 本身已是哈希值（BridgeGen 生成），再混一次以防手写的小整数 id 聚集。
+		return static_cast<size_t>(funcId * 0x9E3779B1u);
+	}
+}
+
+namespace bridge
+{
+	void CoreStats::OnHostCall(uint32_t funcId, uint32_t stride)
+	{
+		totals_.calls_emitted++;
+		frame_calls_++;
+
+		BridgeFuncStats* entry = FindOrAddFunc(funcId);
+		entry->calls++;
+		entry->payload_bytes += stride;
+	}
+
+	void CoreStats::OnInboundCalls(const uint8_t* bytes, size_t len)
+	{
+		size_t offset = 0;
+		while (offset + sizeof(BridgeCallCoreHeader) <= len)
+		{
+			BridgeCallCoreHeader hdr{};
+			std::memcpy(&hdr, bytes + offset, sizeof(hdr));
+			offset += sizeof(hdr) + ((static_cast<size_t>(hdr.payload_size) + 7u) & ~size_t{7});
+			totals_.inbound_calls++;
+		}
+		totals_.inbound_bytes += len;
+		frame_inbound_bytes_ += len;
+		totals_.peak_inbound_bytes = std::max<uint64_t>(totals_.peak_inbound_bytes, frame_inbound_bytes_);
+	}
+
+	void CoreStats::Reset()
+	{
+		totals_ = BridgeCoreStats{};
+		frame_calls_ = 0;
+		frame_inbound_bytes_ = 0;
+		std::fill(funcs_.begin(), funcs_.end(), BridgeFuncStats{});
+	}
+
+	uint32_t CoreStats::CopyFuncStats(BridgeFuncStats* out, uint32_t capacity) const
+	{
+		uint32_t count = 0;
+		for (const BridgeFuncStats& entry : funcs_)
+		{
+			if (entry.calls == 0)
+			{
+				continue;
+			}
+			if (out && count < capacity)
+			{
+				out[count] = entry;
+			}
+			count++;
+		}
+		return count;
+	}
+
+	BridgeFuncStats* CoreStats::FindOrAddFunc(uint32_t funcId)
+	{
+		if (last_func_ < funcs_.size() && funcs_[last_func_].func_id == funcId && funcs_[last_func_].calls != 0)
+		{
+			return &funcs_[last_func_];
+		}
+
+		if ((totals_.func_count + 1) * 2 > funcs_.size())
+		{
+			std::vector<BridgeFuncStats> old = std::move(funcs_);
+			funcs_.assign(std::max(kInitialFuncSlots, old.size() * 2), BridgeFuncStats{});
+			const size_t mask = funcs_.size() - 1;
+			for (const BridgeFuncStats& entry : old)
+			{
+				if (entry.calls == 0)
+				{
+					continue;
+				}
+				size_t i = HashFuncId(entry.func_id) & mask;
+				while (funcs_[i].calls != 0)
+				{
+					i = (i + 1) & mask;
+				}
+				funcs_[i] = entry;
+			}
+		}
+
+		const size_t mask = funcs_.size() - 1;
+		size_t i = HashFuncId(funcId) & mask;
+		while (funcs_[i].calls != 0 && funcs_[i].func_id != funcId)
+		{
+			i = (i + 1) & mask;
+		}
+		if (funcs_[i].calls == 0)
+		{
+			funcs_[i].func_id = funcId;
+			totals_.func_count++;
+		}
+		last_func_ = i;
+		return &funcs_[i];
+	}
+}
+
+#endif
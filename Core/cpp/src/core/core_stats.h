@@ -0,0 +1,93 @@
+#pragma once
+
+#include <bridge/bridge.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// 编译期开关：为 0 时 CoreStats 是空类型，所有埋点都是空的内联函数（零开销）。
+#ifndef BRIDGE_ENABLE_STATS
+	#define BRIDGE_ENABLE_STATS 0
+#endif
+
+namespace bridge
+{
+#if BRIDGE_ENABLE_STATS
+	// 单个 core 的运行时统计（BridgeCore_GetStats）。只在 Tick 线程上更新/读取，不需要同步。
+	class CoreStats
+	{
+	public:
+		void BeginFrame()
+		{
+			frame_calls_ = 0;
+			frame_inbound_bytes_ = 0;
+			frame_start_ = std::chrono::steady_clock::now();
+		}
+
+		void EndFrame(uint32_t streamBytes, uint32_t streamReallocs)
+		{
+			const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - frame_start_).count();
+			totals_.frames++;
+			totals_.bytes_emitted += streamBytes;
+			totals_.last_frame_calls = frame_calls_;
+			totals_.last_frame_bytes = streamBytes;
+			totals_.peak_frame_bytes = totals_.peak_frame_bytes > streamBytes ? totals_.peak_frame_bytes : streamBytes;
+			totals_.stream_reallocs += streamReallocs;
+			totals_.last_tick_ns = static_cast<uint64_t>(ns);
+			totals_.max_tick_ns = totals_.max_tick_ns > totals_.last_tick_ns ? totals_.max_tick_ns : totals_.last_tick_ns;
+		}
+
+		// 新写出一次 Host 调用（stride 为补齐后的 payload 大小）。
+		void OnHostCall(uint32_t funcId, uint32_t stride);
+
+		void OnStringStored(size_t len)
+		{
+			totals_.strings_stored++;
+			totals_.string_bytes_stored += len;
+		}
+
+		void OnStringDefined() { totals_.strings_defined++; }
+
+		// 本帧分发的一段 BridgeCallCoreHeader + payload 序列（已校验）。
+		void OnInboundCalls(const uint8_t* bytes, size_t len);
+
+		void OnCallBufferAppend(size_t oldCapacity, size_t newCapacity)
+		{
+			totals_.call_buffer_reallocs += oldCapacity != newCapacity;
+		}
+
+		void Reset();
+
+		// 容量类字段由调用方填写（它们描述的是缓冲，而不是计数）。
+		const BridgeCoreStats& Totals() const { return totals_; }
+		uint32_t CopyFuncStats(BridgeFuncStats* out, uint32_t capacity) const;
+
+	private:
+		BridgeCoreStats totals_{};
+		uint64_t frame_calls_ = 0;
+		uint64_t frame_inbound_bytes_ = 0;
+		std::chrono::steady_clock::time_point frame_start_{};
+
+		// func_id -> 明细：开放寻址（calls == 0 的槽为空），last_func_ 缓存上一次命中的槽（连续调用同一函数很常见）。
+		BridgeFuncStats* FindOrAddFunc(uint32_t funcId);
+
+		std::vector<BridgeFuncStats> funcs_;
+		size_t last_func_ = 0;
+	};
+#else
+	class CoreStats
+	{
+	public:
+		void BeginFrame() {}
+		void EndFrame(uint32_t, uint32_t) {}
+		void OnHostCall(uint32_t, uint32_t) {}
+		void OnStringStored(size_t) {}
+		void OnStringDefined() {}
+		void OnInboundCalls(const uint8_t*, size_t) {}
+		void OnCallBufferAppend(size_t, size_t) {}
+		void Reset() {}
+	};
+#endif
+}
@@ -0,0 +1,310 @@
+#include "inbound_call_queue.h"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+namespace bridge
+{
+	namespace
+	{
+		// 推进游标期间计入 advancing_（见 InboundCallQueue::Recycle）。
+		class AdvancingScope
+		{
+		public:
+			explicit AdvancingScope(std::atomic<uint32_t>& producers) : producers_(producers)
+			{
+				producers_.fetch_add(1, std::memory_order_seq_cst);
+			}
+
+			~AdvancingScope()
+			{
+				producers_.fetch_sub(1, std::memory_order_seq_cst);
+			}
+
+			AdvancingScope(const AdvancingScope&) = delete;
+			AdvancingScope& operator=(const AdvancingScope&) = delete;
+
+		private:
+			std::atomic<uint32_t>& producers_;
+		};
+
+		void EncodeCall(uint8_t* dst, uint32_t funcId, const void* payload, uint32_t payloadSize, uint32_t alignedPayload)
+		{
+			BridgeCallCoreHeader hdr{};
+			hdr.func_id = funcId;
+			hdr.payload_size = payloadSize;
+
+			std::memcpy(dst, &hdr, sizeof(hdr));
+			if (payloadSize > 0)
+			{
+				std::memcpy(dst + sizeof(hdr), payload, payloadSize);
+			}
+			if (alignedPayload > payloadSize)
+			{
+				std::memset(dst + sizeof(hdr) + payloadSize, 0, alignedPayload - payloadSize);
+			}
+		}
+	}
+
+	InboundCallQueue::~InboundCallQueue()
+	{
+		while (retired_)
+		{
+			Segment* next = retired_->retired_next;
+			FreeSegment(retired_);
+			retired_ = next;
+		}
+		Segment* seg = head_ ? head_ : first_.load(std::memory_order_acquire);
+		while (seg)
+		{
+			Segment* next = seg->next.load(std::memory_order_relaxed);
+			FreeSegment(seg);
+			seg = next;
+		}
+	}
+
+	void InboundCallQueue::Push(uint32_t funcId, const void* payload, uint32_t payloadSize)
+	{
+		const uint32_t alignedPayload = (payloadSize + 7u) & ~7u;
+		const uint32_t len = static_cast<uint32_t>(sizeof(BridgeCallCoreHeader)) + alignedPayload;
+		if (sizeof(RecordHeader) + len > kSegmentBytes)
+		{
+			Segment* big = NewOversized(len);
+			EncodeCall(big->Bytes() + sizeof(RecordHeader), funcId, payload, payloadSize, alignedPayload);
+			PublishOversized(big);
+			return;
+		}
+
+		uint8_t* record = Reserve(static_cast<uint32_t>(sizeof(RecordHeader)) + len);
+		EncodeCall(record + sizeof(RecordHeader), funcId, payload, payloadSize, alignedPayload);
+		Commit(record, len);
+	}
+
+	void InboundCallQueue::PushEncoded(const void* calls, uint32_t len)
+	{
+		if (len == 0)
+		{
+			return;
+		}
+		if (sizeof(RecordHeader) + len > kSegmentBytes)
+		{
+			Segment* big = NewOversized(len);
+			std::memcpy(big->Bytes() + sizeof(RecordHeader), calls, len);
+			PublishOversized(big);
+			return;
+		}
+
+		uint8_t* record = Reserve(static_cast<uint32_t>(sizeof(RecordHeader)) + len);
+		std::memcpy(record + sizeof(RecordHeader), calls, len);
+		Commit(record, len);
+	}
+
+	InboundCallQueue::Segment* InboundCallQueue::NewSegment(uint32_t capacity, bool pooled)
+	{
+		void* mem = ::operator new(sizeof(Segment) + capacity, std::align_val_t{alignof(Segment)});
+		auto* seg = ::new (mem) Segment();
+		seg->capacity = capacity;
+		seg->pooled = pooled;
+		// 记录头的长度为 0 表示“尚未写完”：新分段整体清零。
+		std::memset(seg->Bytes(), 0, capacity);
+		return seg;
+	}
+
+	void InboundCallQueue::FreeSegment(Segment* seg)
+	{
+		seg->~Segment();
+		::operator delete(seg, std::align_val_t{alignof(Segment)});
+	}
+
+	InboundCallQueue::Segment* InboundCallQueue::NewOversized(uint32_t len)
+	{
+		// 专用分段只装这一条记录；limit 预先确定，调用方写完数据后再接入链表。
+		Segment* big = NewSegment(static_cast<uint32_t>(sizeof(RecordHeader)) + len, false);
+		reinterpret_cast<RecordHeader*>(big->Bytes())->len = len;
+		big->limit.store(big->capacity, std::memory_order_relaxed);
+		return big;
+	}
+
+	uint8_t* InboundCallQueue::Reserve(uint32_t len)
+	{
+		uint64_t cursor = tail_.load(std::memory_order_acquire);
+		for (;;)
+		{
+			if (cursor == 0)
+			{
+				cursor = InitCursor();
+				continue;
+			}
+
+			// 游标所在的分段一定是普通分段，容量固定为 kSegmentBytes，这里不需要读分段本身。
+			const uint32_t offset = OffsetOf(cursor);
+			if (len <= kSegmentBytes - offset)
+			{
+				// CAS 成功时分段就是当前分段，且记录落在它的 limit 之内：消费者读到这条记录之前不会回收它。
+				if (tail_.compare_exchange_weak(cursor, cursor + len, std::memory_order_acquire, std::memory_order_acquire))
+				{
+					return SegmentOf(cursor)->Bytes() + offset;
+				}
+				continue;
+			}
+			cursor = Advance(cursor);
+		}
+	}
+
+	void InboundCallQueue::Commit(uint8_t* record, uint32_t len)
+	{
+		std::atomic_ref<uint32_t>(reinterpret_cast<RecordHeader*>(record)->len).store(len, std::memory_order_release);
+	}
+
+	void InboundCallQueue::PublishOversized(Segment* big)
+	{
+		AdvancingScope scope(advancing_);
+
+		uint64_t cursor = tail_.load(std::memory_order_seq_cst);
+		for (;;)
+		{
+			if (cursor == 0)
+			{
+				cursor = InitCursor();
+				continue;
+			}
+
+			Segment* seg = SegmentOf(cursor);
+			Segment* next = NextOf(seg);
+			// 关闭当前分段并越过专用分段：专用分段不会成为游标所在的分段。
+			if (tail_.compare_exchange_strong(cursor, Pack(next, 0), std::memory_order_seq_cst, std::memory_order_seq_cst))
+			{
+				// seg->next 已非空，之后只有关闭 seg 的生产者（即这里）会改它。
+				big->next.store(next, std::memory_order_relaxed);
+				seg->next.store(big, std::memory_order_release);
+				// limit 最后写入：消费者读完 seg 之前，专用分段已经接好。
+				seg->limit.store(OffsetOf(cursor), std::memory_order_release);
+				return;
+			}
+		}
+	}
+
+	uint64_t InboundCallQueue::InitCursor()
+	{
+		Segment* fresh = NewSegment(kSegmentBytes, true);
+		uint64_t expected = 0;
+		if (tail_.compare_exchange_strong(expected, Pack(fresh, 0), std::memory_order_acq_rel, std::memory_order_acquire))
+		{
+			first_.store(fresh, std::memory_order_release);
+			return Pack(fresh, 0);
+		}
+		FreeSegment(fresh);
+		return expected;
+	}
+
+	uint64_t InboundCallQueue::Advance(uint64_t cursor)
+	{
+		AdvancingScope scope(advancing_);
+
+		// 计数之后重新读取游标：此后拿到的分段在计数归零之前都不会被回收。
+		uint64_t current = tail_.load(std::memory_order_seq_cst);
+		if (current != cursor)
+		{
+			return current;
+		}
+
+		Segment* seg = SegmentOf(cursor);
+		Segment* next = NextOf(seg);
+		if (tail_.compare_exchange_strong(current, Pack(next, 0), std::memory_order_seq_cst, std::memory_order_seq_cst))
+		{
+			seg->limit.store(OffsetOf(cursor), std::memory_order_release);
+			return Pack(next, 0);
+		}
+		return current;
+	}
+
+	InboundCallQueue::Segment* InboundCallQueue::NextOf(Segment* seg)
+	{
+		Segment* next = seg->next.load(std::memory_order_acquire);
+		if (next)
+		{
+			return next;
+		}
+
+		// 没有回收来的空闲分段：从堆分配（稳态下消费者回收的分段足够，不会走到这里）。
+		Segment* fresh = NewSegment(kSegmentBytes, true);
+		if (seg->next.compare_exchange_strong(next, fresh, std::memory_order_acq_rel, std::memory_order_acquire))
+		{
+			return fresh;
+		}
+		FreeSegment(fresh);
+		return next;
+	}
+
+	void InboundCallQueue::Append(Segment* start, Segment* chain)
+	{
+		Segment* last = start;
+		for (;;)
+		{
+			Segment* next = last->next.load(std::memory_order_acquire);
+			if (!next)
+			{
+				if (last->next.compare_exchange_weak(next, chain, std::memory_order_release, std::memory_order_acquire))
+				{
+					return;
+				}
+				if (!next)
+				{
+					continue;
+				}
+			}
+			last = next;
+		}
+	}
+
+	void InboundCallQueue::Retire(Segment* seg)
+	{
+		seg->retired_next = retired_;
+		retired_ = seg;
+	}
+
+	void InboundCallQueue::Recycle()
+	{
+		if (!retired_)
+		{
+			return;
+		}
+
+		// 退役的分段都已被游标越过，只有还在推进游标的生产者可能拿着它们的指针；
+		// 之后开始推进的生产者会重新读取游标，只碰到游标所在及之后的分段。
+		if (advancing_.load(std::memory_order_seq_cst) != 0)
+		{
+			return;
+		}
+
+		Segment* chain = nullptr;
+		Segment* seg = retired_;
+		retired_ = nullptr;
+		while (seg)
+		{
+			Segment* next = seg->retired_next;
+			if (!seg->pooled)
+			{
+				FreeSegment(seg);
+			}
+			else
+			{
+				// 只有 [0, limit) 被写过。
+				const uint32_t used = std::min(seg->limit.load(std::memory_order_relaxed), seg->capacity);
+				std::memset(seg->Bytes(), 0, used);
+				seg->limit.store(kOpen, std::memory_order_relaxed);
+				seg->retired_next = nullptr;
+				seg->next.store(chain, std::memory_order_relaxed);
+				chain = seg;
+			}
+			seg = next;
+		}
+
+		if (chain)
+		{
+			// 挂到链表末尾（release：生产者取到分段时看到的是清零后的内容）。
+			Append(SegmentOf(tail_.load(std::memory_order_acquire)), chain);
+		}
+	}
+}
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <bridge/bridge.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace bridge
+{
+	// Host->Core 调用的无锁多生产者/单消费者队列（BRIDGE_CORE_FLAG_CONCURRENT_CALLS 模式）。
+	//
+	// - 数据写在固定大小（kSegmentBytes）的分段里，分段串成链表。每次 Push 是一条记录
+	//   （8 字节记录头 + 已编码的调用，BridgeCallCoreHeader + payload，8 字节补齐）。
+	// - 写入游标 tail_ 把当前分段指针和分段内偏移打包在一个 64 位原子量里：生产者用一次 CAS 预留空间，
+	//   写完数据后再以 release 写入记录头的长度。生产者之间只竞争这一次 CAS，从不等待消费者，也不分配内存。
+	// - 放不下时把游标推进到下一个分段（没有时才从堆分配一个，并用 CAS 挂上），推进的生产者记下分段的有效长度（limit）。
+	// - 消费者（Tick 线程）按预留顺序读取已写完的记录，遇到尚未写完的记录就停下，留给下一次 Drain。
+	// - 读完的分段由消费者回收：清零用过的部分后挂回链表末尾，生产者换分段时直接取用。
+	//   只有推进游标的生产者会在分段读完后还访问它（advancing_ 计数），回收要等没有这样的生产者，否则留到之后的 Drain。
+	// - 单条记录放不进一个分段时（超大的调用），为它单独从堆分配一个分段，读完后释放。
+	class InboundCallQueue
+	{
+	public:
+		InboundCallQueue() = default;
+		~InboundCallQueue();
+
+		InboundCallQueue(const InboundCallQueue&) = delete;
+		InboundCallQueue& operator=(const InboundCallQueue&) = delete;
+
+		// 任意线程可调用。
+		void Push(uint32_t funcId, const void* payload, uint32_t payloadSize);
+		void PushEncoded(const void* calls, uint32_t len);
+
+		// 仅消费者线程调用：按预留顺序把每条已写完的记录交给 fn(const uint8_t* bytes, size_t len)。
+		template <class Fn>
+		void Drain(Fn&& fn)
+		{
+			if (!head_)
+			{
+				head_ = first_.load(std::memory_order_acquire);
+				if (!head_)
+				{
+					return;
+				}
+			}
+
+			for (;;)
+			{
+				Segment* seg = head_;
+				uint32_t r = read_;
+				uint32_t limit = seg->limit.load(std::memory_order_acquire);
+				while (r < limit && r + sizeof(RecordHeader) <= seg->capacity)
+				{
+					const uint32_t len = RecordLength(seg, r);
+					if (len == 0)
+					{
+						break;
+					}
+					fn(seg->Bytes() + r + sizeof(RecordHeader), static_cast<size_t>(len));
+					r += static_cast<uint32_t>(sizeof(RecordHeader)) + len;
+					limit = seg->limit.load(std::memory_order_acquire);
+				}
+				read_ = r;
+
+				Segment* next = r == limit ? seg->next.load(std::memory_order_acquire) : nullptr;
+				if (!next)
+				{
+					break;
+				}
+				Retire(seg);
+				head_ = next;
+				read_ = 0;
+			}
+			Recycle();
+		}
+
+	private:
+		// 普通分段的数据容量。
+		static constexpr uint32_t kSegmentBytes = 2048;
+		// limit 未确定（分段仍在写入）。
+		static constexpr uint32_t kOpen = UINT32_MAX;
+
+		// 64 字节对齐：打包进 tail_ 时丢掉低 6 位。
+		struct alignas(64) Segment
+		{
+			std::atomic<Segment*> next{nullptr};
+			// 有效长度：游标推进离开本分段时写入；之前的记录都在 [0, limit) 内。
+			std::atomic<uint32_t> limit{kOpen};
+			uint32_t capacity = 0;
+			// false：超大记录的专用分段，读完后释放而不回收。
+			bool pooled = true;
+			// 消费者私有：等待回收的分段链表。
+			Segment* retired_next = nullptr;
+
+			uint8_t* Bytes() { return reinterpret_cast<uint8_t*>(this + 1); }
+		};
+
+		// tail_ 的打包格式：高 48 位为分段地址 >> 6，低 16 位为分段内偏移（<= kSegmentBytes）。
+		static uint64_t Pack(Segment* seg, uint32_t offset)
+		{
+			return (static_cast<uint64_t>(reinterpret_cast<uintptr_t>(seg)) >> 6 << 16) | offset;
+		}
+
+		static Segment* SegmentOf(uint64_t cursor)
+		{
+			return reinterpret_cast<Segment*>(static_cast<uintptr_t>(cursor >> 16 << 6));
+		}
+
+		static uint32_t OffsetOf(uint64_t cursor)
+		{
+			return static_cast<uint32_t>(cursor & 0xFFFFu);
+		}
+
+		// 记录头：len 为随后的调用字节数（8 字节补齐），0 表示生产者尚未写完。
+		struct RecordHeader
+		{
+			uint32_t len;
+			uint32_t reserved0;
+		};
+
+		static uint32_t RecordLength(Segment* seg, uint32_t offset)
+		{
+			return std::atomic_ref<uint32_t>(reinterpret_cast<RecordHeader*>(seg->Bytes() + offset)->len).load(std::memory_order_acquire);
+		}
+
+		static Segment* NewSegment(uint32_t capacity, bool pooled);
+		static void FreeSegment(Segment* seg);
+		// 超大记录的专用分段（记录头已填好），调用方在记录头之后写入 len 字节的调用。
+		static Segment* NewOversized(uint32_t len);
+
+		// 预留 len 字节（含记录头，<= kSegmentBytes）并返回记录的起点；调用方写完调用后以 Commit 发布（len 不含记录头）。
+		uint8_t* Reserve(uint32_t len);
+		static void Commit(uint8_t* record, uint32_t len);
+		// 把已写好的超大记录（专用分段）接在当前分段之后，并把游标推进过去。
+		void PublishOversized(Segment* big);
+
+		// 创建第一个分段，返回新的游标。
+		uint64_t InitCursor();
+		// cursor 所在分段放不下：把游标推进到下一个分段（必要时分配），返回当前游标。
+		uint64_t Advance(uint64_t cursor);
+		// 返回 seg 的下一个分段，没有时分配一个挂上。
+		static Segment* NextOf(Segment* seg);
+		// 把 chain 挂到链表末尾（从 start 往后找 next 为空的分段）。
+		static void Append(Segment* start, Segment* chain);
+
+		void Retire(Segment* seg);
+		void Recycle();
+
+		// 第一个分段（首次 Push 时创建）；消费者从这里开始读。
+		std::atomic<Segment*> first_{nullptr};
+		// 写入游标（见 Pack）；0 表示还没有分段。
+		std::atomic<uint64_t> tail_{0};
+		// 正在推进游标的生产者数：为 0 时没有生产者持有已读完分段的指针，退役的分段才能回收。
+		std::atomic<uint32_t> advancing_{0};
+
+		// 以下仅消费者访问。
+		Segment* head_ = nullptr;
+		uint32_t read_ = 0;
+		Segment* retired_ = nullptr;
+	};
+}
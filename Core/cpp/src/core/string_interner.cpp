@@ -0,0 +1,24 @@
+#include "string_interner.h"
+
+namespace bridge
+{
+	StringInterner& StringInterner::Instance()
+	{
+		static StringInterner* interner = new StringInterner();
+		return *interner;
+	}
+
+	BridgeStringId StringInterner::Intern(std::string_view utf8, std::string_view* outStored)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+
+		auto it = ids_.find(utf8);
+		if (it == ids_.end())
+		{
+			const BridgeStringId id = static_cast<BridgeStringId>(ids_.size() + 1);
+			it = ids_.emplace(std::string(utf8), id).first;
+		}
+		*outStored = it->first;
+		return it->second;
+	}
+}
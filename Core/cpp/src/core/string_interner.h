@@ -0,0 +1,48 @@
+#pragma once
+
+#include <bridge/bridge.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace bridge
+{
+	// 进程级字符串驻留表（CoreContext::InternUtf8 使用）。
+	//
+	// - 相同 UTF-8 内容在整个进程内映射到同一个 id（从 1 开始，跨 Tick、跨 core 稳定）
+	// - 字符串存储常驻到进程结束（有意不释放），因此 BRIDGE_CMD_DEFINE_STRING 中的 view 永久有效
+	// - 线程安全（并行 TickMany 下多个 core 可能同时驻留）；热路径由每个 core 的 CoreStringCache 挡住，
+	//   只有某个 core 第一次见到一个字符串时才会进入这里
+	class StringInterner
+	{
+	public:
+		static StringInterner& Instance();
+
+		// 返回 id，并通过 outStored 返回常驻存储的 view。utf8 不能为空。
+		BridgeStringId Intern(std::string_view utf8, std::string_view* outStored);
+
+	private:
+		StringInterner() = default;
+
+		struct Hash
+		{
+			using is_transparent = void;
+			size_t operator()(std::string_view s) const noexcept
+			{
+				return std::hash<std::string_view>{}(s);
+			}
+		};
+
+		std::mutex mutex_;
+		// unordered_map 的节点不随 rehash 移动，key 的数据地址在进程内保持不变。
+		std::unordered_map<std::string, BridgeStringId, Hash, std::equal_to<>> ids_;
+	};
+
+	// 单个 core 已向 Host 宣告过的驻留字符串（key 指向 StringInterner 的常驻存储，不另行复制）。
+	using CoreStringCache = std::unordered_map<std::string_view, BridgeStringId>;
+}
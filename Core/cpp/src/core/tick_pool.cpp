@@ -0,0 +1,283 @@
+#include "tick_pool.h"
+
+#include "core_instance.h"
+
+#include <algorithm>
+
+namespace
+{
+	// 每个参与者平均分到的 chunk 数（越多，窃取粒度越细，负载越均衡；但 claim 次数也越多）。
+	constexpr uint32_t kChunksPerParticipant = 8;
+	constexpr uint32_t kMinChunkSize = 8;
+	constexpr uint32_t kMaxChunkSize = 256;
+}
+
+namespace bridge
+{
+	TickWorkerPool& TickWorkerPool::Instance()
+	{
+		static TickWorkerPool* pool = new TickWorkerPool();
+		return *pool;
+	}
+
+	bool TickWorkerPool::SetWorkerCount(uint32_t workerCount)
+	{
+		std::lock_guard<std::mutex> api(api_mutex_);
+		if (async_active_)
+		{
+			return false;
+		}
+		if (workerCount == threads_.size())
+		{
+			return true;
+		}
+
+		StopWorkers();
+
+		uint64_t generation = 0;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			stopping_ = false;
+			generation = generation_;
+		}
+
+		threads_.reserve(workerCount);
+		for (uint32_t i = 0; i < workerCount; i++)
+		{
+			// slot 0 留给调用线程；起始 generation 在这里确定，避免线程启动晚于下一批次而漏掉唤醒。
+			threads_.emplace_back(&TickWorkerPool::WorkerMain, this, i + 1, generation);
+		}
+		return true;
+	}
+
+	void TickWorkerPool::StopWorkers()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			stopping_ = true;
+		}
+		wake_.notify_all();
+		for (auto& t : threads_)
+		{
+			t.join();
+		}
+		threads_.clear();
+	}
+
+	bool TickWorkerPool::TickMany(BridgeCore** cores, uint32_t count, float dt, BridgeCommandStream* outStreams, BridgeCoreGroup* group)
+	{
+		std::lock_guard<std::mutex> api(api_mutex_);
+		if (async_active_)
+		{
+			return false;
+		}
+
+		if (threads_.empty() || count <= kMinChunkSize)
+		{
+			if (group)
+			{
+				PrepareGroupChunks(*group, 1);
+				TickGroupChunk(*group, 0, cores, 0, count, dt, outStreams);
+				return true;
+			}
+			for (uint32_t i = 0; i < count; i++)
+			{
+				TickToStream(cores[i], dt, outStreams[i]);
+			}
+			return true;
+		}
+
+		StartBatch(cores, count, dt, outStreams, group);
+		RunSlot(0);
+		// worker 只有在所有队列都被认领且自己手上的 chunk 完成后才会离开 RunSlot，
+		// 因此 workers_pending_ 归零即整批完成（之后也才能安全复用 queues_/batch_）。
+		WaitWorkers();
+		return true;
+	}
+
+	bool TickWorkerPool::BeginTickMany(BridgeCore** cores, uint32_t count, float dt, BridgeCommandStream* outStreams)
+	{
+		std::lock_guard<std::mutex> api(api_mutex_);
+		if (async_active_)
+		{
+			return false;
+		}
+
+		StartBatch(cores, count, dt, outStreams, nullptr);
+		async_active_ = true;
+		async_polled_ = 0;
+		async_remaining_ = count;
+		return true;
+	}
+
+	void TickWorkerPool::PollCompleted(BridgeTickShard* outShards, uint32_t capacity, uint32_t* outCount, uint32_t* outRemaining)
+	{
+		std::lock_guard<std::mutex> api(api_mutex_);
+
+		uint32_t n = 0;
+		while (async_active_ && n < capacity && async_polled_ < batch_.chunkCount)
+		{
+			const uint32_t chunk = completed_[async_polled_].load(std::memory_order_acquire);
+			if (chunk == kEmptySlot)
+			{
+				if (n > 0)
+				{
+					break;
+				}
+				// 至少交还一个 shard：没有现成的就自己跑一个 chunk（都被认领了则让出时间片等发布）。
+				if (!TryRunOneChunk(0))
+				{
+					std::this_thread::yield();
+				}
+				continue;
+			}
+
+			const uint32_t begin = chunk * batch_.chunkSize;
+			const uint32_t end = std::min(begin + batch_.chunkSize, batch_.count);
+			outShards[n].begin = begin;
+			outShards[n].count = end - begin;
+			n++;
+
+			async_polled_++;
+			async_remaining_ -= end - begin;
+		}
+
+		if (async_active_ && async_polled_ == batch_.chunkCount)
+		{
+			WaitWorkers();
+			async_active_ = false;
+		}
+
+		*outCount = n;
+		*outRemaining = async_active_ ? async_remaining_ : 0;
+	}
+
+	void TickWorkerPool::StartBatch(BridgeCore** cores, uint32_t count, float dt, BridgeCommandStream* outStreams, BridgeCoreGroup* group)
+	{
+		const uint32_t participants = static_cast<uint32_t>(threads_.size()) + 1;
+		const uint32_t chunkSize = std::clamp(count / (participants * kChunksPerParticipant), kMinChunkSize, kMaxChunkSize);
+		const uint32_t chunkCount = (count + chunkSize - 1) / chunkSize;
+
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+
+			batch_.cores = cores;
+			batch_.count = count;
+			batch_.dt = dt;
+			batch_.outStreams = outStreams;
+			batch_.group = group;
+			batch_.chunkSize = chunkSize;
+			batch_.chunkCount = chunkCount;
+			batch_.participants = participants;
+
+			if (queue_capacity_ < participants)
+			{
+				queues_ = std::make_unique<ChunkQueue[]>(participants);
+				queue_capacity_ = participants;
+			}
+			for (uint32_t slot = 0; slot < participants; slot++)
+			{
+				const uint32_t begin = static_cast<uint32_t>(static_cast<uint64_t>(chunkCount) * slot / participants);
+				const uint32_t end = static_cast<uint32_t>(static_cast<uint64_t>(chunkCount) * (slot + 1) / participants);
+				queues_[slot].next.store(begin, std::memory_order_relaxed);
+				queues_[slot].end = end;
+			}
+
+			if (group)
+			{
+				PrepareGroupChunks(*group, chunkCount);
+			}
+
+			if (completed_capacity_ < chunkCount)
+			{
+				completed_ = std::make_unique<std::atomic<uint32_t>[]>(chunkCount);
+				completed_capacity_ = chunkCount;
+			}
+			for (uint32_t i = 0; i < chunkCount; i++)
+			{
+				completed_[i].store(kEmptySlot, std::memory_order_relaxed);
+			}
+			completed_tail_.store(0, std::memory_order_relaxed);
+
+			workers_pending_.store(participants - 1, std::memory_order_relaxed);
+			generation_++;
+		}
+		wake_.notify_all();
+	}
+
+	void TickWorkerPool::WaitWorkers()
+	{
+		while (workers_pending_.load(std::memory_order_acquire) != 0)
+		{
+			std::this_thread::yield();
+		}
+	}
+
+	void TickWorkerPool::WorkerMain(uint32_t slot, uint64_t seenGeneration)
+	{
+		for (;;)
+		{
+			{
+				std::unique_lock<std::mutex> lock(mutex_);
+				wake_.wait(lock, [&] { return stopping_ || generation_ != seenGeneration; });
+				if (stopping_)
+				{
+					return;
+				}
+				seenGeneration = generation_;
+			}
+
+			RunSlot(slot);
+			workers_pending_.fetch_sub(1, std::memory_order_acq_rel);
+		}
+	}
+
+	void TickWorkerPool::RunSlot(uint32_t slot)
+	{
+		while (TryRunOneChunk(slot))
+		{
+		}
+	}
+
+	bool TickWorkerPool::TryRunOneChunk(uint32_t slot)
+	{
+		const uint32_t participants = batch_.participants;
+
+		// 先消费自己的队列，再按顺序窃取其它队列。
+		for (uint32_t i = 0; i < participants; i++)
+		{
+			ChunkQueue& q = queues_[(slot + i) % participants];
+			if (q.next.load(std::memory_order_relaxed) >= q.end)
+			{
+				continue;
+			}
+			const uint32_t chunk = q.next.fetch_add(1, std::memory_order_relaxed);
+			if (chunk >= q.end)
+			{
+				continue;
+			}
+
+			RunChunk(chunk);
+
+			const uint32_t pos = completed_tail_.fetch_add(1, std::memory_order_relaxed);
+			completed_[pos].store(chunk, std::memory_order_release);
+			return true;
+		}
+		return false;
+	}
+
+	void TickWorkerPool::RunChunk(uint32_t chunk)
+	{
+		const uint32_t begin = chunk * batch_.chunkSize;
+		const uint32_t end = std::min(begin + batch_.chunkSize, batch_.count);
+		if (batch_.group)
+		{
+			TickGroupChunk(*batch_.group, chunk, batch_.cores, begin, end, batch_.dt, batch_.outStreams);
+			return;
+		}
+		for (uint32_t i = begin; i < end; i++)
+		{
+			TickToStream(batch_.cores[i], batch_.dt, batch_.outStreams[i]);
+		}
+	}
+}
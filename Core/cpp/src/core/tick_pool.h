@@ -0,0 +1,104 @@
+#pragma once
+
+#include <bridge/bridge.h>
+
+#include "core_group.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace bridge
+{
+	// 批量 Tick 的常驻 worker 池（BridgeCore_SetTickWorkerCount 开启）。
+	//
+	// 调度方式：
+	// - 一个批次被切成若干 chunk（连续的 cores 区间，即一个 shard），按参与者数平均分到各自的队列
+	// - 每个参与者（调用线程 + worker）先消费自己的队列，空了再去“窃取”其它队列的 chunk
+	// - 队列只是一个原子游标 + 结束位置，claim/steal 都是一次 fetch_add，无锁
+	// - 每完成一个 chunk 就写入完成队列（MPSC：fetch_add 占位 + release 发布），供异步模式轮询
+	//
+	// 每个 BridgeCore 自带 CommandStream 与 pending_call_bytes，不同 core 的 Tick 之间无共享状态，
+	// 因此只要 cores 中没有重复元素，就可以并发执行。
+	class TickWorkerPool
+	{
+	public:
+		// 进程级单例（有意不析构：避免在 DLL 卸载/进程退出阶段 join 线程导致死锁）。
+		static TickWorkerPool& Instance();
+
+		// workerCount == 0：关闭并回收所有 worker 线程（TickMany 退回串行）。
+		// 有异步批次未结束时返回 false。
+		bool SetWorkerCount(uint32_t workerCount);
+
+		// 同步：并行 Tick cores[0..count)，并把每个 core 的 stream 写入 outStreams[i]。
+		// 调用线程作为 0 号参与者一起执行，返回时整批已全部完成。有异步批次未结束时返回 false。
+		// group 非空时，每个 chunk 的命令写入 group 的对应 arena（chunk 内连续）。
+		bool TickMany(BridgeCore** cores, uint32_t count, float dt, BridgeCommandStream* outStreams, BridgeCoreGroup* group);
+
+		// 异步：启动批次后立即返回（cores/outStreams 必须保持有效，直到 PollCompleted 报告 remaining == 0）。
+		bool BeginTickMany(BridgeCore** cores, uint32_t count, float dt, BridgeCommandStream* outStreams);
+
+		// 取出已完成的 shard（最多 capacity 个）。若暂无完成的 shard 但仍有未认领的 chunk，
+		// 调用线程会自己执行一个 chunk 再返回（不空转）。
+		// outRemaining：尚未交还给 Host 的 core 数；为 0 表示批次已结束。
+		void PollCompleted(BridgeTickShard* outShards, uint32_t capacity, uint32_t* outCount, uint32_t* outRemaining);
+
+	private:
+		TickWorkerPool() = default;
+
+		struct alignas(64) ChunkQueue
+		{
+			std::atomic<uint32_t> next{0};
+			uint32_t end = 0;
+		};
+
+		struct Batch
+		{
+			BridgeCore** cores = nullptr;
+			uint32_t count = 0;
+			float dt = 0.0f;
+			BridgeCommandStream* outStreams = nullptr;
+			BridgeCoreGroup* group = nullptr;
+			uint32_t chunkSize = 1;
+			uint32_t chunkCount = 0;
+			uint32_t participants = 1;
+		};
+
+		static constexpr uint32_t kEmptySlot = UINT32_MAX;
+
+		void StopWorkers();
+		void StartBatch(BridgeCore** cores, uint32_t count, float dt, BridgeCommandStream* outStreams, BridgeCoreGroup* group);
+		void WaitWorkers();
+		void WorkerMain(uint32_t slot, uint64_t seenGeneration);
+		void RunSlot(uint32_t slot);
+		bool TryRunOneChunk(uint32_t slot);
+		void RunChunk(uint32_t chunk);
+
+		// 串行化 TickMany / Begin / Poll / SetWorkerCount（同一时刻只允许一个批次在跑）。
+		std::mutex api_mutex_;
+		bool async_active_ = false;
+		uint32_t async_polled_ = 0;
+		uint32_t async_remaining_ = 0;
+
+		std::mutex mutex_;
+		std::condition_variable wake_;
+		std::vector<std::thread> threads_;
+		uint64_t generation_ = 0;
+		bool stopping_ = false;
+
+		Batch batch_{};
+		std::unique_ptr<ChunkQueue[]> queues_;
+		uint32_t queue_capacity_ = 0;
+
+		// 完成队列：按完成顺序记录 chunk 下标；未发布的槽位为 kEmptySlot。
+		std::unique_ptr<std::atomic<uint32_t>[]> completed_;
+		uint32_t completed_capacity_ = 0;
+		std::atomic<uint32_t> completed_tail_{0};
+
+		std::atomic<uint32_t> workers_pending_{0};
+	};
+}
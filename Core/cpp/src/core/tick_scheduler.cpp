@@ -0,0 +1,125 @@
+#include "tick_scheduler.h"
+
+#include "core_instance.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace
+{
+	// 两次读时钟之间最多 Tick 的 core 数。
+	constexpr uint64_t kMaxCheckStride = 8;
+}
+
+namespace bridge
+{
+	BridgeTickScheduler* CreateTickScheduler()
+	{
+		return new BridgeTickScheduler();
+	}
+
+	void DestroyTickScheduler(BridgeTickScheduler* scheduler)
+	{
+		delete scheduler;
+	}
+
+	void TickManyWithBudget(
+		BridgeTickScheduler& scheduler,
+		BridgeCore** cores,
+		uint32_t count,
+		float dt,
+		uint64_t budgetNs,
+		BridgeCommandStream* outStreams,
+		float* outDts,
+		BridgeTickBudgetResult* outResult)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		const auto elapsedSinceStart = [&]() {
+			return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::steady_clock::now() - start).count());
+		};
+
+		// 新出现的下标从本帧开始欠账。
+		if (scheduler.last_tick.size() != count)
+		{
+			scheduler.last_tick.resize(count, scheduler.clock);
+		}
+		if (scheduler.cursor >= count)
+		{
+			scheduler.cursor = 0;
+		}
+		scheduler.clock += std::max(0.0f, dt);
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			outStreams[i] = BridgeCommandStream{};
+		}
+		// Tick 前的欠账：轮到的 core 即以此 dt Tick，其余的就是它们目前欠下的时间。
+		if (outDts)
+		{
+			for (uint32_t i = 0; i < count; i++)
+			{
+				outDts[i] = static_cast<float>(scheduler.clock - scheduler.last_tick[i]);
+			}
+		}
+
+		const uint32_t first = scheduler.cursor;
+		uint32_t visited = 0;
+		uint64_t elapsedNs = 0;
+		// 读时钟也有几十纳秒：按已测得的平均耗时估算剩余预算还能 Tick 几个 core，只用其中一半，
+		// 越接近预算检查越密（最后总是逐个检查），同时限制步长，单个慢 Tick 的超支有界。
+		uint32_t nextCheck = 1;
+		uint32_t checkedAt = 0;
+		while (visited < count)
+		{
+			uint32_t i = first + visited;
+			if (i >= count)
+			{
+				i -= count;
+			}
+			visited++;
+
+			BridgeCore* core = cores[i];
+			if (!core)
+			{
+				continue;
+			}
+
+			// 双缓冲下 Tick 被拒绝时 core 没有推进，欠账保留到下次。
+			const float owed = static_cast<float>(scheduler.clock - scheduler.last_tick[i]);
+			if (Tick(*core, owed))
+			{
+				scheduler.last_tick[i] = scheduler.clock;
+				outStreams[i].ptr = core->Commands().Data();
+				outStreams[i].len = core->Commands().Size();
+			}
+
+			if (visited < nextCheck)
+			{
+				continue;
+			}
+			elapsedNs = elapsedSinceStart();
+			checkedAt = visited;
+			if (elapsedNs >= budgetNs)
+			{
+				break;
+			}
+			const uint64_t perCore = std::max<uint64_t>(elapsedNs / visited, 1);
+			const uint64_t affordable = (budgetNs - elapsedNs) / perCore / 2;
+			nextCheck = visited + static_cast<uint32_t>(std::clamp<uint64_t>(affordable, 1, kMaxCheckStride));
+		}
+		if (checkedAt != visited)
+		{
+			elapsedNs = elapsedSinceStart();
+		}
+
+		scheduler.cursor = first + visited >= count ? first + visited - count : first + visited;
+
+		if (outResult)
+		{
+			outResult->first = first;
+			outResult->count = visited;
+			outResult->elapsed_ns = elapsedNs;
+		}
+	}
+}
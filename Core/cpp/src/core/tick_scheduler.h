@@ -0,0 +1,36 @@
+#pragma once
+
+#include <bridge/bridge.h>
+
+#include <cstdint>
+#include <vector>
+
+// 按时间预算批量 Tick 的调度状态（BridgeTickScheduler_TickManyAndGetCommandStreams 使用）。
+//
+// 每次调用都让时钟前进 dt：没轮到的 core 不 Tick，但欠下这段时间，轮到时以累计的 dt 一次补上。
+// 每个 core 的欠账记为 clock - last_tick[i]，跳过的 core 不需要逐个写入，只有真正 Tick 的 core 才更新。
+// 记账按 cores 数组下标：调用方应每帧传入同一个数组（数组变长时新下标从本帧开始记账，变短时多余的记录被丢弃）。
+struct BridgeTickScheduler
+{
+	double clock = 0.0;
+	std::vector<double> last_tick;
+	uint32_t cursor = 0;
+};
+
+namespace bridge
+{
+	BridgeTickScheduler* CreateTickScheduler();
+	void DestroyTickScheduler(BridgeTickScheduler* scheduler);
+
+	// 从游标开始依次 Tick（环绕），直到耗时达到 budgetNs 或每个 core 都轮过一次；至少 Tick 一个 core。
+	// 在调用线程上串行执行（预算约束的是调用线程的帧时间，不使用 worker 池）。
+	void TickManyWithBudget(
+		BridgeTickScheduler& scheduler,
+		BridgeCore** cores,
+		uint32_t count,
+		float dt,
+		uint64_t budgetNs,
+		BridgeCommandStream* outStreams,
+		float* outDts,
+		BridgeTickBudgetResult* outResult);
+}
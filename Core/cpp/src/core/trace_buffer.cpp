@@ -0,0 +1,241 @@
+#include "trace_buffer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+	#include <intrin.h>
+	#define BRIDGE_TRACE_TSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+	#include <x86intrin.h>
+	#define BRIDGE_TRACE_TSC 1
+#else
+	#define BRIDGE_TRACE_TSC 0
+#endif
+
+namespace
+{
+	// 每线程 64K 个事件（2 MiB）。
+	constexpr uint64_t kRingCapacity = 1u << 16;
+
+	enum TracePhase : uint32_t
+	{
+		kPhaseBegin = 0,
+		kPhaseEnd = 1
+	};
+
+	struct TraceEvent
+	{
+		uint64_t ticks;
+		const char* name;
+		uint32_t trace_id;
+		uint32_t phase;
+		uint32_t value;
+	};
+
+	uint64_t ReadTicks()
+	{
+#if BRIDGE_TRACE_TSC
+		return __rdtsc();
+#else
+		return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+	}
+
+	uint64_t SteadyNs()
+	{
+		return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count());
+	}
+
+	struct TraceRing
+	{
+		std::unique_ptr<TraceEvent[]> events = std::make_unique<TraceEvent[]>(kRingCapacity);
+		std::atomic<uint64_t> head{0};
+		// ClearTrace 之后从这里开始导出（只由导出/清空方写）。
+		std::atomic<uint64_t> tail{0};
+		uint32_t thread_index = 0;
+
+		void Push(const char* name, uint32_t traceId, uint32_t phase, uint32_t value)
+		{
+			const uint64_t h = head.load(std::memory_order_relaxed);
+			TraceEvent& e = events[h & (kRingCapacity - 1)];
+			e.ticks = ReadTicks();
+			e.name = name;
+			e.trace_id = traceId;
+			e.phase = phase;
+			e.value = value;
+			head.store(h + 1, std::memory_order_release);
+		}
+	};
+
+	class TraceRegistry
+	{
+	public:
+		static TraceRegistry& Instance()
+		{
+			// 有意不析构：线程退出、DLL 卸载阶段仍可能有事件写入。
+			static TraceRegistry* instance = new TraceRegistry();
+			return *instance;
+		}
+
+		TraceRing* Register()
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			rings_.push_back(std::make_unique<TraceRing>());
+			rings_.back()->thread_index = static_cast<uint32_t>(rings_.size());
+			return rings_.back().get();
+		}
+
+		template <class TFn>
+		void ForEachRing(TFn&& fn)
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			for (auto& ring : rings_)
+			{
+				fn(*ring);
+			}
+		}
+
+		uint64_t origin_ticks = ReadTicks();
+		uint64_t origin_ns = SteadyNs();
+
+	private:
+		TraceRegistry() = default;
+
+		std::mutex mutex_;
+		std::vector<std::unique_ptr<TraceRing>> rings_;
+	};
+
+	thread_local TraceRing* t_ring = nullptr;
+
+	TraceRing& LocalRing()
+	{
+		if (!t_ring)
+		{
+			t_ring = TraceRegistry::Instance().Register();
+		}
+		return *t_ring;
+	}
+
+	// zone 名来自代码中的字面量，这里只转义 JSON 必须转义的字符。
+	void WriteJsonString(std::FILE* f, const char* s)
+	{
+		std::fputc('"', f);
+		for (; s && *s; ++s)
+		{
+			const unsigned char c = static_cast<unsigned char>(*s);
+			if (c == '"' || c == '\\')
+			{
+				std::fputc('\\', f);
+				std::fputc(c, f);
+			}
+			else if (c < 0x20)
+			{
+				std::fprintf(f, "\\u%04x", c);
+			}
+			else
+			{
+				std::fputc(c, f);
+			}
+		}
+		std::fputc('"', f);
+	}
+}
+
+namespace bridge
+{
+	void TraceBegin(const char* name, uint32_t traceId)
+	{
+		LocalRing().Push(name, traceId, kPhaseBegin, 0);
+	}
+
+	void TraceEnd(const char* name, uint32_t traceId, uint32_t value)
+	{
+		LocalRing().Push(name, traceId, kPhaseEnd, value);
+	}
+
+	uint32_t AllocTraceId()
+	{
+		static std::atomic<uint32_t> next{1};
+		return next.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	bool DumpTrace(const char* path)
+	{
+		std::FILE* f = std::fopen(path, "wb");
+		if (!f)
+		{
+			return false;
+		}
+
+		TraceRegistry& registry = TraceRegistry::Instance();
+
+		// 用创建注册表以来的 steady_clock 区间校准 ticks -> ns。
+		double nsPerTick = 1.0;
+#if BRIDGE_TRACE_TSC
+		const uint64_t nowTicks = ReadTicks();
+		const uint64_t nowNs = SteadyNs();
+		if (nowTicks > registry.origin_ticks && nowNs > registry.origin_ns)
+		{
+			nsPerTick = static_cast<double>(nowNs - registry.origin_ns) / static_cast<double>(nowTicks - registry.origin_ticks);
+		}
+#endif
+
+		std::fprintf(f, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+		bool first = true;
+		registry.ForEachRing([&](TraceRing& ring) {
+			std::fprintf(f, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"bridge thread %u\"}}",
+				first ? "" : ",", ring.thread_index, ring.thread_index);
+			first = false;
+
+			const uint64_t head = ring.head.load(std::memory_order_acquire);
+			const uint64_t begin = std::max(ring.tail.load(std::memory_order_relaxed), head > kRingCapacity ? head - kRingCapacity : 0);
+
+			// 环形缓冲覆盖掉的开始事件：其对应的结束事件也跳过，保证导出的 B/E 成对嵌套。
+			uint32_t depth = 0;
+			for (uint64_t i = begin; i < head; ++i)
+			{
+				const TraceEvent& e = ring.events[i & (kRingCapacity - 1)];
+				if (e.phase == kPhaseEnd)
+				{
+					if (depth == 0)
+					{
+						continue;
+					}
+					depth--;
+				}
+				else
+				{
+					depth++;
+				}
+
+				const double us = (static_cast<double>(e.ticks - registry.origin_ticks) * nsPerTick) / 1000.0;
+				std::fprintf(f, ",{\"name\":");
+				WriteJsonString(f, e.name);
+				std::fprintf(f, ",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":%u,\"args\":{\"core\":%u",
+					e.phase == kPhaseBegin ? 'B' : 'E', us, ring.thread_index, e.trace_id);
+				if (e.value != 0)
+				{
+					std::fprintf(f, ",\"value\":%u", e.value);
+				}
+				std::fprintf(f, "}}");
+			}
+		});
+		std::fprintf(f, "]}\n");
+		return std::fclose(f) == 0;
+	}
+
+	void ClearTrace()
+	{
+		TraceRegistry::Instance().ForEachRing([](TraceRing& ring) {
+			ring.tail.store(ring.head.load(std::memory_order_acquire), std::memory_order_relaxed);
+		});
+	}
+}
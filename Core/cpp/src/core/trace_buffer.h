@@ -0,0 +1,25 @@
+#pragma once
+
+#include <bridge/runtime/trace.h>
+
+#include <cstdint>
+
+namespace bridge
+{
+	// 追踪缓冲的进程级管理（TraceBegin/TraceEnd 的实现也在 trace_buffer.cpp）。
+	//
+	// - 每个线程第一次记录事件时分配自己的环形缓冲并登记到全局表（只有登记时加锁）；
+	//   缓冲在进程结束前不释放，线程退出后其事件仍可导出。
+	// - 写入方只有本线程：写事件后以 release 发布 head，导出方以 acquire 读取。
+	// - 时间戳在 x86/x64 上取 TSC（写入只需几纳秒），导出时按 steady_clock 校准为微秒；其它平台直接用 steady_clock。
+
+	// 为新 core 分配追踪 id（从 1 开始）。
+	uint32_t AllocTraceId();
+
+	// 把所有线程缓冲中的事件写成 Chrome trace JSON（chrome://tracing / ui.perfetto.dev 可直接打开）。
+	// 应在没有 Tick 进行时调用；不清空缓冲。
+	bool DumpTrace(const char* path);
+
+	// 丢弃所有线程缓冲中已记录的事件。
+	void ClearTrace();
+}
@@ -0,0 +1,102 @@
+#include <bridge/runtime/transform_store.h>
+
+#include <algorithm>
+#include <bit>
+
+namespace bridge
+{
+	TransformHandle TransformStore::Create(uint64_t entityId, const BridgeTransform& initial)
+	{
+		uint32_t slot;
+		if (!free_slots_.empty())
+		{
+			slot = free_slots_.back();
+			free_slots_.pop_back();
+		}
+		else
+		{
+			slot = static_cast<uint32_t>(generations_.size());
+			positions_.emplace_back();
+			rotations_.emplace_back();
+			scales_.emplace_back();
+			entity_ids_.emplace_back();
+			generations_.push_back(1);
+			dirty_mask_.push_back(0);
+			if ((slot >> 6) >= dirty_bits_.size())
+			{
+				dirty_bits_.push_back(0);
+			}
+		}
+
+		positions_[slot] = Vec3(initial.position);
+		rotations_[slot] = initial.rotation;
+		scales_[slot] = Vec3(initial.scale);
+		entity_ids_[slot] = entityId;
+		return (static_cast<uint64_t>(generations_[slot]) << 32) | slot;
+	}
+
+	void TransformStore::Destroy(TransformHandle handle)
+	{
+		const uint32_t slot = Slot(handle);
+		if (slot == kNoSlot)
+		{
+			return;
+		}
+
+		// 脏字可能仍留在 dirty_words_ 中：Flush 遇到全零的字直接跳过。
+		dirty_mask_[slot] = 0;
+		dirty_bits_[slot >> 6] &= ~(uint64_t{1} << (slot & 63u));
+
+		uint32_t& generation = generations_[slot];
+		generation = generation + 1 != 0 ? generation + 1 : 1;
+		free_slots_.push_back(slot);
+	}
+
+	void TransformStore::Clear()
+	{
+		positions_.clear();
+		rotations_.clear();
+		scales_.clear();
+		entity_ids_.clear();
+		generations_.clear();
+		free_slots_.clear();
+		dirty_mask_.clear();
+		dirty_bits_.clear();
+		dirty_words_.clear();
+	}
+
+	void TransformStore::Flush(CoreContext& ctx)
+	{
+		// 按槽位顺序输出：各分量数组顺序访问，命令顺序也与实体创建顺序一致（不随写入顺序变化）。
+		std::sort(dirty_words_.begin(), dirty_words_.end());
+
+		const bool bound = emit_position_ && emit_transform_;
+		for (const uint32_t w : dirty_words_)
+		{
+			uint64_t bits = dirty_bits_[w];
+			dirty_bits_[w] = 0;
+			while (bits != 0)
+			{
+				const uint32_t slot = (w << 6) + static_cast<uint32_t>(std::countr_zero(bits));
+				bits &= bits - 1;
+
+				const uint32_t mask = dirty_mask_[slot];
+				dirty_mask_[slot] = 0;
+				if (!bound)
+				{
+					continue;
+				}
+				if (mask == kTransformPosition)
+				{
+					emit_position_(ctx, entity_ids_[slot], positions_[slot]);
+				}
+				else
+				{
+					const BridgeTransform transform{positions_[slot], rotations_[slot], scales_[slot]};
+					emit_transform_(ctx, entity_ids_[slot], mask, transform);
+				}
+			}
+		}
+		dirty_words_.clear();
+	}
+}
@@ -0,0 +1,86 @@
+using System;
+
+namespace Bridge.Core
+{
+    /// <summary>
+    /// 原生 <c>BridgeAssetCache</c> 的托管封装：挂在同一个缓存上的 core 请求同一资源时，只有第一个请求发给 Host，
+    /// 结果由 Runtime 转给其它 core（作为各自的 Host->Core 调用）。
+    /// </summary>
+    /// <remarks>
+    /// Host 侧不需要改动：照常处理收到的 LoadAsset 并回执。缓存必须在挂在上面的 core 全部销毁（或摘下）之后再 Dispose。
+    /// </remarks>
+    public sealed class BridgeAssetCache : IDisposable
+    {
+        private IntPtr _handle;
+
+        /// <param name="loadedFuncId">“加载完成”调用的 func_id（例如生成的 AssetLoaded），其 payload 以 ulong requestId 开头。</param>
+        /// <param name="payloadSize">该调用的 payload 字节数（例如 sizeof(CoreArgs_AssetLoaded)）。</param>
+        /// <param name="statusOffset">payload 中 <see cref="BridgeAssetStatus"/> 字段的字节偏移：只缓存成功的结果。</param>
+        public BridgeAssetCache(uint loadedFuncId, uint payloadSize, uint statusOffset)
+        {
+            var config = new BridgeAssetCacheConfig
+            {
+                LoadedFuncId = loadedFuncId,
+                PayloadSize = payloadSize,
+                StatusOffset = statusOffset,
+            };
+            _handle = BridgeNative.BridgeAssetCache_Create(config);
+            if (_handle == IntPtr.Zero)
+                throw new InvalidOperationException("BridgeAssetCache_Create returned null");
+        }
+
+        /// <summary>把一批 core 挂到本缓存（只能在 Tick 之外调用）。</summary>
+        public void Attach(IntPtr[] coreHandles)
+        {
+            ThrowIfDisposed();
+            SetCache(coreHandles, _handle);
+        }
+
+        /// <summary>把一批 core 从所挂的缓存上摘下（只能在 Tick 之外调用）。</summary>
+        public static void Detach(IntPtr[] coreHandles)
+        {
+            SetCache(coreHandles, IntPtr.Zero);
+        }
+
+        public unsafe BridgeAssetCacheStats GetStats()
+        {
+            ThrowIfDisposed();
+            BridgeAssetCacheStats stats;
+            var status = BridgeNative.BridgeAssetCache_GetStats(_handle, &stats);
+            if (status != BridgeResult.Ok)
+                throw new InvalidOperationException($"BridgeAssetCache_GetStats failed: {status}");
+            return stats;
+        }
+
+        public void Dispose()
+        {
+            if (_handle != IntPtr.Zero)
+            {
+                BridgeNative.BridgeAssetCache_Destroy(_handle);
+                _handle = IntPtr.Zero;
+            }
+            GC.SuppressFinalize(this);
+        }
+
+        private static unsafe void SetCache(IntPtr[] coreHandles, IntPtr cache)
+        {
+            if (coreHandles == null)
+                throw new ArgumentNullException(nameof(coreHandles));
+            if (coreHandles.Length == 0)
+                return;
+
+            fixed (IntPtr* corePtrs = coreHandles)
+            {
+                var status = BridgeNative.BridgeCore_SetAssetCache(corePtrs, (uint)coreHandles.Length, cache);
+                if (status != BridgeResult.Ok)
+                    throw new InvalidOperationException($"BridgeCore_SetAssetCache failed: {status}");
+            }
+        }
+
+        private void ThrowIfDisposed()
+        {
+            if (_handle == IntPtr.Zero)
+                throw new ObjectDisposedException(nameof(BridgeAssetCache));
+        }
+    }
+}
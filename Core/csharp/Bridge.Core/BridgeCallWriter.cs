@@ -0,0 +1,122 @@
+using System;
+using System.Runtime.InteropServices;
+
+namespace Bridge.Core
+{
+    /// <summary>
+    /// Host→Core 调用的预编码缓冲：本帧的事件逐条 Append，之后用 <see cref="BridgeCore.PushCalls"/> /
+    /// <see cref="BridgeCore.PushCallsMany"/> 一次提交（一次跨边界调用、一次拷贝）。
+    /// </summary>
+    /// <remarks>
+    /// 缓冲为非托管内存，Clear 不释放，稳态下零分配。格式见 <see cref="BridgeCallCoreHeader"/>。
+    /// 提交不会清空缓冲；复用前需调用 <see cref="Clear"/>。
+    /// </remarks>
+    public sealed unsafe class BridgeCallWriter : IDisposable
+    {
+        private byte* _ptr;
+        private int _capacity;
+        private int _length;
+
+        public BridgeCallWriter(int initialCapacity = 256)
+        {
+            _capacity = Math.Max(initialCapacity, 64);
+            _ptr = (byte*)Marshal.AllocHGlobal(_capacity);
+        }
+
+        ~BridgeCallWriter()
+        {
+            Free();
+        }
+
+        public int Length => _length;
+        public bool IsEmpty => _length == 0;
+
+        public BridgeCallBuffer AsBuffer() => new BridgeCallBuffer((IntPtr)_ptr, (uint)_length);
+
+        public void Append(uint funcId)
+        {
+            var header = (BridgeCallCoreHeader*)Reserve(sizeof(BridgeCallCoreHeader));
+            header->FuncId = funcId;
+            header->PayloadSize = 0;
+        }
+
+        public void Append<T>(uint funcId, in T payload) where T : unmanaged
+        {
+            Encode(Reserve(SizeOf<T>()), funcId, in payload);
+        }
+
+        /// <summary>
+        /// 一条携带 T 的调用编码后占用的字节数（header + 按 8 字节补齐的 payload）。
+        /// </summary>
+        public static int SizeOf<T>() where T : unmanaged
+            => sizeof(BridgeCallCoreHeader) + ((sizeof(T) + 7) & ~7);
+
+        /// <summary>
+        /// 把一条调用编码到 <paramref name="dst"/> 开头（例如 <see cref="BridgeCore.AcquireCallBuffer"/> 返回的区域），返回写入的字节数。
+        /// </summary>
+        public static int Write<T>(Span<byte> dst, uint funcId, in T payload) where T : unmanaged
+        {
+            int size = SizeOf<T>();
+            if (dst.Length < size)
+                throw new ArgumentException("Destination too small", nameof(dst));
+            fixed (byte* p = dst)
+                Encode(p, funcId, in payload);
+            return size;
+        }
+
+        private static void Encode<T>(byte* dst, uint funcId, in T payload) where T : unmanaged
+        {
+            var header = (BridgeCallCoreHeader*)dst;
+            header->FuncId = funcId;
+            header->PayloadSize = (uint)sizeof(T);
+
+            int aligned = (sizeof(T) + 7) & ~7;
+            byte* payloadPtr = dst + sizeof(BridgeCallCoreHeader);
+            *(T*)payloadPtr = payload;
+            for (int i = sizeof(T); i < aligned; i++)
+                payloadPtr[i] = 0;
+        }
+
+        public void Clear()
+        {
+            _length = 0;
+        }
+
+        public void Dispose()
+        {
+            Free();
+            GC.SuppressFinalize(this);
+        }
+
+        private byte* Reserve(int bytes)
+        {
+            if (_ptr == null)
+                throw new ObjectDisposedException(nameof(BridgeCallWriter));
+
+            int required = _length + bytes;
+            if (required > _capacity)
+            {
+                int capacity = _capacity;
+                while (capacity < required)
+                    capacity *= 2;
+                _ptr = (byte*)Marshal.ReAllocHGlobal((IntPtr)_ptr, (IntPtr)capacity);
+                _capacity = capacity;
+            }
+
+            byte* dst = _ptr + _length;
+            _length = required;
+            return dst;
+        }
+
+        private void Free()
+        {
+            if (_ptr != null)
+            {
+                Marshal.FreeHGlobal((IntPtr)_ptr);
+                _ptr = null;
+                _capacity = 0;
+                _length = 0;
+            }
+        }
+    }
+}
@@ -0,0 +1,69 @@
+using System;
+
+namespace Bridge.Core
+{
+    /// <summary>
+    /// 原生 <c>BridgeRecording</c> 的托管封装：只读打开 <see cref="BridgeCore.BeginRecording"/> 录制的文件，逐帧回放。
+    /// </summary>
+    /// <remarks>
+    /// 帧数据指向录制文件的映射内存（字符串 view 已改写为映射地址），在 <see cref="Dispose"/> 之前一直有效：
+    /// Stream 可直接交给 Host 的分发器（不运行 Core），Inbound 可交给 <see cref="BridgeCore.PushCalls(BridgeCallBuffer)"/>（不运行 Host）。
+    /// </remarks>
+    public sealed class BridgeRecording : IDisposable
+    {
+        private IntPtr _handle;
+
+        public BridgeRecordingHeader Header { get; }
+
+        public int FrameCount => (int)Header.FrameCount;
+
+        private BridgeRecording(IntPtr handle, BridgeRecordingHeader header)
+        {
+            _handle = handle;
+            Header = header;
+        }
+
+        public static unsafe BridgeRecording Open(string path)
+        {
+            if (string.IsNullOrEmpty(path))
+                throw new ArgumentNullException(nameof(path));
+
+            byte[] utf8 = System.Text.Encoding.UTF8.GetBytes(path + "\0");
+            IntPtr handle;
+            fixed (byte* pathPtr = utf8)
+            {
+                handle = BridgeNative.BridgeRecording_Open(pathPtr);
+            }
+            if (handle == IntPtr.Zero)
+                throw new InvalidOperationException($"BridgeRecording_Open failed: {path}");
+
+            BridgeNative.BridgeRecording_GetHeader(handle, out BridgeRecordingHeader header);
+            return new BridgeRecording(handle, header);
+        }
+
+        public BridgeRecordedFrame GetFrame(int index)
+        {
+            ThrowIfDisposed();
+            if ((uint)index >= Header.FrameCount)
+                throw new ArgumentOutOfRangeException(nameof(index));
+            BridgeNative.BridgeRecording_GetFrame(_handle, (uint)index, out BridgeRecordedFrame frame);
+            return frame;
+        }
+
+        public void Dispose()
+        {
+            if (_handle != IntPtr.Zero)
+            {
+                BridgeNative.BridgeRecording_Close(_handle);
+                _handle = IntPtr.Zero;
+            }
+            GC.SuppressFinalize(this);
+        }
+
+        private void ThrowIfDisposed()
+        {
+            if (_handle == IntPtr.Zero)
+                throw new ObjectDisposedException(nameof(BridgeRecording));
+        }
+    }
+}
@@ -0,0 +1,67 @@
+using System;
+
+namespace Bridge.Core
+{
+    /// <summary>
+    /// 原生 <c>BridgeTickScheduler</c> 的托管封装：按时间预算批量 Tick，没轮到的 core 累计欠下的 dt，下一帧从轮转游标继续。
+    /// </summary>
+    /// <remarks>
+    /// 欠账按数组下标记录，每帧应传入同一个 handles 数组。没轮到的 core 输出空 stream；
+    /// dts[i] 为轮到的 core 本次所用的 dt，或没轮到的 core 目前欠下的 dt。
+    /// </remarks>
+    public sealed class BridgeTickScheduler : IDisposable
+    {
+        private IntPtr _handle;
+
+        public BridgeTickScheduler()
+        {
+            _handle = BridgeNative.BridgeTickScheduler_Create();
+            if (_handle == IntPtr.Zero)
+                throw new InvalidOperationException("BridgeTickScheduler_Create returned null");
+        }
+
+        public unsafe BridgeTickBudgetResult TickManyAndGetCommandStreams(IntPtr[] coreHandles, float dt, ulong budgetNs, CommandStream[] streams, float[]? dts = null)
+        {
+            ThrowIfDisposed();
+            if (coreHandles == null)
+                throw new ArgumentNullException(nameof(coreHandles));
+            if (streams == null)
+                throw new ArgumentNullException(nameof(streams));
+            if (streams.Length < coreHandles.Length)
+                throw new ArgumentException("streams.Length must be >= coreHandles.Length", nameof(streams));
+            if (dts != null && dts.Length < coreHandles.Length)
+                throw new ArgumentException("dts.Length must be >= coreHandles.Length", nameof(dts));
+
+            int count = coreHandles.Length;
+            if (count == 0)
+                return default;
+
+            BridgeTickBudgetResult result;
+            fixed (IntPtr* corePtrs = coreHandles)
+            fixed (CommandStream* outStreams = streams)
+            fixed (float* outDts = dts)
+            {
+                var status = BridgeNative.BridgeTickScheduler_TickManyAndGetCommandStreams(_handle, corePtrs, (uint)count, dt, budgetNs, outStreams, outDts, &result);
+                if (status != BridgeResult.Ok)
+                    throw new InvalidOperationException($"BridgeTickScheduler_TickManyAndGetCommandStreams failed: {status}");
+            }
+            return result;
+        }
+
+        public void Dispose()
+        {
+            if (_handle != IntPtr.Zero)
+            {
+                BridgeNative.BridgeTickScheduler_Destroy(_handle);
+                _handle = IntPtr.Zero;
+            }
+            GC.SuppressFinalize(this);
+        }
+
+        private void ThrowIfDisposed()
+        {
+            if (_handle == IntPtr.Zero)
+                throw new ObjectDisposedException(nameof(BridgeTickScheduler));
+        }
+    }
+}
@@ -0,0 +1,27 @@
+namespace Bridge.Core
+{
+    /// <summary>
+    /// 一条 <see cref="BridgeCmdCallHostBatch"/> 中的 payload 视图（同一函数的连续调用，按顺序排列）。
+    /// </summary>
+    /// <remarks>
+    /// 直接指向 command stream，不复制；只在本次分发回调内有效，不要保存。
+    /// 相邻元素间隔 Stride 字节（sizeof(T) 按 8 字节补齐），因此按下标访问而不是暴露为 Span。
+    /// </remarks>
+    public readonly unsafe ref struct HostCallBatch<T>
+        where T : unmanaged
+    {
+        private readonly byte* _ptr;
+        private readonly int _stride;
+
+        public readonly int Count;
+
+        public HostCallBatch(byte* ptr, int count, int stride)
+        {
+            _ptr = ptr;
+            Count = count;
+            _stride = stride;
+        }
+
+        public ref readonly T this[int index] => ref *(T*)(_ptr + (long)index * _stride);
+    }
+}
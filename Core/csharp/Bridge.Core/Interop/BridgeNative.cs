@@ -45,5 +45,170 @@ namespace Bridge.Core
             uint funcId,
             IntPtr payload,
             uint payloadSize);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern BridgeResult BridgeCore_SetTickWorkerCount(uint workerCount);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern unsafe BridgeResult BridgeCore_TickManyBegin(
+            IntPtr* cores,
+            uint count,
+            float dt,
+            CommandStream* outStreams);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern unsafe BridgeResult BridgeCore_PollCompletedShards(
+            BridgeTickShard* outShards,
+            uint capacity,
+            out uint count,
+            out uint remaining);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern IntPtr BridgeCoreGroup_Create();
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void BridgeCoreGroup_Destroy(IntPtr group);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern unsafe BridgeResult BridgeCoreGroup_TickManyAndGetCommandStreams(
+            IntPtr group,
+            IntPtr* cores,
+            uint count,
+            float dt,
+            CommandStream* outStreams);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern BridgeResult BridgeCore_ReleaseStream(IntPtr core);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern BridgeResult BridgeCore_PushCallsCore(
+            IntPtr core,
+            IntPtr calls,
+            uint len);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern unsafe BridgeResult BridgeCore_PushCallsMany(
+            IntPtr* cores,
+            BridgeCallBuffer* buffers,
+            uint count);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern BridgeResult BridgeCore_AcquireCallBuffer(
+            IntPtr core,
+            uint bytes,
+            out IntPtr ptr);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern BridgeResult BridgeCore_CommitCalls(IntPtr core, uint bytesWritten);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern unsafe BridgeResult Bridge_GetHostOpcodes(BridgeHostOpcode** outEntries, uint* outCount);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern BridgeResult BridgeCore_GetStats(IntPtr core, out BridgeCoreStats stats);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern unsafe BridgeResult BridgeCore_GetStatsMany(
+            IntPtr* cores,
+            uint count,
+            BridgeCoreStats* perCore,
+            BridgeCoreStats* total);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern unsafe BridgeResult BridgeCore_GetFuncStats(
+            IntPtr core,
+            BridgeFuncStats* entries,
+            uint capacity,
+            out uint count);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern BridgeResult BridgeCore_ResetStats(IntPtr core);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern BridgeResult BridgeCore_SetTraceEnabled(IntPtr core, uint enabled);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern unsafe BridgeResult BridgeCore_SetTraceEnabledMany(
+            IntPtr* cores,
+            uint count,
+            uint enabled);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern unsafe BridgeResult Bridge_TraceDump(byte* path);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void Bridge_TraceClear();
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern unsafe BridgeResult BridgeCore_BeginRecording(IntPtr core, byte* path);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern BridgeResult BridgeCore_EndRecording(IntPtr core);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern unsafe IntPtr BridgeRecording_Open(byte* path);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void BridgeRecording_Close(IntPtr recording);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern BridgeResult BridgeRecording_GetHeader(IntPtr recording, out BridgeRecordingHeader header);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern BridgeResult BridgeRecording_GetFrame(
+            IntPtr recording,
+            uint index,
+            out BridgeRecordedFrame frame);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern unsafe BridgeResult BridgeCore_CreateMany(
+            BridgeCoreConfig* configs,
+            uint count,
+            IntPtr* outCores);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern BridgeResult BridgeCore_Reset(IntPtr core, BridgeCoreConfig config);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern IntPtr BridgeCore_Clone(IntPtr source, ulong seed);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern unsafe BridgeResult BridgeCore_CloneMany(
+            IntPtr source,
+            ulong* seeds,
+            uint count,
+            IntPtr* outCores);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern IntPtr BridgeTickScheduler_Create();
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void BridgeTickScheduler_Destroy(IntPtr scheduler);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern unsafe BridgeResult BridgeTickScheduler_TickManyAndGetCommandStreams(
+            IntPtr scheduler,
+            IntPtr* cores,
+            uint count,
+            float dt,
+            ulong budgetNs,
+            CommandStream* outStreams,
+            float* outDts,
+            BridgeTickBudgetResult* outResult);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern IntPtr BridgeAssetCache_Create(BridgeAssetCacheConfig config);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void BridgeAssetCache_Destroy(IntPtr cache);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern unsafe BridgeResult BridgeCore_SetAssetCache(
+            IntPtr* cores,
+            uint count,
+            IntPtr cache);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern unsafe BridgeResult BridgeAssetCache_GetStats(IntPtr cache, BridgeAssetCacheStats* outStats);
     }
 }
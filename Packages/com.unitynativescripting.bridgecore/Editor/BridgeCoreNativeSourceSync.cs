@@ -86,11 +86,35 @@ namespace Bridge.Core.Unity.Editor
 				Path.Combine(repoRoot, "Core", "cpp", "include", "bridge", "runtime", "core_app.h"),
 				Path.Combine(repoRoot, "Core", "cpp", "include", "bridge", "runtime", "core_context.h"),
 				Path.Combine(repoRoot, "Core", "cpp", "include", "bridge", "runtime", "game_entry.h"),
+				Path.Combine(repoRoot, "Core", "cpp", "include", "bridge", "runtime", "trace.h"),
+				Path.Combine(repoRoot, "Core", "cpp", "include", "bridge", "runtime", "transform_store.h"),
 
+				Path.Combine(repoRoot, "Core", "cpp", "src", "core", "asset_cache.h"),
+				Path.Combine(repoRoot, "Core", "cpp", "src", "core", "asset_cache.cpp"),
+				Path.Combine(repoRoot, "Core", "cpp", "src", "core", "command_buffer.h"),
+				Path.Combine(repoRoot, "Core", "cpp", "src", "core", "command_buffer.cpp"),
 				Path.Combine(repoRoot, "Core", "cpp", "src", "core", "command_stream.h"),
 				Path.Combine(repoRoot, "Core", "cpp", "src", "core", "command_stream.cpp"),
+				Path.Combine(repoRoot, "Core", "cpp", "src", "core", "core_group.h"),
+				Path.Combine(repoRoot, "Core", "cpp", "src", "core", "core_group.cpp"),
 				Path.Combine(repoRoot, "Core", "cpp", "src", "core", "core_instance.h"),
 				Path.Combine(repoRoot, "Core", "cpp", "src", "core", "core_instance.cpp"),
+				Path.Combine(repoRoot, "Core", "cpp", "src", "core", "core_recording.h"),
+				Path.Combine(repoRoot, "Core", "cpp", "src", "core", "core_recording.cpp"),
+				Path.Combine(repoRoot, "Core", "cpp", "src", "core", "core_slab.h"),
+				Path.Combine(repoRoot, "Core", "cpp", "src", "core", "core_stats.h"),
+				Path.Combine(repoRoot, "Core", "cpp", "src", "core", "core_stats.cpp"),
+				Path.Combine(repoRoot, "Core", "cpp", "src", "core", "inbound_call_queue.h"),
+				Path.Combine(repoRoot, "Core", "cpp", "src", "core", "inbound_call_queue.cpp"),
+				Path.Combine(repoRoot, "Core", "cpp", "src", "core", "string_interner.h"),
+				Path.Combine(repoRoot, "Core", "cpp", "src", "core", "string_interner.cpp"),
+				Path.Combine(repoRoot, "Core", "cpp", "src", "core", "tick_pool.h"),
+				Path.Combine(repoRoot, "Core", "cpp", "src", "core", "tick_pool.cpp"),
+				Path.Combine(repoRoot, "Core", "cpp", "src", "core", "tick_scheduler.h"),
+				Path.Combine(repoRoot, "Core", "cpp", "src", "core", "tick_scheduler.cpp"),
+				Path.Combine(repoRoot, "Core", "cpp", "src", "core", "trace_buffer.h"),
+				Path.Combine(repoRoot, "Core", "cpp", "src", "core", "trace_buffer.cpp"),
+				Path.Combine(repoRoot, "Core", "cpp", "src", "core", "transform_store.cpp"),
 				Path.Combine(repoRoot, "Core", "cpp", "src", "api", "bridge_api.cpp"),
 
 				Path.Combine(repoRoot, "Tests", "cpp", "demo_game", "src", "demo_asset_app.h"),
@@ -125,9 +149,14 @@ namespace Bridge.Core.Unity.Editor
 			text = text.Replace("#include <bridge/runtime/core_app.h>", "#include \"core_app.h\"");
 			text = text.Replace("#include <bridge/runtime/core_context.h>", "#include \"core_context.h\"");
 			text = text.Replace("#include <bridge/runtime/game_entry.h>", "#include \"game_entry.h\"");
+			text = text.Replace("#include <bridge/runtime/trace.h>", "#include \"trace.h\"");
+			text = text.Replace("#include <bridge/runtime/transform_store.h>", "#include \"transform_store.h\"");
 
 			// bridge_api.cpp relative include (when copied out of src/api)
 			text = text.Replace("#include \"../core/core_instance.h\"", "#include \"core_instance.h\"");
+			text = text.Replace("#include \"../core/asset_cache.h\"", "#include \"asset_cache.h\"");
+			text = text.Replace("#include \"../core/core_group.h\"", "#include \"core_group.h\"");
+			text = text.Replace("#include \"../core/tick_scheduler.h\"", "#include \"tick_scheduler.h\"");
 
 			File.WriteAllText(dst, text);
 		}
@@ -1,4 +1,5 @@
 using System;
+using System.Runtime.InteropServices;
 
 namespace Bridge.Core
 {
@@ -16,20 +17,116 @@ namespace Bridge.Core
 #endif
 
         [ThreadStatic] private static IntPtr[]? s_tickManyCorePtrs;
+        [ThreadStatic] private static BridgeCallBuffer[]? s_pushCallsBuffers;
+
+        // 异步批次（TickManyBegin → PollCompletedShards）期间固定的 cores/streams 数组。
+        private static GCHandle s_asyncCoresPin;
+        private static GCHandle s_asyncStreamsPin;
 
         private IntPtr _handle;
 
-        public BridgeCore(ulong seed = 1, bool robotMode = false)
+        public BridgeCore(ulong seed = 1, bool robotMode = false, BridgeCoreFlags flags = BridgeCoreFlags.None)
+            : this(CreateConfig(seed, robotMode, flags))
+        {
+        }
+
+        public BridgeCore(BridgeCoreConfig config)
+        {
+            _handle = BridgeNative.BridgeCore_Create(config);
+            if (_handle == IntPtr.Zero)
+                throw new InvalidOperationException("BridgeCore_Create returned null");
+        }
+
+        private BridgeCore(IntPtr handle)
+        {
+            _handle = handle;
+        }
+
+        public static BridgeCoreConfig CreateConfig(ulong seed = 1, bool robotMode = false, BridgeCoreFlags flags = BridgeCoreFlags.None)
         {
-            var cfg = new BridgeCoreConfig
+            return new BridgeCoreConfig
             {
                 Seed = seed,
-                Mode = (uint)(robotMode ? BridgeMode.Robot : BridgeMode.Game)
+                Mode = (uint)(robotMode ? BridgeMode.Robot : BridgeMode.Game),
+                Flags = (uint)flags
             };
+        }
 
-            _handle = BridgeNative.BridgeCore_Create(cfg);
-            if (_handle == IntPtr.Zero)
-                throw new InvalidOperationException("BridgeCore_Create returned null");
+        /// <summary>
+        /// 批量创建：所有 core 及其初始缓冲来自同一块连续内存（大量 bot 启动更快、占用更少）。
+        /// 每个 core 仍单独 <see cref="Dispose"/>。
+        /// </summary>
+        public static unsafe BridgeCore[] CreateMany(BridgeCoreConfig[] configs)
+        {
+            if (configs == null)
+                throw new ArgumentNullException(nameof(configs));
+            if (configs.Length == 0)
+                return Array.Empty<BridgeCore>();
+
+            var handles = new IntPtr[configs.Length];
+            fixed (BridgeCoreConfig* configsPtr = configs)
+            fixed (IntPtr* handlesPtr = handles)
+            {
+                var result = BridgeNative.BridgeCore_CreateMany(configsPtr, (uint)configs.Length, handlesPtr);
+                if (result != BridgeResult.Ok)
+                    throw new InvalidOperationException($"BridgeCore_CreateMany failed: {result}");
+            }
+
+            var cores = new BridgeCore[handles.Length];
+            for (int i = 0; i < handles.Length; i++)
+                cores[i] = new BridgeCore(handles[i]);
+            return cores;
+        }
+
+        /// <summary>
+        /// 从本 core（已预热的模板）复制出一个新 core，跳过启动阶段的 Host 往返；副本的 seed 为 <paramref name="seed"/>。
+        /// 尚未分发的调用、统计、追踪与录制不随之复制；业务层不支持克隆时抛出异常。
+        /// </summary>
+        public BridgeCore Clone(ulong seed)
+        {
+            ThrowIfDisposed();
+            var handle = BridgeNative.BridgeCore_Clone(_handle, seed);
+            if (handle == IntPtr.Zero)
+                throw new InvalidOperationException("BridgeCore_Clone returned null");
+            return new BridgeCore(handle);
+        }
+
+        /// <summary>
+        /// 批量克隆：副本 i 的 seed 为 <paramref name="seeds"/>[i]，所有副本来自同一块连续内存（同 <see cref="CreateMany"/>）。
+        /// </summary>
+        public unsafe BridgeCore[] CloneMany(ulong[] seeds)
+        {
+            ThrowIfDisposed();
+            if (seeds == null)
+                throw new ArgumentNullException(nameof(seeds));
+            if (seeds.Length == 0)
+                return Array.Empty<BridgeCore>();
+
+            var handles = new IntPtr[seeds.Length];
+            fixed (ulong* seedsPtr = seeds)
+            fixed (IntPtr* handlesPtr = handles)
+            {
+                var result = BridgeNative.BridgeCore_CloneMany(_handle, seedsPtr, (uint)seeds.Length, handlesPtr);
+                if (result != BridgeResult.Ok)
+                    throw new InvalidOperationException($"BridgeCore_CloneMany failed: {result}");
+            }
+
+            var cores = new BridgeCore[handles.Length];
+            for (int i = 0; i < handles.Length; i++)
+                cores[i] = new BridgeCore(handles[i]);
+            return cores;
+        }
+
+        /// <summary>
+        /// 原地回收为一个按 <paramref name="config"/> 新建的 core（保留缓冲与句柄）。
+        /// 双缓冲模式下须先归还所有 stream；不能与 Tick / 推送调用并发。
+        /// </summary>
+        public void Reset(BridgeCoreConfig config)
+        {
+            ThrowIfDisposed();
+            var result = BridgeNative.BridgeCore_Reset(_handle, config);
+            if (result != BridgeResult.Ok)
+                throw new InvalidOperationException($"BridgeCore_Reset failed: {result}");
         }
 
         public IntPtr UnsafeHandle
@@ -76,6 +173,46 @@ namespace Bridge.Core
             EnsureTickManyCorePtrs(count);
         }
 
+        /// <summary>
+        /// 开启/关闭批量 Tick 的并行模式（进程级，默认 0 = 串行）。
+        /// </summary>
+        /// <remarks>
+        /// 开启后 <see cref="TickManyAndGetCommandStreams(BridgeCore[], float, CommandStream[])"/> 会由原生 worker 池并行 Tick，
+        /// 输出与串行模式一致；要求业务层（ICoreApp）不共享可变全局状态。
+        /// </remarks>
+        public static void SetTickWorkerCount(int workerCount)
+        {
+            if (workerCount < 0)
+                throw new ArgumentOutOfRangeException(nameof(workerCount));
+
+            var result = BridgeNative.BridgeCore_SetTickWorkerCount((uint)workerCount);
+            if (result != BridgeResult.Ok)
+                throw new ArgumentOutOfRangeException(nameof(workerCount), $"BridgeCore_SetTickWorkerCount failed: {result}");
+        }
+
+        /// <summary>
+        /// 稠密 opcode 握手：native 库的 opcode 表与 <paramref name="funcIdsByOpcode"/>（下标 = opcode - <see cref="BridgeCmdCallOp.OpcodeBase"/>）完全一致时返回 true。
+        /// </summary>
+        /// <remarks>
+        /// 通常由生成的 <c>BridgeAllCommandDispatcher.VerifyHostOpcodes()</c> 调用；返回 false 时不要打开 <see cref="BridgeCoreFlags.DenseOpcodes"/>。
+        /// </remarks>
+        public static unsafe bool MatchHostOpcodes(ReadOnlySpan<uint> funcIdsByOpcode)
+        {
+            BridgeHostOpcode* entries = null;
+            uint count = 0;
+            if (BridgeNative.Bridge_GetHostOpcodes(&entries, &count) != BridgeResult.Ok)
+                return false;
+            if (count != (uint)funcIdsByOpcode.Length)
+                return false;
+
+            for (int i = 0; i < funcIdsByOpcode.Length; i++)
+            {
+                if (entries[i].Opcode != BridgeCmdCallOp.OpcodeBase + i || entries[i].FuncId != funcIdsByOpcode[i])
+                    return false;
+            }
+            return true;
+        }
+
         public static unsafe void TickManyAndGetCommandStreams(BridgeCore[] cores, float dt, CommandStream[] streams)
         {
             if (cores == null)
@@ -151,6 +288,73 @@ namespace Bridge.Core
             }
         }
 
+        /// <summary>
+        /// 启动异步批量 Tick：立即返回，之后用 <see cref="PollCompletedShards"/> 按 shard 取回已完成的 streams。
+        /// </summary>
+        /// <remarks>
+        /// <paramref name="coreHandles"/> 与 <paramref name="streams"/> 会被固定（pinned），直到批次结束（remaining == 0）。
+        /// </remarks>
+        public static unsafe void TickManyBegin(IntPtr[] coreHandles, float dt, CommandStream[] streams)
+        {
+            if (coreHandles == null)
+                throw new ArgumentNullException(nameof(coreHandles));
+            if (streams == null)
+                throw new ArgumentNullException(nameof(streams));
+            if (streams.Length < coreHandles.Length)
+                throw new ArgumentException("streams.Length must be >= coreHandles.Length", nameof(streams));
+            if (s_asyncCoresPin.IsAllocated)
+                throw new InvalidOperationException("上一个异步批次尚未结束");
+
+            int count = coreHandles.Length;
+            if (count == 0)
+                return;
+
+            s_asyncCoresPin = GCHandle.Alloc(coreHandles, GCHandleType.Pinned);
+            s_asyncStreamsPin = GCHandle.Alloc(streams, GCHandleType.Pinned);
+
+            var result = BridgeNative.BridgeCore_TickManyBegin(
+                (IntPtr*)s_asyncCoresPin.AddrOfPinnedObject(),
+                (uint)count,
+                dt,
+                (CommandStream*)s_asyncStreamsPin.AddrOfPinnedObject());
+            if (result != BridgeResult.Ok)
+            {
+                ReleaseAsyncPins();
+                throw new InvalidOperationException($"BridgeCore_TickManyBegin failed: {result}");
+            }
+        }
+
+        /// <summary>
+        /// 取回已完成的 shard（返回写入 <paramref name="shards"/> 的个数）。批次未结束时至少返回 1 个。
+        /// </summary>
+        /// <param name="remaining">尚未交还的 core 数；为 0 表示批次已结束。</param>
+        public static unsafe int PollCompletedShards(BridgeTickShard[] shards, out int remaining)
+        {
+            if (shards == null || shards.Length == 0)
+                throw new ArgumentException("shards must be non-empty", nameof(shards));
+
+            uint count;
+            uint left;
+            fixed (BridgeTickShard* outShards = shards)
+            {
+                var result = BridgeNative.BridgeCore_PollCompletedShards(outShards, (uint)shards.Length, out count, out left);
+                if (result != BridgeResult.Ok)
+                    throw new InvalidOperationException($"BridgeCore_PollCompletedShards failed: {result}");
+            }
+
+            if (left == 0)
+                ReleaseAsyncPins();
+
+            remaining = (int)left;
+            return (int)count;
+        }
+
+        private static void ReleaseAsyncPins()
+        {
+            if (s_asyncCoresPin.IsAllocated) s_asyncCoresPin.Free();
+            if (s_asyncStreamsPin.IsAllocated) s_asyncStreamsPin.Free();
+        }
+
         private static void EnsureTickManyCorePtrs(int count)
         {
             s_tickManyCorePtrs ??= new IntPtr[count];
@@ -173,6 +377,21 @@ namespace Bridge.Core
             return new CommandStream(ptr, len);
         }
 
+        /// <summary>
+        /// 双缓冲模式（<see cref="BridgeCoreFlags.DoubleBuffered"/>）：归还最早一帧已分发完的 stream。
+        /// </summary>
+        /// <remarks>
+        /// 第 N 帧的 stream 在第 N+1 帧 Tick 期间保持有效；第 N+2 帧 Tick 前必须归还第 N 帧，否则该次 Tick 被拒绝。
+        /// 可在分发线程上调用。单缓冲模式下为空操作。
+        /// </remarks>
+        public void ReleaseStream()
+        {
+            ThrowIfDisposed();
+            var result = BridgeNative.BridgeCore_ReleaseStream(_handle);
+            if (result != BridgeResult.Ok)
+                throw new InvalidOperationException($"BridgeCore_ReleaseStream failed: {result}");
+        }
+
         public void PushCallCore(uint funcId)
         {
             ThrowIfDisposed();
@@ -185,6 +404,262 @@ namespace Bridge.Core
             BridgeNative.BridgeCore_PushCallCore(_handle, funcId, (IntPtr)(&payload), (uint)sizeof(T));
         }
 
+        /// <summary>
+        /// 一次提交 <paramref name="calls"/> 中预编码的全部调用（整段校验、一次拷贝），下一次 Tick 开始时按顺序分发。
+        /// </summary>
+        public void PushCalls(BridgeCallWriter calls)
+        {
+            if (calls == null)
+                throw new ArgumentNullException(nameof(calls));
+            ThrowIfDisposed();
+            if (calls.IsEmpty)
+                return;
+
+            BridgeCallBuffer buffer = calls.AsBuffer();
+            var result = BridgeNative.BridgeCore_PushCallsCore(_handle, buffer.Ptr, buffer.Length);
+            if (result != BridgeResult.Ok)
+                throw new InvalidOperationException($"BridgeCore_PushCallsCore failed: {result}");
+        }
+
+        /// <summary>
+        /// 提交一段已编码好的调用（例如 <see cref="BridgeRecordedFrame.Inbound"/>），语义同 <see cref="PushCalls(BridgeCallWriter)"/>。
+        /// </summary>
+        public void PushCalls(BridgeCallBuffer calls)
+        {
+            ThrowIfDisposed();
+            if (calls.Length == 0)
+                return;
+
+            var result = BridgeNative.BridgeCore_PushCallsCore(_handle, calls.Ptr, calls.Length);
+            if (result != BridgeResult.Ok)
+                throw new InvalidOperationException($"BridgeCore_PushCallsCore failed: {result}");
+        }
+
+        /// <summary>
+        /// 批量版本：<paramref name="calls"/>[i] 提交给 <paramref name="coreHandles"/>[i]，整批只跨一次边界。
+        /// </summary>
+        /// <remarks>
+        /// 任一输入不合法时整批不生效。适合与 <see cref="TickManyAndGetCommandStreams(IntPtr[], float, CommandStream[])"/> 配套，
+        /// 每帧把所有 bot 的回推事件一次性提交。
+        /// </remarks>
+        public static unsafe void PushCallsMany(IntPtr[] coreHandles, BridgeCallWriter[] calls)
+        {
+            if (coreHandles == null)
+                throw new ArgumentNullException(nameof(coreHandles));
+            if (calls == null)
+                throw new ArgumentNullException(nameof(calls));
+            if (calls.Length < coreHandles.Length)
+                throw new ArgumentException("calls.Length must be >= coreHandles.Length", nameof(calls));
+
+            int count = coreHandles.Length;
+            if (count == 0)
+                return;
+
+            BridgeCallBuffer[]? managed = null;
+            BridgeCallBuffer* buffers;
+            if (count <= StackAllocMaxCount)
+            {
+                BridgeCallBuffer* stackBuffers = stackalloc BridgeCallBuffer[count];
+                buffers = stackBuffers;
+            }
+            else
+            {
+                s_pushCallsBuffers ??= new BridgeCallBuffer[count];
+                if (s_pushCallsBuffers.Length < count) s_pushCallsBuffers = new BridgeCallBuffer[count];
+                managed = s_pushCallsBuffers;
+                buffers = null;
+            }
+
+            fixed (BridgeCallBuffer* managedPtr = managed)
+            fixed (IntPtr* corePtrs = coreHandles)
+            {
+                if (managed != null)
+                    buffers = managedPtr;
+
+                for (int i = 0; i < count; i++)
+                {
+                    BridgeCallWriter writer = calls[i] ?? throw new ArgumentNullException(nameof(calls), $"calls[{i}] is null");
+                    buffers[i] = writer.AsBuffer();
+                }
+
+                var result = BridgeNative.BridgeCore_PushCallsMany(corePtrs, buffers, (uint)count);
+                if (result != BridgeResult.Ok)
+                    throw new InvalidOperationException($"BridgeCore_PushCallsMany failed: {result}");
+            }
+        }
+
+        /// <summary>
+        /// 零拷贝推送：在 core 的待分发缓冲中预留 <paramref name="bytes"/> 字节，调用方直接写入
+        /// （例如用 <see cref="BridgeCallWriter.Write{T}"/> 逐条编码），再用 <see cref="CommitCalls"/> 提交。
+        /// </summary>
+        /// <remarks>
+        /// 返回的 Span 指向原生内存，只在 <see cref="CommitCalls"/> 或下一次 Tick 之前有效；
+        /// 未提交期间对该 core 的其它 Push 调用会失败。
+        /// </remarks>
+        public unsafe Span<byte> AcquireCallBuffer(int bytes)
+        {
+            if (bytes <= 0)
+                throw new ArgumentOutOfRangeException(nameof(bytes));
+            ThrowIfDisposed();
+            var result = BridgeNative.BridgeCore_AcquireCallBuffer(_handle, (uint)bytes, out IntPtr ptr);
+            if (result != BridgeResult.Ok)
+                throw new InvalidOperationException($"BridgeCore_AcquireCallBuffer failed: {result}");
+            return new Span<byte>((void*)ptr, bytes);
+        }
+
+        /// <summary>
+        /// 提交 <see cref="AcquireCallBuffer"/> 区域中实际写入的前 <paramref name="bytesWritten"/> 字节（0 表示放弃）。
+        /// </summary>
+        public void CommitCalls(int bytesWritten)
+        {
+            if (bytesWritten < 0)
+                throw new ArgumentOutOfRangeException(nameof(bytesWritten));
+            ThrowIfDisposed();
+            var result = BridgeNative.BridgeCore_CommitCalls(_handle, (uint)bytesWritten);
+            if (result != BridgeResult.Ok)
+                throw new InvalidOperationException($"BridgeCore_CommitCalls failed: {result}");
+        }
+
+        /// <summary>
+        /// 读取本 core 的运行时统计；native 库未编译统计（BRIDGE_ENABLE_STATS=OFF）时返回 false。
+        /// </summary>
+        public bool TryGetStats(out BridgeCoreStats stats)
+        {
+            ThrowIfDisposed();
+            return BridgeNative.BridgeCore_GetStats(_handle, out stats) == BridgeResult.Ok;
+        }
+
+        /// <summary>
+        /// 批量读取统计：<paramref name="perCore"/> 为空或长度 &gt;= coreHandles.Length；<paramref name="total"/> 为汇总
+        /// （计数求和，峰值与耗时取最大值）。未编译统计时返回 false。
+        /// </summary>
+        public static unsafe bool TryGetStats(IntPtr[] coreHandles, Span<BridgeCoreStats> perCore, out BridgeCoreStats total)
+        {
+            if (coreHandles == null)
+                throw new ArgumentNullException(nameof(coreHandles));
+            if (!perCore.IsEmpty && perCore.Length < coreHandles.Length)
+                throw new ArgumentException("perCore.Length must be >= coreHandles.Length", nameof(perCore));
+
+            BridgeCoreStats sum;
+            BridgeResult result;
+            fixed (IntPtr* corePtrs = coreHandles)
+            fixed (BridgeCoreStats* outPerCore = perCore)
+            {
+                result = BridgeNative.BridgeCore_GetStatsMany(corePtrs, (uint)coreHandles.Length, perCore.IsEmpty ? null : outPerCore, &sum);
+            }
+            if (result == BridgeResult.InvalidArgument)
+                throw new ArgumentException("BridgeCore_GetStatsMany: invalid core handle", nameof(coreHandles));
+            total = sum;
+            return result == BridgeResult.Ok;
+        }
+
+        /// <summary>
+        /// 写出至多 entries.Length 条按 func_id 的调用明细，返回实际的 func_id 个数（可大于 entries.Length；未编译统计时为 0）。
+        /// </summary>
+        public unsafe int GetFuncStats(Span<BridgeFuncStats> entries)
+        {
+            ThrowIfDisposed();
+            uint count;
+            fixed (BridgeFuncStats* outEntries = entries)
+            {
+                BridgeNative.BridgeCore_GetFuncStats(_handle, outEntries, (uint)entries.Length, out count);
+            }
+            return (int)count;
+        }
+
+        /// <summary>
+        /// 清零统计计数（例如按采样窗口统计时）。
+        /// </summary>
+        public void ResetStats()
+        {
+            ThrowIfDisposed();
+            BridgeNative.BridgeCore_ResetStats(_handle);
+        }
+
+        /// <summary>
+        /// 开启/关闭本 core 的帧追踪（Tick 内的 zone 写入线程缓冲，用 <see cref="TraceDump"/> 导出）。
+        /// </summary>
+        public void SetTraceEnabled(bool enabled)
+        {
+            ThrowIfDisposed();
+            var result = BridgeNative.BridgeCore_SetTraceEnabled(_handle, enabled ? 1u : 0u);
+            if (result != BridgeResult.Ok)
+                throw new InvalidOperationException($"BridgeCore_SetTraceEnabled failed: {result}");
+        }
+
+        /// <summary>
+        /// 对一批 core 同时开启/关闭帧追踪。
+        /// </summary>
+        public static unsafe void SetTraceEnabled(IntPtr[] coreHandles, bool enabled)
+        {
+            if (coreHandles == null)
+                throw new ArgumentNullException(nameof(coreHandles));
+
+            BridgeResult result;
+            fixed (IntPtr* corePtrs = coreHandles)
+            {
+                result = BridgeNative.BridgeCore_SetTraceEnabledMany(corePtrs, (uint)coreHandles.Length, enabled ? 1u : 0u);
+            }
+            if (result != BridgeResult.Ok)
+                throw new InvalidOperationException($"BridgeCore_SetTraceEnabledMany failed: {result}");
+        }
+
+        /// <summary>
+        /// 把已记录的追踪事件写成 Chrome trace JSON（chrome://tracing / ui.perfetto.dev）。应在没有 Tick 进行时调用。
+        /// </summary>
+        public static unsafe void TraceDump(string path)
+        {
+            if (string.IsNullOrEmpty(path))
+                throw new ArgumentNullException(nameof(path));
+
+            byte[] utf8 = System.Text.Encoding.UTF8.GetBytes(path + "\0");
+            BridgeResult result;
+            fixed (byte* pathPtr = utf8)
+            {
+                result = BridgeNative.Bridge_TraceDump(pathPtr);
+            }
+            if (result != BridgeResult.Ok)
+                throw new InvalidOperationException($"Bridge_TraceDump failed: {result}");
+        }
+
+        /// <summary>
+        /// 丢弃已记录的追踪事件。
+        /// </summary>
+        public static void TraceClear()
+        {
+            BridgeNative.Bridge_TraceClear();
+        }
+
+        /// <summary>
+        /// 开始把本 core 每帧的 dt、分发的调用与 command stream 录制到 <paramref name="path"/>（用 <see cref="BridgeRecording"/> 回放）。
+        /// </summary>
+        public unsafe void BeginRecording(string path)
+        {
+            if (string.IsNullOrEmpty(path))
+                throw new ArgumentNullException(nameof(path));
+            ThrowIfDisposed();
+
+            byte[] utf8 = System.Text.Encoding.UTF8.GetBytes(path + "\0");
+            BridgeResult result;
+            fixed (byte* pathPtr = utf8)
+            {
+                result = BridgeNative.BridgeCore_BeginRecording(_handle, pathPtr);
+            }
+            if (result != BridgeResult.Ok)
+                throw new InvalidOperationException($"BridgeCore_BeginRecording failed: {result}");
+        }
+
+        /// <summary>
+        /// 结束录制并关闭文件（Dispose 也会结束录制）。
+        /// </summary>
+        public void EndRecording()
+        {
+            ThrowIfDisposed();
+            var result = BridgeNative.BridgeCore_EndRecording(_handle);
+            if (result != BridgeResult.Ok)
+                throw new InvalidOperationException($"BridgeCore_EndRecording failed: {result}");
+        }
+
         public void Dispose()
         {
             if (_handle != IntPtr.Zero)
@@ -0,0 +1,62 @@
+using System;
+
+namespace Bridge.Core
+{
+    /// <summary>
+    /// 原生 <c>BridgeCoreGroup</c> 的托管封装：批量 Tick 时把所有 core 的命令写入 group 持有的连续 arena。
+    /// </summary>
+    /// <remarks>
+    /// 返回的 streams 指向 group 的 arena，仅在下一次对同一 group 调用 TickMany 之前有效。
+    /// 串行模式下整批在同一块连续内存中；并行模式下每个 shard 内连续。
+    /// </remarks>
+    public sealed class BridgeCoreGroup : IDisposable
+    {
+        private IntPtr _handle;
+
+        public BridgeCoreGroup()
+        {
+            _handle = BridgeNative.BridgeCoreGroup_Create();
+            if (_handle == IntPtr.Zero)
+                throw new InvalidOperationException("BridgeCoreGroup_Create returned null");
+        }
+
+        public unsafe void TickManyAndGetCommandStreams(IntPtr[] coreHandles, float dt, CommandStream[] streams)
+        {
+            ThrowIfDisposed();
+            if (coreHandles == null)
+                throw new ArgumentNullException(nameof(coreHandles));
+            if (streams == null)
+                throw new ArgumentNullException(nameof(streams));
+            if (streams.Length < coreHandles.Length)
+                throw new ArgumentException("streams.Length must be >= coreHandles.Length", nameof(streams));
+
+            int count = coreHandles.Length;
+            if (count == 0)
+                return;
+
+            fixed (IntPtr* corePtrs = coreHandles)
+            fixed (CommandStream* outStreams = streams)
+            {
+                var result = BridgeNative.BridgeCoreGroup_TickManyAndGetCommandStreams(_handle, corePtrs, (uint)count, dt, outStreams);
+                if (result != BridgeResult.Ok)
+                    throw new InvalidOperationException($"BridgeCoreGroup_TickManyAndGetCommandStreams failed: {result}");
+            }
+        }
+
+        public void Dispose()
+        {
+            if (_handle != IntPtr.Zero)
+            {
+                BridgeNative.BridgeCoreGroup_Destroy(_handle);
+                _handle = IntPtr.Zero;
+            }
+            GC.SuppressFinalize(this);
+        }
+
+        private void ThrowIfDisposed()
+        {
+            if (_handle == IntPtr.Zero)
+                throw new ObjectDisposedException(nameof(BridgeCoreGroup));
+        }
+    }
+}
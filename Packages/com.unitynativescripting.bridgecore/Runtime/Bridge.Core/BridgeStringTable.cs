@@ -0,0 +1,44 @@
+using System;
+
+namespace Bridge.Core
+{
+    /// <summary>
+    /// Host 侧驻留字符串表：id -> 已解码的托管字符串（由生成的 Dispatcher 在遇到 DefineString 命令时填充）。
+    /// </summary>
+    /// <remarks>
+    /// id 在原生进程内全局唯一且内容不变，每个字符串只解码一次；之后 <see cref="Get"/> 是一次数组下标访问。
+    /// 同一 id 会被每个 core 各宣告一次，重复宣告直接忽略。
+    /// 需与命令分发在同一线程使用。
+    /// </remarks>
+    public static class BridgeStringTable
+    {
+        private static string?[] s_strings = new string?[256];
+
+        public static string Get(BridgeStringId id)
+        {
+            uint index = id.Value;
+            string?[] strings = s_strings;
+            if (index < (uint)strings.Length)
+                return strings[index] ?? string.Empty;
+            return string.Empty;
+        }
+
+        public static void Define(in BridgeCmdDefineString cmd)
+        {
+            uint index = cmd.Id.Value;
+            if (index == 0)
+                return;
+
+            if (index >= (uint)s_strings.Length)
+            {
+                int newLength = s_strings.Length;
+                while ((uint)newLength <= index)
+                    newLength *= 2;
+                Array.Resize(ref s_strings, newLength);
+            }
+
+            if (s_strings[index] == null)
+                s_strings[index] = cmd.Utf8.ToManagedString();
+        }
+    }
+}
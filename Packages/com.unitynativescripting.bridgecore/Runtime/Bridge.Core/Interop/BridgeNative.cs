@@ -44,6 +44,171 @@ namespace Bridge.Core
         [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
         private delegate BridgeResult BridgeCore_PushCallCoreDelegate(IntPtr core, uint funcId, IntPtr payload, uint payloadSize);
 
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate BridgeResult BridgeCore_SetTickWorkerCountDelegate(uint workerCount);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private unsafe delegate BridgeResult BridgeCore_TickManyBeginDelegate(
+            IntPtr* cores,
+            uint count,
+            float dt,
+            CommandStream* outStreams);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private unsafe delegate BridgeResult BridgeCore_PollCompletedShardsDelegate(
+            BridgeTickShard* outShards,
+            uint capacity,
+            out uint count,
+            out uint remaining);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate IntPtr BridgeCoreGroup_CreateDelegate();
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate void BridgeCoreGroup_DestroyDelegate(IntPtr group);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private unsafe delegate BridgeResult BridgeCoreGroup_TickManyAndGetCommandStreamsDelegate(
+            IntPtr group,
+            IntPtr* cores,
+            uint count,
+            float dt,
+            CommandStream* outStreams);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate BridgeResult BridgeCore_ReleaseStreamDelegate(IntPtr core);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate BridgeResult BridgeCore_PushCallsCoreDelegate(
+            IntPtr core,
+            IntPtr calls,
+            uint len);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private unsafe delegate BridgeResult BridgeCore_PushCallsManyDelegate(
+            IntPtr* cores,
+            BridgeCallBuffer* buffers,
+            uint count);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate BridgeResult BridgeCore_AcquireCallBufferDelegate(
+            IntPtr core,
+            uint bytes,
+            out IntPtr ptr);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate BridgeResult BridgeCore_CommitCallsDelegate(IntPtr core, uint bytesWritten);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private unsafe delegate BridgeResult Bridge_GetHostOpcodesDelegate(BridgeHostOpcode** outEntries, uint* outCount);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate BridgeResult BridgeCore_GetStatsDelegate(IntPtr core, out BridgeCoreStats stats);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private unsafe delegate BridgeResult BridgeCore_GetStatsManyDelegate(
+            IntPtr* cores,
+            uint count,
+            BridgeCoreStats* perCore,
+            BridgeCoreStats* total);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private unsafe delegate BridgeResult BridgeCore_GetFuncStatsDelegate(
+            IntPtr core,
+            BridgeFuncStats* entries,
+            uint capacity,
+            out uint count);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate BridgeResult BridgeCore_ResetStatsDelegate(IntPtr core);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate BridgeResult BridgeCore_SetTraceEnabledDelegate(IntPtr core, uint enabled);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private unsafe delegate BridgeResult BridgeCore_SetTraceEnabledManyDelegate(
+            IntPtr* cores,
+            uint count,
+            uint enabled);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private unsafe delegate BridgeResult Bridge_TraceDumpDelegate(byte* path);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate void Bridge_TraceClearDelegate();
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private unsafe delegate BridgeResult BridgeCore_BeginRecordingDelegate(IntPtr core, byte* path);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate BridgeResult BridgeCore_EndRecordingDelegate(IntPtr core);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private unsafe delegate IntPtr BridgeRecording_OpenDelegate(byte* path);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate void BridgeRecording_CloseDelegate(IntPtr recording);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate BridgeResult BridgeRecording_GetHeaderDelegate(IntPtr recording, out BridgeRecordingHeader header);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate BridgeResult BridgeRecording_GetFrameDelegate(
+            IntPtr recording,
+            uint index,
+            out BridgeRecordedFrame frame);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private unsafe delegate BridgeResult BridgeCore_CreateManyDelegate(
+            BridgeCoreConfig* configs,
+            uint count,
+            IntPtr* outCores);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate BridgeResult BridgeCore_ResetDelegate(IntPtr core, BridgeCoreConfig config);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate IntPtr BridgeCore_CloneDelegate(IntPtr source, ulong seed);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private unsafe delegate BridgeResult BridgeCore_CloneManyDelegate(
+            IntPtr source,
+            ulong* seeds,
+            uint count,
+            IntPtr* outCores);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate IntPtr BridgeTickScheduler_CreateDelegate();
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate void BridgeTickScheduler_DestroyDelegate(IntPtr scheduler);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private unsafe delegate BridgeResult BridgeTickScheduler_TickManyAndGetCommandStreamsDelegate(
+            IntPtr scheduler,
+            IntPtr* cores,
+            uint count,
+            float dt,
+            ulong budgetNs,
+            CommandStream* outStreams,
+            float* outDts,
+            BridgeTickBudgetResult* outResult);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate IntPtr BridgeAssetCache_CreateDelegate(BridgeAssetCacheConfig config);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate void BridgeAssetCache_DestroyDelegate(IntPtr cache);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private unsafe delegate BridgeResult BridgeCore_SetAssetCacheDelegate(
+            IntPtr* cores,
+            uint count,
+            IntPtr cache);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private unsafe delegate BridgeResult BridgeAssetCache_GetStatsDelegate(IntPtr cache, BridgeAssetCacheStats* outStats);
+
         private static IntPtr s_boundModule;
         private static Bridge_GetVersionDelegate s_getVersion;
         private static BridgeCore_CreateDelegate s_create;
@@ -53,6 +218,43 @@ namespace Bridge.Core
         private static BridgeCore_TickManyAndGetCommandStreamsDelegate s_tickManyAndGetCommandStreams;
         private static BridgeCore_GetCommandStreamDelegate s_getCommandStream;
         private static BridgeCore_PushCallCoreDelegate s_pushCallCore;
+        private static BridgeCore_SetTickWorkerCountDelegate s_setTickWorkerCount;
+        private static BridgeCore_TickManyBeginDelegate s_tickManyBegin;
+        private static BridgeCore_PollCompletedShardsDelegate s_pollCompletedShards;
+        private static BridgeCoreGroup_CreateDelegate s_coreGroupCreate;
+        private static BridgeCoreGroup_DestroyDelegate s_coreGroupDestroy;
+        private static BridgeCoreGroup_TickManyAndGetCommandStreamsDelegate s_coreGroupTickManyAndGetCommandStreams;
+        private static BridgeCore_ReleaseStreamDelegate s_releaseStream;
+        private static BridgeCore_PushCallsCoreDelegate s_pushCallsCore;
+        private static BridgeCore_PushCallsManyDelegate s_pushCallsMany;
+        private static BridgeCore_AcquireCallBufferDelegate s_acquireCallBuffer;
+        private static BridgeCore_CommitCallsDelegate s_commitCalls;
+        private static Bridge_GetHostOpcodesDelegate s_getHostOpcodes;
+        private static BridgeCore_GetStatsDelegate s_getStats;
+        private static BridgeCore_GetStatsManyDelegate s_getStatsMany;
+        private static BridgeCore_GetFuncStatsDelegate s_getFuncStats;
+        private static BridgeCore_ResetStatsDelegate s_resetStats;
+        private static BridgeCore_SetTraceEnabledDelegate s_setTraceEnabled;
+        private static BridgeCore_SetTraceEnabledManyDelegate s_setTraceEnabledMany;
+        private static Bridge_TraceDumpDelegate s_traceDump;
+        private static Bridge_TraceClearDelegate s_traceClear;
+        private static BridgeCore_BeginRecordingDelegate s_beginRecording;
+        private static BridgeCore_EndRecordingDelegate s_endRecording;
+        private static BridgeRecording_OpenDelegate s_recordingOpen;
+        private static BridgeRecording_CloseDelegate s_recordingClose;
+        private static BridgeRecording_GetHeaderDelegate s_recordingGetHeader;
+        private static BridgeRecording_GetFrameDelegate s_recordingGetFrame;
+        private static BridgeCore_CreateManyDelegate s_createMany;
+        private static BridgeCore_ResetDelegate s_reset;
+        private static BridgeCore_CloneDelegate s_clone;
+        private static BridgeCore_CloneManyDelegate s_cloneMany;
+        private static BridgeTickScheduler_CreateDelegate s_tickSchedulerCreate;
+        private static BridgeTickScheduler_DestroyDelegate s_tickSchedulerDestroy;
+        private static BridgeTickScheduler_TickManyAndGetCommandStreamsDelegate s_tickSchedulerTickManyAndGetCommandStreams;
+        private static BridgeAssetCache_CreateDelegate s_assetCacheCreate;
+        private static BridgeAssetCache_DestroyDelegate s_assetCacheDestroy;
+        private static BridgeCore_SetAssetCacheDelegate s_setAssetCache;
+        private static BridgeAssetCache_GetStatsDelegate s_assetCacheGetStats;
 
         private static void EnsureBound()
         {
@@ -73,6 +275,43 @@ namespace Bridge.Core
             s_tickManyAndGetCommandStreams = GetDelegate<BridgeCore_TickManyAndGetCommandStreamsDelegate>(module, "BridgeCore_TickManyAndGetCommandStreams");
             s_getCommandStream = GetDelegate<BridgeCore_GetCommandStreamDelegate>(module, "BridgeCore_GetCommandStream");
             s_pushCallCore = GetDelegate<BridgeCore_PushCallCoreDelegate>(module, "BridgeCore_PushCallCore");
+            s_setTickWorkerCount = GetDelegate<BridgeCore_SetTickWorkerCountDelegate>(module, "BridgeCore_SetTickWorkerCount");
+            s_tickManyBegin = GetDelegate<BridgeCore_TickManyBeginDelegate>(module, "BridgeCore_TickManyBegin");
+            s_pollCompletedShards = GetDelegate<BridgeCore_PollCompletedShardsDelegate>(module, "BridgeCore_PollCompletedShards");
+            s_coreGroupCreate = GetDelegate<BridgeCoreGroup_CreateDelegate>(module, "BridgeCoreGroup_Create");
+            s_coreGroupDestroy = GetDelegate<BridgeCoreGroup_DestroyDelegate>(module, "BridgeCoreGroup_Destroy");
+            s_coreGroupTickManyAndGetCommandStreams = GetDelegate<BridgeCoreGroup_TickManyAndGetCommandStreamsDelegate>(module, "BridgeCoreGroup_TickManyAndGetCommandStreams");
+            s_releaseStream = GetDelegate<BridgeCore_ReleaseStreamDelegate>(module, "BridgeCore_ReleaseStream");
+            s_pushCallsCore = GetDelegate<BridgeCore_PushCallsCoreDelegate>(module, "BridgeCore_PushCallsCore");
+            s_pushCallsMany = GetDelegate<BridgeCore_PushCallsManyDelegate>(module, "BridgeCore_PushCallsMany");
+            s_acquireCallBuffer = GetDelegate<BridgeCore_AcquireCallBufferDelegate>(module, "BridgeCore_AcquireCallBuffer");
+            s_commitCalls = GetDelegate<BridgeCore_CommitCallsDelegate>(module, "BridgeCore_CommitCalls");
+            s_getHostOpcodes = GetDelegate<Bridge_GetHostOpcodesDelegate>(module, "Bridge_GetHostOpcodes");
+            s_getStats = GetDelegate<BridgeCore_GetStatsDelegate>(module, "BridgeCore_GetStats");
+            s_getStatsMany = GetDelegate<BridgeCore_GetStatsManyDelegate>(module, "BridgeCore_GetStatsMany");
+            s_getFuncStats = GetDelegate<BridgeCore_GetFuncStatsDelegate>(module, "BridgeCore_GetFuncStats");
+            s_resetStats = GetDelegate<BridgeCore_ResetStatsDelegate>(module, "BridgeCore_ResetStats");
+            s_setTraceEnabled = GetDelegate<BridgeCore_SetTraceEnabledDelegate>(module, "BridgeCore_SetTraceEnabled");
+            s_setTraceEnabledMany = GetDelegate<BridgeCore_SetTraceEnabledManyDelegate>(module, "BridgeCore_SetTraceEnabledMany");
+            s_traceDump = GetDelegate<Bridge_TraceDumpDelegate>(module, "Bridge_TraceDump");
+            s_traceClear = GetDelegate<Bridge_TraceClearDelegate>(module, "Bridge_TraceClear");
+            s_beginRecording = GetDelegate<BridgeCore_BeginRecordingDelegate>(module, "BridgeCore_BeginRecording");
+            s_endRecording = GetDelegate<BridgeCore_EndRecordingDelegate>(module, "BridgeCore_EndRecording");
+            s_recordingOpen = GetDelegate<BridgeRecording_OpenDelegate>(module, "BridgeRecording_Open");
+            s_recordingClose = GetDelegate<BridgeRecording_CloseDelegate>(module, "BridgeRecording_Close");
+            s_recordingGetHeader = GetDelegate<BridgeRecording_GetHeaderDelegate>(module, "BridgeRecording_GetHeader");
+            s_recordingGetFrame = GetDelegate<BridgeRecording_GetFrameDelegate>(module, "BridgeRecording_GetFrame");
+            s_createMany = GetDelegate<BridgeCore_CreateManyDelegate>(module, "BridgeCore_CreateMany");
+            s_reset = GetDelegate<BridgeCore_ResetDelegate>(module, "BridgeCore_Reset");
+            s_clone = GetDelegate<BridgeCore_CloneDelegate>(module, "BridgeCore_Clone");
+            s_cloneMany = GetDelegate<BridgeCore_CloneManyDelegate>(module, "BridgeCore_CloneMany");
+            s_tickSchedulerCreate = GetDelegate<BridgeTickScheduler_CreateDelegate>(module, "BridgeTickScheduler_Create");
+            s_tickSchedulerDestroy = GetDelegate<BridgeTickScheduler_DestroyDelegate>(module, "BridgeTickScheduler_Destroy");
+            s_tickSchedulerTickManyAndGetCommandStreams = GetDelegate<BridgeTickScheduler_TickManyAndGetCommandStreamsDelegate>(module, "BridgeTickScheduler_TickManyAndGetCommandStreams");
+            s_assetCacheCreate = GetDelegate<BridgeAssetCache_CreateDelegate>(module, "BridgeAssetCache_Create");
+            s_assetCacheDestroy = GetDelegate<BridgeAssetCache_DestroyDelegate>(module, "BridgeAssetCache_Destroy");
+            s_setAssetCache = GetDelegate<BridgeCore_SetAssetCacheDelegate>(module, "BridgeCore_SetAssetCache");
+            s_assetCacheGetStats = GetDelegate<BridgeAssetCache_GetStatsDelegate>(module, "BridgeAssetCache_GetStats");
             s_boundModule = module;
         }
 
@@ -136,6 +375,282 @@ namespace Bridge.Core
             EnsureBound();
             return s_pushCallCore(core, funcId, payload, payloadSize);
         }
+
+        internal static BridgeResult BridgeCore_SetTickWorkerCount(uint workerCount)
+        {
+            EnsureBound();
+            return s_setTickWorkerCount(workerCount);
+        }
+
+        internal static unsafe BridgeResult BridgeCore_TickManyBegin(
+            IntPtr* cores,
+            uint count,
+            float dt,
+            CommandStream* outStreams)
+        {
+            EnsureBound();
+            return s_tickManyBegin(cores, count, dt, outStreams);
+        }
+
+        internal static unsafe BridgeResult BridgeCore_PollCompletedShards(
+            BridgeTickShard* outShards,
+            uint capacity,
+            out uint count,
+            out uint remaining)
+        {
+            EnsureBound();
+            return s_pollCompletedShards(outShards, capacity, out count, out remaining);
+        }
+
+        internal static IntPtr BridgeCoreGroup_Create()
+        {
+            EnsureBound();
+            return s_coreGroupCreate();
+        }
+
+        internal static void BridgeCoreGroup_Destroy(IntPtr group)
+        {
+            EnsureBound();
+            s_coreGroupDestroy(group);
+        }
+
+        internal static unsafe BridgeResult BridgeCoreGroup_TickManyAndGetCommandStreams(
+            IntPtr group,
+            IntPtr* cores,
+            uint count,
+            float dt,
+            CommandStream* outStreams)
+        {
+            EnsureBound();
+            return s_coreGroupTickManyAndGetCommandStreams(group, cores, count, dt, outStreams);
+        }
+
+        internal static BridgeResult BridgeCore_ReleaseStream(IntPtr core)
+        {
+            EnsureBound();
+            return s_releaseStream(core);
+        }
+
+        internal static BridgeResult BridgeCore_PushCallsCore(
+            IntPtr core,
+            IntPtr calls,
+            uint len)
+        {
+            EnsureBound();
+            return s_pushCallsCore(core, calls, len);
+        }
+
+        internal static unsafe BridgeResult BridgeCore_PushCallsMany(
+            IntPtr* cores,
+            BridgeCallBuffer* buffers,
+            uint count)
+        {
+            EnsureBound();
+            return s_pushCallsMany(cores, buffers, count);
+        }
+
+        internal static BridgeResult BridgeCore_AcquireCallBuffer(
+            IntPtr core,
+            uint bytes,
+            out IntPtr ptr)
+        {
+            EnsureBound();
+            return s_acquireCallBuffer(core, bytes, out ptr);
+        }
+
+        internal static BridgeResult BridgeCore_CommitCalls(IntPtr core, uint bytesWritten)
+        {
+            EnsureBound();
+            return s_commitCalls(core, bytesWritten);
+        }
+
+        internal static unsafe BridgeResult Bridge_GetHostOpcodes(BridgeHostOpcode** outEntries, uint* outCount)
+        {
+            EnsureBound();
+            return s_getHostOpcodes(outEntries, outCount);
+        }
+
+        internal static BridgeResult BridgeCore_GetStats(IntPtr core, out BridgeCoreStats stats)
+        {
+            EnsureBound();
+            return s_getStats(core, out stats);
+        }
+
+        internal static unsafe BridgeResult BridgeCore_GetStatsMany(
+            IntPtr* cores,
+            uint count,
+            BridgeCoreStats* perCore,
+            BridgeCoreStats* total)
+        {
+            EnsureBound();
+            return s_getStatsMany(cores, count, perCore, total);
+        }
+
+        internal static unsafe BridgeResult BridgeCore_GetFuncStats(
+            IntPtr core,
+            BridgeFuncStats* entries,
+            uint capacity,
+            out uint count)
+        {
+            EnsureBound();
+            return s_getFuncStats(core, entries, capacity, out count);
+        }
+
+        internal static BridgeResult BridgeCore_ResetStats(IntPtr core)
+        {
+            EnsureBound();
+            return s_resetStats(core);
+        }
+
+        internal static BridgeResult BridgeCore_SetTraceEnabled(IntPtr core, uint enabled)
+        {
+            EnsureBound();
+            return s_setTraceEnabled(core, enabled);
+        }
+
+        internal static unsafe BridgeResult BridgeCore_SetTraceEnabledMany(
+            IntPtr* cores,
+            uint count,
+            uint enabled)
+        {
+            EnsureBound();
+            return s_setTraceEnabledMany(cores, count, enabled);
+        }
+
+        internal static unsafe BridgeResult Bridge_TraceDump(byte* path)
+        {
+            EnsureBound();
+            return s_traceDump(path);
+        }
+
+        internal static void Bridge_TraceClear()
+        {
+            EnsureBound();
+            s_traceClear();
+        }
+
+        internal static unsafe BridgeResult BridgeCore_BeginRecording(IntPtr core, byte* path)
+        {
+            EnsureBound();
+            return s_beginRecording(core, path);
+        }
+
+        internal static BridgeResult BridgeCore_EndRecording(IntPtr core)
+        {
+            EnsureBound();
+            return s_endRecording(core);
+        }
+
+        internal static unsafe IntPtr BridgeRecording_Open(byte* path)
+        {
+            EnsureBound();
+            return s_recordingOpen(path);
+        }
+
+        internal static void BridgeRecording_Close(IntPtr recording)
+        {
+            EnsureBound();
+            s_recordingClose(recording);
+        }
+
+        internal static BridgeResult BridgeRecording_GetHeader(IntPtr recording, out BridgeRecordingHeader header)
+        {
+            EnsureBound();
+            return s_recordingGetHeader(recording, out header);
+        }
+
+        internal static BridgeResult BridgeRecording_GetFrame(
+            IntPtr recording,
+            uint index,
+            out BridgeRecordedFrame frame)
+        {
+            EnsureBound();
+            return s_recordingGetFrame(recording, index, out frame);
+        }
+
+        internal static unsafe BridgeResult BridgeCore_CreateMany(
+            BridgeCoreConfig* configs,
+            uint count,
+            IntPtr* outCores)
+        {
+            EnsureBound();
+            return s_createMany(configs, count, outCores);
+        }
+
+        internal static BridgeResult BridgeCore_Reset(IntPtr core, BridgeCoreConfig config)
+        {
+            EnsureBound();
+            return s_reset(core, config);
+        }
+
+        internal static IntPtr BridgeCore_Clone(IntPtr source, ulong seed)
+        {
+            EnsureBound();
+            return s_clone(source, seed);
+        }
+
+        internal static unsafe BridgeResult BridgeCore_CloneMany(
+            IntPtr source,
+            ulong* seeds,
+            uint count,
+            IntPtr* outCores)
+        {
+            EnsureBound();
+            return s_cloneMany(source, seeds, count, outCores);
+        }
+
+        internal static IntPtr BridgeTickScheduler_Create()
+        {
+            EnsureBound();
+            return s_tickSchedulerCreate();
+        }
+
+        internal static void BridgeTickScheduler_Destroy(IntPtr scheduler)
+        {
+            EnsureBound();
+            s_tickSchedulerDestroy(scheduler);
+        }
+
+        internal static unsafe BridgeResult BridgeTickScheduler_TickManyAndGetCommandStreams(
+            IntPtr scheduler,
+            IntPtr* cores,
+            uint count,
+            float dt,
+            ulong budgetNs,
+            CommandStream* outStreams,
+            float* outDts,
+            BridgeTickBudgetResult* outResult)
+        {
+            EnsureBound();
+            return s_tickSchedulerTickManyAndGetCommandStreams(scheduler, cores, count, dt, budgetNs, outStreams, outDts, outResult);
+        }
+
+        internal static IntPtr BridgeAssetCache_Create(BridgeAssetCacheConfig config)
+        {
+            EnsureBound();
+            return s_assetCacheCreate(config);
+        }
+
+        internal static void BridgeAssetCache_Destroy(IntPtr cache)
+        {
+            EnsureBound();
+            s_assetCacheDestroy(cache);
+        }
+
+        internal static unsafe BridgeResult BridgeCore_SetAssetCache(
+            IntPtr* cores,
+            uint count,
+            IntPtr cache)
+        {
+            EnsureBound();
+            return s_setAssetCache(cores, count, cache);
+        }
+
+        internal static unsafe BridgeResult BridgeAssetCache_GetStats(IntPtr cache, BridgeAssetCacheStats* outStats)
+        {
+            EnsureBound();
+            return s_assetCacheGetStats(cache, outStats);
+        }
 #else
 #if ENABLE_IL2CPP && !UNITY_EDITOR
         // IL2CPP Player 下如果把 C++ 以“源码插件”编进 GameAssembly.dll，应使用 __Internal 走内部符号解析，避免运行时动态加载 bridge_core.dll。
@@ -182,6 +697,171 @@ namespace Bridge.Core
             uint funcId,
             IntPtr payload,
             uint payloadSize);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern BridgeResult BridgeCore_SetTickWorkerCount(uint workerCount);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern unsafe BridgeResult BridgeCore_TickManyBegin(
+            IntPtr* cores,
+            uint count,
+            float dt,
+            CommandStream* outStreams);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern unsafe BridgeResult BridgeCore_PollCompletedShards(
+            BridgeTickShard* outShards,
+            uint capacity,
+            out uint count,
+            out uint remaining);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern IntPtr BridgeCoreGroup_Create();
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void BridgeCoreGroup_Destroy(IntPtr group);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern unsafe BridgeResult BridgeCoreGroup_TickManyAndGetCommandStreams(
+            IntPtr group,
+            IntPtr* cores,
+            uint count,
+            float dt,
+            CommandStream* outStreams);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern BridgeResult BridgeCore_ReleaseStream(IntPtr core);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern BridgeResult BridgeCore_PushCallsCore(
+            IntPtr core,
+            IntPtr calls,
+            uint len);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern unsafe BridgeResult BridgeCore_PushCallsMany(
+            IntPtr* cores,
+            BridgeCallBuffer* buffers,
+            uint count);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern BridgeResult BridgeCore_AcquireCallBuffer(
+            IntPtr core,
+            uint bytes,
+            out IntPtr ptr);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern BridgeResult BridgeCore_CommitCalls(IntPtr core, uint bytesWritten);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern unsafe BridgeResult Bridge_GetHostOpcodes(BridgeHostOpcode** outEntries, uint* outCount);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern BridgeResult BridgeCore_GetStats(IntPtr core, out BridgeCoreStats stats);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern unsafe BridgeResult BridgeCore_GetStatsMany(
+            IntPtr* cores,
+            uint count,
+            BridgeCoreStats* perCore,
+            BridgeCoreStats* total);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern unsafe BridgeResult BridgeCore_GetFuncStats(
+            IntPtr core,
+            BridgeFuncStats* entries,
+            uint capacity,
+            out uint count);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern BridgeResult BridgeCore_ResetStats(IntPtr core);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern BridgeResult BridgeCore_SetTraceEnabled(IntPtr core, uint enabled);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern unsafe BridgeResult BridgeCore_SetTraceEnabledMany(
+            IntPtr* cores,
+            uint count,
+            uint enabled);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern unsafe BridgeResult Bridge_TraceDump(byte* path);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void Bridge_TraceClear();
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern unsafe BridgeResult BridgeCore_BeginRecording(IntPtr core, byte* path);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern BridgeResult BridgeCore_EndRecording(IntPtr core);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern unsafe IntPtr BridgeRecording_Open(byte* path);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void BridgeRecording_Close(IntPtr recording);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern BridgeResult BridgeRecording_GetHeader(IntPtr recording, out BridgeRecordingHeader header);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern BridgeResult BridgeRecording_GetFrame(
+            IntPtr recording,
+            uint index,
+            out BridgeRecordedFrame frame);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern unsafe BridgeResult BridgeCore_CreateMany(
+            BridgeCoreConfig* configs,
+            uint count,
+            IntPtr* outCores);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern BridgeResult BridgeCore_Reset(IntPtr core, BridgeCoreConfig config);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern IntPtr BridgeCore_Clone(IntPtr source, ulong seed);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern unsafe BridgeResult BridgeCore_CloneMany(
+            IntPtr source,
+            ulong* seeds,
+            uint count,
+            IntPtr* outCores);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern IntPtr BridgeTickScheduler_Create();
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void BridgeTickScheduler_Destroy(IntPtr scheduler);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern unsafe BridgeResult BridgeTickScheduler_TickManyAndGetCommandStreams(
+            IntPtr scheduler,
+            IntPtr* cores,
+            uint count,
+            float dt,
+            ulong budgetNs,
+            CommandStream* outStreams,
+            float* outDts,
+            BridgeTickBudgetResult* outResult);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern IntPtr BridgeAssetCache_Create(BridgeAssetCacheConfig config);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void BridgeAssetCache_Destroy(IntPtr cache);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern unsafe BridgeResult BridgeCore_SetAssetCache(
+            IntPtr* cores,
+            uint count,
+            IntPtr cache);
+
+        [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern unsafe BridgeResult BridgeAssetCache_GetStats(IntPtr cache, BridgeAssetCacheStats* outStats);
 #endif
     }
 }
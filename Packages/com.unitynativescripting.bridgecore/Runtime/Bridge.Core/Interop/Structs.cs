@@ -24,11 +24,50 @@ namespace Bridge.Core
         public readonly uint Patch;
     }
 
+    /// <summary>
+    /// native 库的 opcode &lt;-&gt; func_id 表项（见 BridgeCore.MatchHostOpcodes）。
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public readonly struct BridgeHostOpcode
+    {
+        public readonly ushort Opcode;
+        public readonly ushort Reserved0;
+        public readonly uint FuncId;
+    }
+
+    [Flags]
+    public enum BridgeCoreFlags : uint
+    {
+        None = 0,
+        DoubleBuffered = 1u << 0,
+        ConcurrentCalls = 1u << 1,
+        DenseOpcodes = 1u << 2,
+        VirtualCommandBuffer = 1u << 3,
+        HugePages = 1u << 4
+    }
+
     [StructLayout(LayoutKind.Sequential)]
     public struct BridgeCoreConfig
     {
         public ulong Seed;
         public uint Mode;
+        public uint Flags;
+
+        /// <summary>初始 command stream 容量（字节），0 表示默认 1024。</summary>
+        public uint CommandBytesCapacity;
+
+        /// <summary>每帧字符串 arena 首块容量（字节），0 表示默认 4096。</summary>
+        public uint StringBytesCapacity;
+
+        /// <summary>Host->Core 待分发调用缓冲容量（字节），0 表示默认 256。</summary>
+        public uint CallBytesCapacity;
+
+        /// <summary><see cref="BridgeCoreFlags.VirtualCommandBuffer"/> 时每个 stream 预留的地址空间（字节），0 表示默认 64 MB。</summary>
+        public uint CommandBytesReserve;
+
+        /// <summary>连续 64 帧命令都不超过该字节数时回收多出的命令缓冲，0 表示不回收。</summary>
+        public uint CommandBytesRetain;
+
         public uint Reserved0;
     }
 
@@ -67,6 +106,19 @@ namespace Bridge.Core
         }
     }
 
+    /// <summary>
+    /// 驻留字符串 id（跨 Tick 稳定；0 表示空串）。内容由 BRIDGE_CMD_DEFINE_STRING 宣告，见 <see cref="BridgeStringTable"/>。
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public readonly struct BridgeStringId
+    {
+        public readonly uint Value;
+
+        public bool IsEmpty => Value == 0;
+
+        public string ToManagedString() => BridgeStringTable.Get(this);
+    }
+
     public enum BridgeLogLevel : uint
     {
         Debug = 0,
@@ -114,6 +166,149 @@ namespace Bridge.Core
         public BridgeVec3 Scale;
     }
 
+    /// <summary>
+    /// 异步批量 Tick 的已完成分片：cores[Begin .. Begin+Count) 的 streams 已可读。
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public readonly struct BridgeTickShard
+    {
+        public readonly uint Begin;
+        public readonly uint Count;
+    }
+
+    /// <summary>
+    /// 按时间预算批量 Tick 的结果：本次 Tick 的是下标 First 起（环绕）共 Count 个 core，ElapsedNs 为实际耗时。
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public readonly struct BridgeTickBudgetResult
+    {
+        public readonly uint First;
+        public readonly uint Count;
+        public readonly ulong ElapsedNs;
+    }
+
+    /// <summary>
+    /// 共享资源缓存的配置（字段含义见 bridge.h 的 BridgeAssetCacheConfig）。
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct BridgeAssetCacheConfig
+    {
+        public uint LoadedFuncId;
+        public uint PayloadSize;
+        public uint StatusOffset;
+        public uint Reserved0;
+    }
+
+    /// <summary>
+    /// 共享资源缓存的计数（字段含义见 bridge.h 的 BridgeAssetCacheStats）。
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public readonly struct BridgeAssetCacheStats
+    {
+        public readonly ulong Requests;
+        public readonly ulong HostRequests;
+        public readonly ulong Attached;
+        public readonly ulong Hits;
+        public readonly ulong FannedOut;
+        public readonly uint Entries;
+        public readonly uint Reserved0;
+    }
+
+    /// <summary>
+    /// 单个 core 的运行时统计（字段含义见 bridge.h 的 BridgeCoreStats；需以 BRIDGE_ENABLE_STATS=ON 编译 native 库）。
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public readonly struct BridgeCoreStats
+    {
+        public readonly ulong Frames;
+        public readonly ulong CallsEmitted;
+        public readonly ulong BytesEmitted;
+        public readonly ulong LastFrameCalls;
+        public readonly ulong LastFrameBytes;
+        public readonly ulong PeakFrameBytes;
+        public readonly ulong StringsStored;
+        public readonly ulong StringBytesStored;
+        public readonly ulong StringsDefined;
+        public readonly ulong InboundCalls;
+        public readonly ulong InboundBytes;
+        public readonly ulong PeakInboundBytes;
+        public readonly ulong StreamReallocs;
+        public readonly ulong CallBufferReallocs;
+        public readonly ulong StreamCapacityBytes;
+        public readonly ulong CallBufferCapacityBytes;
+        public readonly ulong LastTickNs;
+        public readonly ulong MaxTickNs;
+        public readonly ulong FuncCount;
+    }
+
+    /// <summary>
+    /// 按 func_id 的 Core→Host 调用明细（见 BridgeCore.GetFuncStats）。
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public readonly struct BridgeFuncStats
+    {
+        public readonly uint FuncId;
+        public readonly uint Reserved0;
+        public readonly ulong Calls;
+        public readonly ulong PayloadBytes;
+    }
+
+    /// <summary>
+    /// 预编码的 Host→Core 调用头（BridgeCore_PushCallsCore 的输入格式）：其后紧跟 payload，按 8 字节补齐。
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct BridgeCallCoreHeader
+    {
+        public uint FuncId;
+        public uint PayloadSize;
+    }
+
+    /// <summary>
+    /// 一段预编码的 Host→Core 调用（ptr + 长度），见 <see cref="BridgeCallWriter"/>。
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public readonly struct BridgeCallBuffer
+    {
+        public readonly IntPtr Ptr;
+        public readonly uint Length;
+        private readonly uint _reserved0;
+
+        public BridgeCallBuffer(IntPtr ptr, uint length)
+        {
+            Ptr = ptr;
+            Length = length;
+            _reserved0 = 0;
+        }
+    }
+
+    /// <summary>
+    /// 录制文件头（格式见 bridge.h 的 BridgeRecordingHeader；由 <see cref="BridgeRecording"/> 读取）。
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public readonly struct BridgeRecordingHeader
+    {
+        public readonly ulong Magic;
+        public readonly uint FormatVersion;
+        public readonly uint FrameCount;
+        public readonly BridgeCoreConfig Config;
+        public readonly ulong StartTick;
+        public readonly BridgeVersion RuntimeVersion;
+        public readonly uint Reserved0;
+    }
+
+    /// <summary>
+    /// 录制中的一帧：Inbound 为本帧分发给 Core 的调用，Stream 为本帧 command stream（指针指向录制文件的映射内存）。
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public readonly struct BridgeRecordedFrame
+    {
+        public readonly float Dt;
+        public readonly uint RelocCount;
+        public readonly BridgeCallBuffer Inbound;
+        public readonly CommandStream Stream;
+        public readonly IntPtr Relocs;
+    }
+
     [StructLayout(LayoutKind.Sequential)]
     public struct BridgeCommandHeader
     {
@@ -124,7 +319,9 @@ namespace Bridge.Core
     public enum BridgeCommandType : ushort
     {
         None = 0,
-        CallHost = 1
+        CallHost = 1,
+        DefineString = 2,
+        CallHostBatch = 3
     }
 
     [StructLayout(LayoutKind.Sequential)]
@@ -133,4 +330,38 @@ namespace Bridge.Core
         public BridgeCommandHeader Header;
         public uint FuncId;
     }
+
+    /// <summary>
+    /// 同一函数的批量调用：其后紧跟 Count 个 payload，每个占 Stride 字节（见 <see cref="HostCallBatch{T}"/>）。
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct BridgeCmdCallHostBatch
+    {
+        public BridgeCommandHeader Header;
+        public uint FuncId;
+        public uint Count;
+        public uint Stride;
+    }
+
+    /// <summary>
+    /// 稠密 opcode 调用（<see cref="BridgeCoreFlags.DenseOpcodes"/>）：Header.Type 即 opcode，
+    /// 其后紧跟 Count 个 payload，每个占 sizeof(payload) 按 8 字节补齐。
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct BridgeCmdCallOp
+    {
+        /// <summary>Header.Type 不小于该值的命令都是稠密 opcode 命令。</summary>
+        public const ushort OpcodeBase = 0x100;
+
+        public BridgeCommandHeader Header;
+        public uint Count;
+    }
+
+    [StructLayout(LayoutKind.Sequential)]
+    public struct BridgeCmdDefineString
+    {
+        public BridgeCommandHeader Header;
+        public BridgeStringId Id;
+        public BridgeStringView Utf8;
+    }
 }
@@ -0,0 +1,665 @@
+#include <bridge/bridge.h>
+#include <bridge/runtime/core_context.h>
+#include <bridge/runtime/trace.h>
+
+#include "core/core_instance.h"
+#include "core/tick_scheduler.h"
+
+#include <bridge_host_dispatcher.generated.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// 原生 Runtime 微基准（bridge_bench）：
+// 直接链接 bridge_runtime / bridge_demo_game 静态库，绕过 C ABI，分别测量 CoreContext::CallHost / Emplace、TransformStore、StoreUtf8、
+// Tick 分发 PushCallCore、stream 解析、追踪 zone、core 创建/克隆与 TickMany（含按时间预算的调度）的单次开销，用于定位回归来自 Runtime 的哪一部分。
+//
+// 每项先 warmup，再重复 reps 次；每次重复得到一个 ns/op 样本，报告 median 与 MAD（median absolute deviation）。
+// --json <path> 把本次结果写成一个 JSON 对象（Tools/RunPerf.ps1 会把它并入 perf_history.jsonl 的记录）。
+// 计时前先做一次合并调用的顺序检查（CheckCoalesceOrder），不通过时返回 1。
+
+namespace
+{
+  struct Options
+  {
+    int warmup = 3;
+    int reps = 15;
+    uint32_t maxCores = 100000;
+    uint32_t workers = 0;
+    const char* filter = nullptr;
+    const char* jsonPath = nullptr;
+  };
+
+  struct Result
+  {
+    std::string name;
+    uint64_t ops = 0;
+    double medianNs = 0.0;
+    double madNs = 0.0;
+    double minNs = 0.0;
+  };
+
+  // 防止被测循环的结果被编译器整体消除。
+  static volatile uint64_t g_sink = 0;
+
+  static double Median(std::vector<double> values)
+  {
+    std::sort(values.begin(), values.end());
+    const size_t n = values.size();
+    if (n == 0)
+    {
+      return 0.0;
+    }
+    return (n % 2) ? values[n / 2] : (values[n / 2 - 1] + values[n / 2]) * 0.5;
+  }
+
+  class Bench
+  {
+  public:
+    explicit Bench(const Options& options) : options_(options) {}
+
+    // setup 不计时；body 执行 ops 次被测操作。
+    template <class TSetup, class TBody>
+    void Run(const std::string& name, uint64_t ops, TSetup&& setup, TBody&& body)
+    {
+      if (options_.filter && name.find(options_.filter) == std::string::npos)
+      {
+        return;
+      }
+
+      for (int i = 0; i < options_.warmup; ++i)
+      {
+        setup();
+        body();
+      }
+
+      std::vector<double> samples;
+      samples.reserve(static_cast<size_t>(options_.reps));
+      for (int i = 0; i < options_.reps; ++i)
+      {
+        setup();
+        const auto start = std::chrono::steady_clock::now();
+        body();
+        const auto end = std::chrono::steady_clock::now();
+        const double ns = std::chrono::duration<double, std::nano>(end - start).count();
+        samples.push_back(ns / static_cast<double>(ops));
+      }
+
+      Result r;
+      r.name = name;
+      r.ops = ops;
+      r.medianNs = Median(samples);
+      r.minNs = *std::min_element(samples.begin(), samples.end());
+      std::vector<double> deviations;
+      deviations.reserve(samples.size());
+      for (double s : samples)
+      {
+        deviations.push_back(std::fabs(s - r.medianNs));
+      }
+      r.madNs = Median(std::move(deviations));
+
+      std::printf("%-40s median %10.2f ns/op  mad %8.2f  min %10.2f  (ops=%llu)\n",
+        r.name.c_str(), r.medianNs, r.madNs, r.minNs, static_cast<unsigned long long>(r.ops));
+      results_.push_back(std::move(r));
+    }
+
+    bool WriteJson(const char* path) const
+    {
+      std::FILE* f = std::fopen(path, "w");
+      if (!f)
+      {
+        return false;
+      }
+      std::fprintf(f, "{\"tool\":\"bridge_bench\",\"unit\":\"ns/op\",\"warmup\":%d,\"reps\":%d,\"workers\":%u,\"results\":[",
+        options_.warmup, options_.reps, options_.workers);
+      for (size_t i = 0; i < results_.size(); ++i)
+      {
+        const Result& r = results_[i];
+        std::fprintf(f, "%s{\"name\":\"%s\",\"ops\":%llu,\"median_ns\":%.3f,\"mad_ns\":%.3f,\"min_ns\":%.3f}",
+          i ? "," : "", r.name.c_str(), static_cast<unsigned long long>(r.ops), r.medianNs, r.madNs, r.minNs);
+      }
+      std::fprintf(f, "]}\n");
+      return std::fclose(f) == 0;
+    }
+
+  private:
+    const Options& options_;
+    std::vector<Result> results_;
+  };
+
+  static BridgeCore* CreateBenchCore(uint64_t seed, uint32_t flags = BRIDGE_CORE_FLAG_NONE)
+  {
+    BridgeCoreConfig cfg{};
+    cfg.seed = seed;
+    cfg.mode = BRIDGE_MODE_ROBOT;
+    cfg.flags = flags;
+    return bridge::CreateCore(cfg);
+  }
+
+  // 解析用 Host：处理全部 demo 调用（累加字段，避免分发被优化掉），并记下 LoadAsset 的 requestId。
+  struct BenchHost
+  {
+    uint64_t sum = 0;
+    uint64_t lastRequestId = 0;
+
+    void LoadAsset(const demo_asset::HostArgs_LoadAsset& args) { lastRequestId = args.requestId; sum += args.requestId; }
+    void Log(const demo_log::HostArgs_Log& args) { sum += args.level; }
+    void SpawnEntity(const demo_entity::HostArgs_SpawnEntity& args) { sum += args.entityId; }
+    void SetTransform(const demo_entity::HostArgs_SetTransform& args) { sum += args.entityId; }
+    void SetPosition(const demo_entity::HostArgs_SetPosition& args) { sum += args.entityId; }
+    void DestroyEntity(const demo_entity::HostArgs_DestroyEntity& args) { sum += args.entityId; }
+    void DefineString(const BridgeCmdDefineString& cmd) { sum += cmd.id; }
+  };
+
+  // 回执 core 的启动资源请求，使其进入稳态（每帧输出一次 SetPosition）。
+  static void BringToSteadyState(BridgeCore& core, float dt)
+  {
+    bridge::Tick(core, dt);
+    BenchHost host;
+    bridge::DispatchFast(core.Commands().Data(), core.Commands().Size(), host);
+
+    demo_asset::CoreArgs_AssetLoaded evt{};
+    evt.requestId = host.lastRequestId;
+    evt.handle = 1;
+    evt.status = BRIDGE_ASSET_STATUS_OK;
+    bridge::PushCallCore(core, static_cast<uint32_t>(demo_asset::CoreFuncId::AssetLoaded), &evt, sizeof(evt));
+    bridge::Tick(core, dt);
+    bridge::Tick(core, dt);
+  }
+
+  // 合并调用的顺序检查（不计时）：按 Host 看到的顺序记下实体调用。
+  struct OrderHost : BenchHost
+  {
+    std::string log;
+
+    void SpawnEntity(const demo_entity::HostArgs_SpawnEntity& args) { log += "spawn" + std::to_string(args.entityId) + " "; }
+    void SetPosition(const demo_entity::HostArgs_SetPosition& args)
+    {
+      log += "pos" + std::to_string(args.entityId) + "=" + std::to_string(static_cast<int>(args.position.x)) + " ";
+    }
+    void DestroyEntity(const demo_entity::HostArgs_DestroyEntity& args) { log += "destroy" + std::to_string(args.entityId) + " "; }
+  };
+
+  // 只有两次写入之间全是合并调用时才原地覆盖；中间夹着销毁/重建时，新值必须排在它们之后。
+  static bool CheckCoalesceOrder()
+  {
+    BridgeCore* core = CreateBenchCore(1);
+    core->Commands().Clear();
+    bridge::CoreContext ctx(*core);
+
+    BridgeVec3 pos{};
+    pos.x = 1.0f;
+    demo_entity::SetPosition(ctx, 1, pos);
+    demo_entity::SetPosition(ctx, 2, pos);
+    pos.x = 2.0f;
+    demo_entity::SetPosition(ctx, 1, pos);
+    demo_entity::DestroyEntity(ctx, 1);
+    demo_entity::SpawnEntity(ctx, 1, 1, bridge::CoreContext::IdentityTransform(), 0);
+    pos.x = 3.0f;
+    demo_entity::SetPosition(ctx, 1, pos);
+    pos.x = 4.0f;
+    demo_entity::SetPosition(ctx, 1, pos);
+
+    OrderHost host;
+    bridge::DispatchFast(core->Commands().Data(), core->Commands().Size(), host);
+    bridge::DestroyCore(core);
+
+    const char* expected = "pos1=2 pos2=1 destroy1 spawn1 pos1=4 ";
+    if (host.log != expected)
+    {
+      std::printf("coalesce order check failed:\n  got      %s\n  expected %s\n", host.log.c_str(), expected);
+      return false;
+    }
+    return true;
+  }
+
+  static void BenchCallHost(Bench& bench)
+  {
+    constexpr uint32_t kCalls = 1024;
+    const uint32_t sizes[] = {8, 16, 32, 64, 128, 256};
+
+    BridgeCore* core = CreateBenchCore(1);
+    bridge::CoreContext ctx(*core);
+    uint8_t payload[256] = {};
+
+    for (uint32_t size : sizes)
+    {
+      // 交替两个 funcId：每次调用各成一条 BRIDGE_CMD_CALL_HOST。
+      bench.Run("call_host/" + std::to_string(size) + "B", kCalls,
+        [&]() { core->Commands().Clear(); },
+        [&]() {
+          for (uint32_t i = 0; i < kCalls; ++i)
+          {
+            ctx.CallHost(1u + (i & 1u), payload, size);
+          }
+        });
+
+      // 同一 funcId：合并为 BRIDGE_CMD_CALL_HOST_BATCH。
+      bench.Run("call_host_batched/" + std::to_string(size) + "B", kCalls,
+        [&]() { core->Commands().Clear(); },
+        [&]() {
+          for (uint32_t i = 0; i < kCalls; ++i)
+          {
+            ctx.CallHost(1u, payload, size);
+          }
+        });
+    }
+
+    // 生成绑定的 Emplace：交替两个函数（每次一条独立命令，走内联快路径）与同一函数（并入批量命令）。
+    const BridgeTransform identity = bridge::CoreContext::IdentityTransform();
+    bench.Run("emplace/alternating", kCalls,
+      [&]() { core->Commands().Clear(); },
+      [&]() {
+        for (uint32_t i = 0; i < kCalls; ++i)
+        {
+          if (i & 1u)
+          {
+            demo_entity::DestroyEntity(ctx, i);
+          }
+          else
+          {
+            demo_entity::SpawnEntity(ctx, i, 1, identity, 0);
+          }
+        }
+      });
+    bench.Run("emplace/batched", kCalls,
+      [&]() { core->Commands().Clear(); },
+      [&]() {
+        for (uint32_t i = 0; i < kCalls; ++i)
+        {
+          demo_entity::SpawnEntity(ctx, i, 1, identity, 0);
+        }
+      });
+
+    bridge::DestroyCore(core);
+  }
+
+  // 新建 core 的一帧写入 4 MB：堆 buffer 逐次倍增并复制，虚拟地址 buffer 原地提交页。
+  static void BenchStreamGrow(Bench& bench)
+  {
+    constexpr uint32_t kPayload = 256;
+    constexpr uint32_t kCalls = 4 * 1024 * 1024 / kPayload;
+    uint8_t payload[kPayload] = {};
+
+    for (uint32_t flags : {BRIDGE_CORE_FLAG_NONE, BRIDGE_CORE_FLAG_VIRTUAL_COMMAND_BUFFER})
+    {
+      BridgeCore* core = nullptr;
+      bench.Run(flags == BRIDGE_CORE_FLAG_NONE ? "stream_grow/heap" : "stream_grow/virtual", kCalls,
+        [&]() {
+          bridge::DestroyCore(core);
+          core = CreateBenchCore(1, flags);
+        },
+        [&]() {
+          bridge::CoreContext ctx(*core);
+          for (uint32_t i = 0; i < kCalls; ++i)
+          {
+            ctx.CallHost(1u + (i & 1u), payload, kPayload);
+          }
+        });
+      bridge::DestroyCore(core);
+    }
+  }
+
+  // 一个 core 上 N 个实体每帧写一次位置：手写 SetPosition（每个实体每帧一条命令）对比 TransformStore
+  // （写入相同值不置脏位，Flush 只输出变化的实体）。moving/K% 表示每帧有 K% 的实体真正移动。
+  static void BenchTransformStore(Bench& bench)
+  {
+    constexpr uint32_t kEntities = 4096;
+
+    BridgeCore* core = CreateBenchCore(1);
+    bridge::CoreContext ctx(*core);
+    bridge::TransformStore& store = core->transforms;
+    store.BindCommands(
+      [](bridge::CoreContext& c, uint64_t id, const BridgeVec3& p) { demo_entity::SetPosition(c, id, p); },
+      [](bridge::CoreContext& c, uint64_t id, uint32_t mask, const BridgeTransform& t) { demo_entity::SetTransform(c, id, mask, t); });
+
+    std::vector<bridge::TransformHandle> handles(kEntities);
+    for (uint32_t i = 0; i < kEntities; ++i)
+    {
+      handles[i] = store.Create(i + 1, bridge::CoreContext::IdentityTransform());
+    }
+
+    float t = 0.0f;
+    bench.Run("transform_manual/" + std::to_string(kEntities), kEntities,
+      [&]() { core->Commands().Clear(); t += 1.0f; },
+      [&]() {
+        for (uint32_t i = 0; i < kEntities; ++i)
+        {
+          BridgeVec3 pos{};
+          pos.x = (i % 10 == 0) ? t : 0.0f;
+          demo_entity::SetPosition(ctx, i + 1, pos);
+        }
+      });
+
+    for (uint32_t percent : {0u, 10u, 100u})
+    {
+      const uint32_t stride = percent == 0 ? 0 : 100 / percent;
+      bench.Run("transform_store/moving_" + std::to_string(percent) + "pct", kEntities,
+        [&]() { core->Commands().Clear(); t += 1.0f; },
+        [&]() {
+          for (uint32_t i = 0; i < kEntities; ++i)
+          {
+            BridgeVec3 pos{};
+            pos.x = (stride != 0 && i % stride == 0) ? t : 0.0f;
+            store.SetPosition(handles[i], pos);
+          }
+          store.Flush(ctx);
+        });
+    }
+
+    bridge::DestroyCore(core);
+  }
+
+  static void BenchStoreUtf8(Bench& bench)
+  {
+    constexpr uint32_t kStrings = 1024;
+    const size_t lengths[] = {8, 64, 512};
+
+    BridgeCore* core = CreateBenchCore(1);
+    bridge::CoreContext ctx(*core);
+
+    for (size_t len : lengths)
+    {
+      const std::string text(len, 'x');
+      bench.Run("store_utf8/" + std::to_string(len) + "B", kStrings,
+        [&]() { core->Commands().Clear(); },
+        [&]() {
+          uint64_t acc = 0;
+          for (uint32_t i = 0; i < kStrings; ++i)
+          {
+            acc += ctx.StoreUtf8(text).len;
+          }
+          g_sink = g_sink + acc;
+        });
+    }
+
+    bridge::DestroyCore(core);
+  }
+
+  // PushCallCore 积压 N 条 AssetLoaded，计时 Tick 把它们分发给 App（按每条调用计）。
+  static void BenchTickDrain(Bench& bench, float dt)
+  {
+    const uint32_t counts[] = {1, 16, 256};
+
+    BridgeCore* core = CreateBenchCore(1);
+    BringToSteadyState(*core, dt);
+
+    demo_asset::CoreArgs_AssetLoaded evt{};
+    evt.requestId = ~uint64_t{0};
+    evt.status = BRIDGE_ASSET_STATUS_OK;
+    const uint32_t funcId = static_cast<uint32_t>(demo_asset::CoreFuncId::AssetLoaded);
+
+    for (uint32_t count : counts)
+    {
+      bench.Run("tick_drain_calls/" + std::to_string(count), count,
+        [&]() {
+          for (uint32_t i = 0; i < count; ++i)
+          {
+            bridge::PushCallCore(*core, funcId, &evt, sizeof(evt));
+          }
+        },
+        [&]() { bridge::Tick(*core, dt); });
+    }
+
+    bridge::DestroyCore(core);
+  }
+
+  // 用生成的绑定写出一段代表性的 stream 并复制出来（解析期间不依赖 core 的状态）。
+  static std::vector<uint8_t> BuildStream(bool dense, bool batched)
+  {
+    constexpr uint64_t kEntities = 1024;
+
+    BridgeCore* core = CreateBenchCore(1, dense ? BRIDGE_CORE_FLAG_DENSE_OPCODES : BRIDGE_CORE_FLAG_NONE);
+    core->Commands().Clear();
+    bridge::CoreContext ctx(*core);
+
+    BridgeVec3 pos{};
+    for (uint64_t e = 1; e <= kEntities; ++e)
+    {
+      pos.x = static_cast<float>(e);
+      if (batched)
+      {
+        demo_entity::SetPosition(ctx, e, pos);
+      }
+      else
+      {
+        // 交替的调用不会合并，每条都是独立命令。
+        demo_entity::SpawnEntity(ctx, e, 1, bridge::CoreContext::IdentityTransform(), 0);
+        demo_entity::SetPosition(ctx, e, pos);
+        demo_log::Log(ctx, BRIDGE_LOG_INFO, "bench");
+      }
+    }
+
+    const uint8_t* data = static_cast<const uint8_t*>(core->Commands().Data());
+    std::vector<uint8_t> bytes(data, data + core->Commands().Size());
+    bridge::DestroyCore(core);
+    return bytes;
+  }
+
+  static void BenchDispatchStream(Bench& bench)
+  {
+    for (int dense = 0; dense < 2; ++dense)
+    {
+      for (int batched = 0; batched < 2; ++batched)
+      {
+        const std::vector<uint8_t> stream = BuildStream(dense != 0, batched != 0);
+        const uint32_t len = static_cast<uint32_t>(stream.size());
+
+        BenchHost probe;
+        const uint64_t calls = bridge::DispatchFast(stream.data(), len, probe);
+
+        const std::string suffix = std::string(batched ? "batched" : "mixed") + (dense ? "_dense" : "");
+        bench.Run("dispatch_stream/" + suffix, calls,
+          []() {},
+          [&]() {
+            BenchHost host;
+            bridge::DispatchFast(stream.data(), len, host);
+            g_sink = g_sink + host.sum;
+          });
+        bench.Run("dispatch_stream_unchecked/" + suffix, calls,
+          []() {},
+          [&]() {
+            BenchHost host;
+            bridge::DispatchFastUnchecked(stream.data(), len, host);
+            g_sink = g_sink + host.sum;
+          });
+      }
+    }
+  }
+
+  // 追踪 zone 的开销：off 为 core 未开启追踪（只剩一次分支），on 为写入本线程环形缓冲（开始 + 结束两个事件）。
+  static void BenchTraceZone(Bench& bench)
+  {
+    constexpr uint32_t kZones = 1024;
+    const uint32_t traceIds[] = {0, bridge::AllocTraceId()};
+
+    for (uint32_t traceId : traceIds)
+    {
+      bench.Run(traceId == 0 ? "trace_zone/off" : "trace_zone/on", kZones,
+        []() {},
+        [&]() {
+          for (uint32_t i = 0; i < kZones; ++i)
+          {
+            bridge::TraceZone zone(traceId, "Bench::Zone");
+          }
+        });
+    }
+
+    bridge::ClearTrace();
+  }
+
+  // 创建 / 回收 core 的开销（按每个 core 计）：逐个 CreateCore、一次 CreateCores（slab），以及原地 ResetCore。
+  static void BenchCreateCores(Bench& bench, const Options& options)
+  {
+    const uint32_t count = std::min<uint32_t>(options.maxCores, 10000);
+    if (count == 0)
+    {
+      return;
+    }
+
+    std::vector<BridgeCoreConfig> configs(count);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+      configs[i].seed = static_cast<uint64_t>(i) + 1;
+      configs[i].mode = BRIDGE_MODE_ROBOT;
+    }
+    std::vector<BridgeCore*> cores(count, nullptr);
+    auto destroyAll = [&]() {
+      for (BridgeCore*& core : cores)
+      {
+        bridge::DestroyCore(core);
+        core = nullptr;
+      }
+    };
+
+    bench.Run("core_create/single/" + std::to_string(count), count,
+      destroyAll,
+      [&]() {
+        for (uint32_t i = 0; i < count; ++i)
+        {
+          cores[i] = bridge::CreateCore(configs[i]);
+        }
+      });
+
+    bench.Run("core_create/many/" + std::to_string(count), count,
+      destroyAll,
+      [&]() { bridge::CreateCores(configs.data(), count, cores.data()); });
+
+    bench.Run("core_reset/" + std::to_string(count), count,
+      []() {},
+      [&]() {
+        for (uint32_t i = 0; i < count; ++i)
+        {
+          bridge::ResetCore(*cores[i], configs[i]);
+        }
+      });
+
+    // 从一个已进入稳态的模板复制（副本无需再走启动往返）。
+    BridgeCore* source = CreateBenchCore(1);
+    BringToSteadyState(*source, 1.0f / 60.0f);
+    std::vector<uint64_t> seeds(count);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+      seeds[i] = configs[i].seed;
+    }
+    bench.Run("core_clone/" + std::to_string(count), count,
+      destroyAll,
+      [&]() { bridge::CloneCores(*source, seeds.data(), count, cores.data()); });
+    bridge::DestroyCore(source);
+
+    destroyAll();
+  }
+
+  // TickMany 随 core 数的扩展性（按每个 core-tick 计）；core 先进入稳态。
+  static void BenchTickMany(Bench& bench, const Options& options, float dt)
+  {
+    for (uint32_t count = 1; count <= options.maxCores; count *= 10)
+    {
+      std::vector<BridgeCore*> cores;
+      cores.reserve(count);
+      for (uint32_t i = 0; i < count; ++i)
+      {
+        cores.push_back(CreateBenchCore(static_cast<uint64_t>(i) + 1));
+        BringToSteadyState(*cores.back(), dt);
+      }
+      std::vector<BridgeCommandStream> streams(count);
+
+      bench.Run("tick_many/" + std::to_string(count), count,
+        []() {},
+        [&]() { bridge::TickMany(cores.data(), count, dt, streams.data()); });
+
+      // 预算足够整批时与 tick_many 做同样的工作，差值即调度（欠账与读时钟）的开销。
+      BridgeTickScheduler* scheduler = bridge::CreateTickScheduler();
+      bench.Run("tick_budget/" + std::to_string(count), count,
+        []() {},
+        [&]() { bridge::TickManyWithBudget(*scheduler, cores.data(), count, dt, UINT64_MAX, streams.data(), nullptr, nullptr); });
+      bridge::DestroyTickScheduler(scheduler);
+
+      for (BridgeCore* core : cores)
+      {
+        bridge::DestroyCore(core);
+      }
+    }
+  }
+
+  static const char* FindOption(int argc, char** argv, const char* name)
+  {
+    for (int i = 1; i + 1 < argc; ++i)
+    {
+      if (std::strcmp(argv[i], name) == 0)
+      {
+        return argv[i + 1];
+      }
+    }
+    return nullptr;
+  }
+}
+
+int main(int argc, char** argv)
+{
+  // --quick：少量重复、core 数上限 1000（ctest 冒烟用）。
+  // --warmup N / --reps N / --max-cores N / --workers N / --filter <子串> / --json <path>
+  Options options;
+  for (int i = 1; i < argc; ++i)
+  {
+    if (std::strcmp(argv[i], "--quick") == 0)
+    {
+      options.warmup = 1;
+      options.reps = 3;
+      options.maxCores = 1000;
+    }
+  }
+  if (const char* v = FindOption(argc, argv, "--warmup")) options.warmup = std::atoi(v);
+  if (const char* v = FindOption(argc, argv, "--reps")) options.reps = std::atoi(v);
+  if (const char* v = FindOption(argc, argv, "--max-cores")) options.maxCores = static_cast<uint32_t>(std::strtoul(v, nullptr, 10));
+  if (const char* v = FindOption(argc, argv, "--workers")) options.workers = static_cast<uint32_t>(std::strtoul(v, nullptr, 10));
+  options.filter = FindOption(argc, argv, "--filter");
+  options.jsonPath = FindOption(argc, argv, "--json");
+
+  if (options.warmup < 0 || options.reps < 1)
+  {
+    std::printf("invalid --warmup/--reps\n");
+    return 1;
+  }
+  if (bridge::SetTickWorkerCount(options.workers) != BRIDGE_OK)
+  {
+    std::printf("invalid --workers: %u\n", options.workers);
+    return 1;
+  }
+
+  std::printf("bridge_bench: warmup=%d reps=%d max_cores=%u workers=%u\n",
+    options.warmup, options.reps, options.maxCores, options.workers);
+
+  if (!CheckCoalesceOrder())
+  {
+    return 1;
+  }
+
+  const float dt = 1.0f / 60.0f;
+  Bench bench(options);
+  BenchCallHost(bench);
+  BenchStreamGrow(bench);
+  BenchTransformStore(bench);
+  BenchStoreUtf8(bench);
+  BenchTickDrain(bench, dt);
+  BenchDispatchStream(bench);
+  BenchTraceZone(bench);
+  BenchCreateCores(bench, options);
+  BenchTickMany(bench, options, dt);
+
+  bridge::SetTickWorkerCount(0);
+
+  if (options.jsonPath && !bench.WriteJson(options.jsonPath))
+  {
+    std::printf("failed to write %s\n", options.jsonPath);
+    return 1;
+  }
+  return 0;
+}
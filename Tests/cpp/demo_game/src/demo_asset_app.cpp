@@ -1,22 +1,26 @@
 #include "demo_asset_app.h"
 
 #include <bridge/runtime/core_context.h>
+#include <bridge/runtime/trace.h>
 
 #include <demo_asset_bindings.generated.h>
 #include <demo_entity_bindings.generated.h>
 #include <demo_log_bindings.generated.h>
 
 #include <string>
+#include <string_view>
 
 namespace bridge
 {
 	namespace
 	{
+		constexpr std::string_view kStartupAssetKey = "Main/Prefabs/Bot";
+
 		// 最小示例 App（用于验证数据流）：
 		// - 请求一个 Prefab 资源
 		// - 资源加载完成后 Spawn 一个实体
 		// - 每帧更新 Transform
-		class DemoAssetApp final : public ICoreApp
+		class DemoAssetApp final : public CoreAppBase<DemoAssetApp>
 		{
 		public:
 			void Tick(CoreContext& ctx, float dt) override
@@ -25,14 +29,23 @@ namespace bridge
 				{
 					startup_asset_requested_ = true;
 					startup_request_id_ = ctx.AllocRequestId();
-					demo_log::Log(ctx, BRIDGE_LOG_INFO, "Requesting startup prefab asset");
-					demo_asset::LoadAsset(ctx, startup_request_id_, BRIDGE_ASSET_PREFAB, "Main/Prefabs/Bot");
+					// 挂了共享资源缓存时，只有第一个请求这个 Prefab 的 core 发给 Host，其余的等 AssetLoaded 转来。
+					if (ctx.RequestSharedAsset(BRIDGE_ASSET_PREFAB, kStartupAssetKey, startup_request_id_))
+					{
+						demo_log::Log(ctx, BRIDGE_LOG_INFO, "Requesting startup prefab asset");
+						demo_asset::LoadAsset(ctx, startup_request_id_, BRIDGE_ASSET_PREFAB, kStartupAssetKey);
+					}
 				}
 
 				if (startup_asset_ready_ && !entity_spawned_)
 				{
 					entity_spawned_ = true;
-					demo_entity::SpawnEntity(ctx, entity_id_, startup_asset_handle_, CoreContext::IdentityTransform(), /*flags*/ 0);
+					const BridgeTransform spawnTransform = CoreContext::IdentityTransform();
+					demo_entity::SpawnEntity(ctx, entity_id_, startup_asset_handle_, spawnTransform, /*flags*/ 0);
+
+					// 之后只写 Transform 组件，变化由 Runtime 在本帧末尾输出（只动了位置时为 SetPosition）。
+					ctx.Transforms().BindCommands(&EmitPosition, &EmitTransform);
+					entity_transform_ = ctx.Transforms().Create(entity_id_, spawnTransform);
 				}
 
 				if (entity_spawned_)
@@ -40,21 +53,25 @@ namespace bridge
 					t_ += dt;
 					BridgeVec3 pos{};
 					pos.x = t_;
-					demo_entity::SetPosition(ctx, entity_id_, pos);
+					ctx.Transforms().SetPosition(entity_transform_, pos);
 				}
 			}
 
-			void OnCallCore(CoreContext& ctx, uint32_t funcId, const void* payload, uint32_t payloadSize) override
+			// 状态全是值类型，逐成员复制即可；示例不使用随机数，无需按 seed 重新播种。
+			std::unique_ptr<ICoreApp> Clone(uint64_t /*seed*/) const override
 			{
-				if (funcId != static_cast<uint32_t>(demo_asset::CoreFuncId::AssetLoaded) ||
-				    payloadSize != sizeof(demo_asset::CoreArgs_AssetLoaded) ||
-				    !payload)
-				{
-					return;
-				}
+				return std::make_unique<DemoAssetApp>(*this);
+			}
 
-				const auto& evt = *reinterpret_cast<const demo_asset::CoreArgs_AssetLoaded*>(payload);
+			// Host -> Core 调用经 CoreAppBase 静态转发到这里，再由生成的分发器 switch 到 OnXxx。
+			void DispatchCallCore(CoreContext& ctx, uint32_t funcId, const void* payload, uint32_t payloadSize)
+			{
+				demo_asset::DispatchCoreCall(*this, ctx, funcId, payload, payloadSize);
+			}
 
+			void OnAssetLoaded(CoreContext& ctx, const demo_asset::CoreArgs_AssetLoaded& evt)
+			{
+				BRIDGE_TRACE_ZONE(ctx, "DemoAssetApp::OnAssetLoaded");
 				if (evt.requestId != startup_request_id_)
 				{
 					return;
@@ -62,6 +79,8 @@ namespace bridge
 				if (evt.status != BRIDGE_ASSET_STATUS_OK)
 				{
 					demo_log::Log(ctx, BRIDGE_LOG_ERROR, "Startup asset failed to load");
+					// ERROR 可能是暂时的（例如共享缓存中发出请求的 core 已销毁）：下一帧重新请求。
+					startup_asset_requested_ = evt.status != BRIDGE_ASSET_STATUS_ERROR;
 					return;
 				}
 
@@ -71,6 +90,16 @@ namespace bridge
 			}
 
 		private:
+			static void EmitPosition(CoreContext& ctx, uint64_t entityId, const BridgeVec3& position)
+			{
+				demo_entity::SetPosition(ctx, entityId, position);
+			}
+
+			static void EmitTransform(CoreContext& ctx, uint64_t entityId, uint32_t mask, const BridgeTransform& transform)
+			{
+				demo_entity::SetTransform(ctx, entityId, mask, transform);
+			}
+
 			uint64_t startup_request_id_ = 0;
 			bool startup_asset_requested_ = false;
 			bool startup_asset_ready_ = false;
@@ -78,6 +107,7 @@ namespace bridge
 
 			bool entity_spawned_ = false;
 			uint64_t entity_id_ = 1;
+			TransformHandle entity_transform_ = 0;
 
 			float t_ = 0.0f;
 		};
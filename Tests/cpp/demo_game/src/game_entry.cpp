@@ -2,11 +2,19 @@
 
 #include "demo_asset_app.h"
 
+#include <bridge_host_opcodes.generated.h>
+
 namespace bridge
 {
 	std::unique_ptr<ICoreApp> CreateGameApp()
 	{
 		return CreateDemoAssetApp();
 	}
+
+	namespace
+	{
+		// 库加载时登记，Host 握手（Bridge_GetHostOpcodes）可能早于任何 core 的创建。
+		[[maybe_unused]] const bool kHostOpcodesRegistered = (SetGameHostOpcodes(kGeneratedHostOpcodes), true);
+	}
 }
 
@@ -0,0 +1,494 @@
+#pragma once
+
+#include <bridge/bridge.h>
+
+#include <demo_asset_bindings.generated.h>
+#include <demo_entity_bindings.generated.h>
+#include <demo_log_bindings.generated.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace bridge
+{
+	// 一条批量命令中同一函数的连续调用（按顺序排列，相邻 payload 间隔 stride 字节）。
+	template <class TArgs>
+	class HostCallBatch
+	{
+	public:
+		HostCallBatch(const uint8_t* data, uint32_t count, uint32_t stride)
+			: data_(data), count_(count), stride_(stride)
+		{
+		}
+
+		uint32_t Count() const { return count_; }
+
+		const TArgs& operator[](uint32_t i) const
+		{
+			return *reinterpret_cast<const TArgs*>(data_ + static_cast<size_t>(i) * stride_);
+		}
+
+	private:
+		const uint8_t* data_;
+		uint32_t count_;
+		uint32_t stride_;
+	};
+
+	namespace host_dispatch_detail
+	{
+		template <class THost>
+		inline void CallLoadAsset(THost& host, const uint8_t* payload)
+		{
+			if constexpr (requires(THost& h, const demo_asset::HostArgs_LoadAsset& a) { h.LoadAsset(a); })
+			{
+				host.LoadAsset(*reinterpret_cast<const demo_asset::HostArgs_LoadAsset*>(payload));
+			}
+		}
+
+		template <class THost>
+		inline void CallLoadAssetBatch(THost& host, const uint8_t* payload, uint32_t count, uint32_t stride)
+		{
+			if constexpr (requires(THost& h, HostCallBatch<demo_asset::HostArgs_LoadAsset> b) { h.LoadAssetBatch(b); })
+			{
+				host.LoadAssetBatch(HostCallBatch<demo_asset::HostArgs_LoadAsset>(payload, count, stride));
+			}
+			else
+			{
+				for (uint32_t i = 0; i < count; ++i)
+				{
+					CallLoadAsset(host, payload + static_cast<size_t>(i) * stride);
+				}
+			}
+		}
+
+		template <class THost>
+		inline void CallSpawnEntity(THost& host, const uint8_t* payload)
+		{
+			if constexpr (requires(THost& h, const demo_entity::HostArgs_SpawnEntity& a) { h.SpawnEntity(a); })
+			{
+				host.SpawnEntity(*reinterpret_cast<const demo_entity::HostArgs_SpawnEntity*>(payload));
+			}
+		}
+
+		template <class THost>
+		inline void CallSpawnEntityBatch(THost& host, const uint8_t* payload, uint32_t count, uint32_t stride)
+		{
+			if constexpr (requires(THost& h, HostCallBatch<demo_entity::HostArgs_SpawnEntity> b) { h.SpawnEntityBatch(b); })
+			{
+				host.SpawnEntityBatch(HostCallBatch<demo_entity::HostArgs_SpawnEntity>(payload, count, stride));
+			}
+			else
+			{
+				for (uint32_t i = 0; i < count; ++i)
+				{
+					CallSpawnEntity(host, payload + static_cast<size_t>(i) * stride);
+				}
+			}
+		}
+
+		template <class THost>
+		inline void CallSetTransform(THost& host, const uint8_t* payload)
+		{
+			if constexpr (requires(THost& h, const demo_entity::HostArgs_SetTransform& a) { h.SetTransform(a); })
+			{
+				host.SetTransform(*reinterpret_cast<const demo_entity::HostArgs_SetTransform*>(payload));
+			}
+		}
+
+		template <class THost>
+		inline void CallSetTransformBatch(THost& host, const uint8_t* payload, uint32_t count, uint32_t stride)
+		{
+			if constexpr (requires(THost& h, HostCallBatch<demo_entity::HostArgs_SetTransform> b) { h.SetTransformBatch(b); })
+			{
+				host.SetTransformBatch(HostCallBatch<demo_entity::HostArgs_SetTransform>(payload, count, stride));
+			}
+			else
+			{
+				for (uint32_t i = 0; i < count; ++i)
+				{
+					CallSetTransform(host, payload + static_cast<size_t>(i) * stride);
+				}
+			}
+		}
+
+		template <class THost>
+		inline void CallSetPosition(THost& host, const uint8_t* payload)
+		{
+			if constexpr (requires(THost& h, const demo_entity::HostArgs_SetPosition& a) { h.SetPosition(a); })
+			{
+				host.SetPosition(*reinterpret_cast<const demo_entity::HostArgs_SetPosition*>(payload));
+			}
+		}
+
+		template <class THost>
+		inline void CallSetPositionBatch(THost& host, const uint8_t* payload, uint32_t count, uint32_t stride)
+		{
+			if constexpr (requires(THost& h, HostCallBatch<demo_entity::HostArgs_SetPosition> b) { h.SetPositionBatch(b); })
+			{
+				host.SetPositionBatch(HostCallBatch<demo_entity::HostArgs_SetPosition>(payload, count, stride));
+			}
+			else
+			{
+				for (uint32_t i = 0; i < count; ++i)
+				{
+					CallSetPosition(host, payload + static_cast<size_t>(i) * stride);
+				}
+			}
+		}
+
+		template <class THost>
+		inline void CallDestroyEntity(THost& host, const uint8_t* payload)
+		{
+			if constexpr (requires(THost& h, const demo_entity::HostArgs_DestroyEntity& a) { h.DestroyEntity(a); })
+			{
+				host.DestroyEntity(*reinterpret_cast<const demo_entity::HostArgs_DestroyEntity*>(payload));
+			}
+		}
+
+		template <class THost>
+		inline void CallDestroyEntityBatch(THost& host, const uint8_t* payload, uint32_t count, uint32_t stride)
+		{
+			if constexpr (requires(THost& h, HostCallBatch<demo_entity::HostArgs_DestroyEntity> b) { h.DestroyEntityBatch(b); })
+			{
+				host.DestroyEntityBatch(HostCallBatch<demo_entity::HostArgs_DestroyEntity>(payload, count, stride));
+			}
+			else
+			{
+				for (uint32_t i = 0; i < count; ++i)
+				{
+					CallDestroyEntity(host, payload + static_cast<size_t>(i) * stride);
+				}
+			}
+		}
+
+		template <class THost>
+		inline void CallLog(THost& host, const uint8_t* payload)
+		{
+			if constexpr (requires(THost& h, const demo_log::HostArgs_Log& a) { h.Log(a); })
+			{
+				host.Log(*reinterpret_cast<const demo_log::HostArgs_Log*>(payload));
+			}
+		}
+
+		template <class THost>
+		inline void CallLogBatch(THost& host, const uint8_t* payload, uint32_t count, uint32_t stride)
+		{
+			if constexpr (requires(THost& h, HostCallBatch<demo_log::HostArgs_Log> b) { h.LogBatch(b); })
+			{
+				host.LogBatch(HostCallBatch<demo_log::HostArgs_Log>(payload, count, stride));
+			}
+			else
+			{
+				for (uint32_t i = 0; i < count; ++i)
+				{
+					CallLog(host, payload + static_cast<size_t>(i) * stride);
+				}
+			}
+		}
+
+		// kChecked = false 时只校验命令边界（header.size），信任 payload 大小与批量条目数。
+		template <bool kChecked, class THost>
+		inline uint64_t Dispatch(const void* ptr, uint32_t len, THost& host)
+		{
+			const uint8_t* cursor = static_cast<const uint8_t*>(ptr);
+			const uint8_t* const end = cursor ? cursor + len : cursor;
+			uint64_t calls = 0;
+
+			while (static_cast<size_t>(end - cursor) >= sizeof(BridgeCommandHeader))
+			{
+				BridgeCommandHeader header{};
+				std::memcpy(&header, cursor, sizeof(header));
+				if (header.size < sizeof(BridgeCommandHeader) || header.size > static_cast<size_t>(end - cursor))
+				{
+					break;
+				}
+
+				const uint8_t* const cmd = cursor;
+				cursor += header.size;
+
+				if (header.type >= BRIDGE_CMD_OPCODE_BASE)
+				{
+					if (kChecked && header.size < sizeof(BridgeCmdCallOp))
+					{
+						continue;
+					}
+					BridgeCmdCallOp op{};
+					std::memcpy(&op, cmd, sizeof(op));
+					const uint8_t* payload = cmd + sizeof(BridgeCmdCallOp);
+					const uint64_t payloadBytes = header.size - sizeof(BridgeCmdCallOp);
+
+					switch (header.type)
+					{
+					case static_cast<uint16_t>(demo_asset::HostOpcode::LoadAsset):
+					{
+						constexpr uint32_t stride = (sizeof(demo_asset::HostArgs_LoadAsset) + 7u) & ~7u;
+						if (kChecked && static_cast<uint64_t>(op.count) * stride > payloadBytes)
+						{
+							break;
+						}
+						calls += op.count;
+						if (op.count == 1)
+						{
+							CallLoadAsset(host, payload);
+						}
+						else
+						{
+							CallLoadAssetBatch(host, payload, op.count, stride);
+						}
+						break;
+					}
+					case static_cast<uint16_t>(demo_entity::HostOpcode::SpawnEntity):
+					{
+						constexpr uint32_t stride = (sizeof(demo_entity::HostArgs_SpawnEntity) + 7u) & ~7u;
+						if (kChecked && static_cast<uint64_t>(op.count) * stride > payloadBytes)
+						{
+							break;
+						}
+						calls += op.count;
+						if (op.count == 1)
+						{
+							CallSpawnEntity(host, payload);
+						}
+						else
+						{
+							CallSpawnEntityBatch(host, payload, op.count, stride);
+						}
+						break;
+					}
+					case static_cast<uint16_t>(demo_entity::HostOpcode::SetTransform):
+					{
+						constexpr uint32_t stride = (sizeof(demo_entity::HostArgs_SetTransform) + 7u) & ~7u;
+						if (kChecked && static_cast<uint64_t>(op.count) * stride > payloadBytes)
+						{
+							break;
+						}
+						calls += op.count;
+						if (op.count == 1)
+						{
+							CallSetTransform(host, payload);
+						}
+						else
+						{
+							CallSetTransformBatch(host, payload, op.count, stride);
+						}
+						break;
+					}
+					case static_cast<uint16_t>(demo_entity::HostOpcode::SetPosition):
+					{
+						constexpr uint32_t stride = (sizeof(demo_entity::HostArgs_SetPosition) + 7u) & ~7u;
+						if (kChecked && static_cast<uint64_t>(op.count) * stride > payloadBytes)
+						{
+							break;
+						}
+						calls += op.count;
+						if (op.count == 1)
+						{
+							CallSetPosition(host, payload);
+						}
+						else
+						{
+							CallSetPositionBatch(host, payload, op.count, stride);
+						}
+						break;
+					}
+					case static_cast<uint16_t>(demo_entity::HostOpcode::DestroyEntity):
+					{
+						constexpr uint32_t stride = (sizeof(demo_entity::HostArgs_DestroyEntity) + 7u) & ~7u;
+						if (kChecked && static_cast<uint64_t>(op.count) * stride > payloadBytes)
+						{
+							break;
+						}
+						calls += op.count;
+						if (op.count == 1)
+						{
+							CallDestroyEntity(host, payload);
+						}
+						else
+						{
+							CallDestroyEntityBatch(host, payload, op.count, stride);
+						}
+						break;
+					}
+					case static_cast<uint16_t>(demo_log::HostOpcode::Log):
+					{
+						constexpr uint32_t stride = (sizeof(demo_log::HostArgs_Log) + 7u) & ~7u;
+						if (kChecked && static_cast<uint64_t>(op.count) * stride > payloadBytes)
+						{
+							break;
+						}
+						calls += op.count;
+						if (op.count == 1)
+						{
+							CallLog(host, payload);
+						}
+						else
+						{
+							CallLogBatch(host, payload, op.count, stride);
+						}
+						break;
+					}
+					default:
+						calls += op.count;
+						break;
+					}
+					continue;
+				}
+
+				switch (header.type)
+				{
+				case BRIDGE_CMD_CALL_HOST:
+				{
+					++calls;
+					if (kChecked && header.size < sizeof(BridgeCmdCallHost))
+					{
+						break;
+					}
+					BridgeCmdCallHost call{};
+					std::memcpy(&call, cmd, sizeof(call));
+					const uint8_t* payload = cmd + sizeof(BridgeCmdCallHost);
+					const uint32_t payloadBytes = header.size - static_cast<uint32_t>(sizeof(BridgeCmdCallHost));
+
+					switch (call.func_id)
+					{
+					case static_cast<uint32_t>(demo_asset::HostFuncId::LoadAsset):
+						if (!kChecked || payloadBytes >= sizeof(demo_asset::HostArgs_LoadAsset))
+						{
+							CallLoadAsset(host, payload);
+						}
+						break;
+					case static_cast<uint32_t>(demo_entity::HostFuncId::SpawnEntity):
+						if (!kChecked || payloadBytes >= sizeof(demo_entity::HostArgs_SpawnEntity))
+						{
+							CallSpawnEntity(host, payload);
+						}
+						break;
+					case static_cast<uint32_t>(demo_entity::HostFuncId::SetTransform):
+						if (!kChecked || payloadBytes >= sizeof(demo_entity::HostArgs_SetTransform))
+						{
+							CallSetTransform(host, payload);
+						}
+						break;
+					case static_cast<uint32_t>(demo_entity::HostFuncId::SetPosition):
+						if (!kChecked || payloadBytes >= sizeof(demo_entity::HostArgs_SetPosition))
+						{
+							CallSetPosition(host, payload);
+						}
+						break;
+					case static_cast<uint32_t>(demo_entity::HostFuncId::DestroyEntity):
+						if (!kChecked || payloadBytes >= sizeof(demo_entity::HostArgs_DestroyEntity))
+						{
+							CallDestroyEntity(host, payload);
+						}
+						break;
+					case static_cast<uint32_t>(demo_log::HostFuncId::Log):
+						if (!kChecked || payloadBytes >= sizeof(demo_log::HostArgs_Log))
+						{
+							CallLog(host, payload);
+						}
+						break;
+					default:
+						break;
+					}
+					break;
+				}
+				case BRIDGE_CMD_CALL_HOST_BATCH:
+				{
+					if (kChecked && header.size < sizeof(BridgeCmdCallHostBatch))
+					{
+						break;
+					}
+					BridgeCmdCallHostBatch batch{};
+					std::memcpy(&batch, cmd, sizeof(batch));
+					if (kChecked && static_cast<uint64_t>(batch.count) * batch.stride > header.size - sizeof(BridgeCmdCallHostBatch))
+					{
+						break;
+					}
+					calls += batch.count;
+					const uint8_t* payload = cmd + sizeof(BridgeCmdCallHostBatch);
+
+					switch (batch.func_id)
+					{
+					case static_cast<uint32_t>(demo_asset::HostFuncId::LoadAsset):
+						if (!kChecked || batch.stride >= sizeof(demo_asset::HostArgs_LoadAsset))
+						{
+							CallLoadAssetBatch(host, payload, batch.count, batch.stride);
+						}
+						break;
+					case static_cast<uint32_t>(demo_entity::HostFuncId::SpawnEntity):
+						if (!kChecked || batch.stride >= sizeof(demo_entity::HostArgs_SpawnEntity))
+						{
+							CallSpawnEntityBatch(host, payload, batch.count, batch.stride);
+						}
+						break;
+					case static_cast<uint32_t>(demo_entity::HostFuncId::SetTransform):
+						if (!kChecked || batch.stride >= sizeof(demo_entity::HostArgs_SetTransform))
+						{
+							CallSetTransformBatch(host, payload, batch.count, batch.stride);
+						}
+						break;
+					case static_cast<uint32_t>(demo_entity::HostFuncId::SetPosition):
+						if (!kChecked || batch.stride >= sizeof(demo_entity::HostArgs_SetPosition))
+						{
+							CallSetPositionBatch(host, payload, batch.count, batch.stride);
+						}
+						break;
+					case static_cast<uint32_t>(demo_entity::HostFuncId::DestroyEntity):
+						if (!kChecked || batch.stride >= sizeof(demo_entity::HostArgs_DestroyEntity))
+						{
+							CallDestroyEntityBatch(host, payload, batch.count, batch.stride);
+						}
+						break;
+					case static_cast<uint32_t>(demo_log::HostFuncId::Log):
+						if (!kChecked || batch.stride >= sizeof(demo_log::HostArgs_Log))
+						{
+							CallLogBatch(host, payload, batch.count, batch.stride);
+						}
+						break;
+					default:
+						break;
+					}
+					break;
+				}
+				case BRIDGE_CMD_DEFINE_STRING:
+					++calls;
+					if constexpr (requires(THost& h, const BridgeCmdDefineString& c) { h.DefineString(c); })
+					{
+						if (!kChecked || header.size >= sizeof(BridgeCmdDefineString))
+						{
+							host.DefineString(*reinterpret_cast<const BridgeCmdDefineString*>(cmd));
+						}
+					}
+					break;
+				default:
+					++calls;
+					break;
+				}
+			}
+			return calls;
+		}
+	}
+
+	// 单次扫描 command stream，按 func_id / opcode 分发到 host 的同名成员函数（模板内联，无虚调用）：
+	//   void LoadAsset(const demo_asset::HostArgs_LoadAsset& args);
+	//   void SpawnEntity(const demo_entity::HostArgs_SpawnEntity& args);
+	//   void SetTransform(const demo_entity::HostArgs_SetTransform& args);
+	//   void SetPosition(const demo_entity::HostArgs_SetPosition& args);
+	//   void DestroyEntity(const demo_entity::HostArgs_DestroyEntity& args);
+	//   void Log(const demo_log::HostArgs_Log& args);
+	// 可选：XxxBatch(bridge::HostCallBatch<HostArgs_Xxx>) 整批处理（缺省逐条调用 Xxx）、
+	// DefineString(const BridgeCmdDefineString&) 接收驻留字符串宣告。host 未实现的函数直接跳过。
+	// 返回解析的调用数（批量命令按条目计，其它命令各计 1）。
+	template <class THost>
+	inline uint64_t DispatchFast(const void* ptr, uint32_t len, THost& host)
+	{
+		return host_dispatch_detail::Dispatch<true>(ptr, len, host);
+	}
+
+	// 同 DispatchFast，但信任 stream 内容（来自同一次生成的 Core）：只校验命令边界，不校验 payload 大小。
+	template <class THost>
+	inline uint64_t DispatchFastUnchecked(const void* ptr, uint32_t len, THost& host)
+	{
+		return host_dispatch_detail::Dispatch<false>(ptr, len, host);
+	}
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <bridge/bridge.h>
+
+#include <span>
+
+namespace bridge
+{
+	// BridgeGen 分配的 Host opcode 表（按 opcode 递增，与生成的 C# 分发器一致）。
+	inline constexpr BridgeHostOpcode kGeneratedHostOpcodeEntries[] = {
+		{0x0100u, 0u, 0x82A5E93Au}, // DemoAsset.LoadAsset
+		{0x0101u, 0u, 0xBCAA331Du}, // DemoEntity.SpawnEntity
+		{0x0102u, 0u, 0x20DA0B6Fu}, // DemoEntity.SetTransform
+		{0x0103u, 0u, 0x5B16AE9Eu}, // DemoEntity.SetPosition
+		{0x0104u, 0u, 0xC7C1C59Cu}, // DemoEntity.DestroyEntity
+		{0x0105u, 0u, 0xDA3184A2u}, // DemoLog.Log
+	};
+
+	inline constexpr std::span<const BridgeHostOpcode> kGeneratedHostOpcodes{kGeneratedHostOpcodeEntries};
+}
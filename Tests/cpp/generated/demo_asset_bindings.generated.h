@@ -6,6 +6,7 @@
 #include <cstdint>
 #include <string>
 #include <string_view>
+#include <type_traits>
 
 namespace demo_asset
 {
@@ -19,11 +20,16 @@ namespace demo_asset
 		AssetLoaded = 0x2442BC8Au,
 	};
 
+	enum class HostOpcode : uint16_t
+	{
+		LoadAsset = 0x0100u,
+	};
+
 	struct HostArgs_LoadAsset
 	{
 		uint64_t requestId;
 		BridgeAssetType assetType;
-		BridgeStringView assetKey;
+		BridgeStringId assetKey;
 	};
 
 	struct CoreArgs_AssetLoaded
@@ -36,11 +42,36 @@ namespace demo_asset
 	// Core -> Host 调用（写入 command stream）
 	inline void LoadAsset(bridge::CoreContext& ctx, uint64_t requestId, BridgeAssetType assetType, std::string_view assetKey)
 	{
-		HostArgs_LoadAsset a{};
-		a.requestId = requestId;
-		a.assetType = assetType;
-		a.assetKey = ctx.StoreUtf8(std::string(assetKey));
-		ctx.CallHost(static_cast<uint32_t>(HostFuncId::LoadAsset), &a, static_cast<uint32_t>(sizeof(a)));
+		const BridgeStringId assetKeyId = ctx.InternUtf8(assetKey);
+		auto* a = ctx.Emplace<HostArgs_LoadAsset>(static_cast<uint32_t>(HostFuncId::LoadAsset), static_cast<uint16_t>(HostOpcode::LoadAsset));
+		a->requestId = requestId;
+		a->assetType = assetType;
+		a->assetKey = assetKeyId;
+	}
+
+	static_assert(std::is_trivially_copyable<CoreArgs_AssetLoaded>::value && std::is_standard_layout<CoreArgs_AssetLoaded>::value, "CoreArgs_AssetLoaded must be a POD payload");
+	static_assert(alignof(CoreArgs_AssetLoaded) <= 8, "CoreArgs_AssetLoaded alignment must not exceed 8");
+
+	// Host -> Core 调用分发（配合 bridge::CoreAppBase 使用）。TApp 需为本模块每个 Core 函数实现：
+	//   void OnAssetLoaded(bridge::CoreContext& ctx, const CoreArgs_AssetLoaded& args);
+	// 返回 false 表示 funcId 不属于本模块，或 payload 大小与声明不符（该调用被丢弃）。
+	template <class TApp>
+	inline bool DispatchCoreCall(TApp& app, bridge::CoreContext& ctx, uint32_t funcId, const void* payload, uint32_t payloadSize)
+	{
+		static_assert(requires(TApp& a, bridge::CoreContext& c, const CoreArgs_AssetLoaded& x) { a.OnAssetLoaded(c, x); }, "TApp must implement OnAssetLoaded(bridge::CoreContext&, const CoreArgs_AssetLoaded&)");
+
+		switch (static_cast<CoreFuncId>(funcId))
+		{
+		case CoreFuncId::AssetLoaded:
+			if (payloadSize != sizeof(CoreArgs_AssetLoaded))
+			{
+				return false;
+			}
+			app.OnAssetLoaded(ctx, *static_cast<const CoreArgs_AssetLoaded*>(payload));
+			return true;
+		default:
+			return false;
+		}
 	}
 
 } // namespace demo_asset
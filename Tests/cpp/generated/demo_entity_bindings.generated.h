@@ -6,6 +6,7 @@
 #include <cstdint>
 #include <string>
 #include <string_view>
+#include <type_traits>
 
 namespace demo_entity
 {
@@ -21,6 +22,14 @@ namespace demo_entity
 	{
 	};
 
+	enum class HostOpcode : uint16_t
+	{
+		SpawnEntity = 0x0101u,
+		SetTransform = 0x0102u,
+		SetPosition = 0x0103u,
+		DestroyEntity = 0x0104u,
+	};
+
 	struct HostArgs_SpawnEntity
 	{
 		uint64_t entityId;
@@ -50,36 +59,32 @@ namespace demo_entity
 	// Core -> Host 调用（写入 command stream）
 	inline void SpawnEntity(bridge::CoreContext& ctx, uint64_t entityId, uint64_t prefabHandle, BridgeTransform transform, uint32_t flags)
 	{
-		HostArgs_SpawnEntity a{};
-		a.entityId = entityId;
-		a.prefabHandle = prefabHandle;
-		a.transform = transform;
-		a.flags = flags;
-		ctx.CallHost(static_cast<uint32_t>(HostFuncId::SpawnEntity), &a, static_cast<uint32_t>(sizeof(a)));
+		auto* a = ctx.Emplace<HostArgs_SpawnEntity>(static_cast<uint32_t>(HostFuncId::SpawnEntity), static_cast<uint16_t>(HostOpcode::SpawnEntity));
+		a->entityId = entityId;
+		a->prefabHandle = prefabHandle;
+		a->transform = transform;
+		a->flags = flags;
 	}
 
 	inline void SetTransform(bridge::CoreContext& ctx, uint64_t entityId, uint32_t mask, BridgeTransform transform)
 	{
-		HostArgs_SetTransform a{};
-		a.entityId = entityId;
-		a.mask = mask;
-		a.transform = transform;
-		ctx.CallHost(static_cast<uint32_t>(HostFuncId::SetTransform), &a, static_cast<uint32_t>(sizeof(a)));
+		auto* a = ctx.Emplace<HostArgs_SetTransform>(static_cast<uint32_t>(HostFuncId::SetTransform), static_cast<uint16_t>(HostOpcode::SetTransform));
+		a->entityId = entityId;
+		a->mask = mask;
+		a->transform = transform;
 	}
 
 	inline void SetPosition(bridge::CoreContext& ctx, uint64_t entityId, BridgeVec3 position)
 	{
-		HostArgs_SetPosition a{};
-		a.entityId = entityId;
-		a.position = position;
-		ctx.CallHost(static_cast<uint32_t>(HostFuncId::SetPosition), &a, static_cast<uint32_t>(sizeof(a)));
+		auto* a = ctx.EmplaceCoalesced<HostArgs_SetPosition>(static_cast<uint32_t>(HostFuncId::SetPosition), entityId, static_cast<uint16_t>(HostOpcode::SetPosition));
+		a->entityId = entityId;
+		a->position = position;
 	}
 
 	inline void DestroyEntity(bridge::CoreContext& ctx, uint64_t entityId)
 	{
-		HostArgs_DestroyEntity a{};
-		a.entityId = entityId;
-		ctx.CallHost(static_cast<uint32_t>(HostFuncId::DestroyEntity), &a, static_cast<uint32_t>(sizeof(a)));
+		auto* a = ctx.Emplace<HostArgs_DestroyEntity>(static_cast<uint32_t>(HostFuncId::DestroyEntity), static_cast<uint16_t>(HostOpcode::DestroyEntity));
+		a->entityId = entityId;
 	}
 
 } // namespace demo_entity
@@ -6,6 +6,7 @@
 #include <cstdint>
 #include <string>
 #include <string_view>
+#include <type_traits>
 
 namespace demo_log
 {
@@ -18,6 +19,11 @@ namespace demo_log
 	{
 	};
 
+	enum class HostOpcode : uint16_t
+	{
+		Log = 0x0105u,
+	};
+
 	struct HostArgs_Log
 	{
 		BridgeLogLevel level;
@@ -27,10 +33,10 @@ namespace demo_log
 	// Core -> Host 调用（写入 command stream）
 	inline void Log(bridge::CoreContext& ctx, BridgeLogLevel level, std::string_view message)
 	{
-		HostArgs_Log a{};
-		a.level = level;
-		a.message = ctx.StoreUtf8(std::string(message));
-		ctx.CallHost(static_cast<uint32_t>(HostFuncId::Log), &a, static_cast<uint32_t>(sizeof(a)));
+		const BridgeStringView messageView = ctx.StoreUtf8(message);
+		auto* a = ctx.Emplace<HostArgs_Log>(static_cast<uint32_t>(HostFuncId::Log), static_cast<uint16_t>(HostOpcode::Log));
+		a->level = level;
+		a->message = messageView;
 	}
 
 } // namespace demo_log
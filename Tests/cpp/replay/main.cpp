@@ -0,0 +1,272 @@
+#include <bridge/bridge.h>
+
+#include <bridge_host_dispatcher.generated.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// 录制回放（bridge_replay）：读取 BridgeCore_BeginRecording 录制的文件，把 Host 与 Core 拆开单独回放。
+// - host：把每帧 command stream 交给生成的分发器（不运行 Core），测量 Host 侧解析/分发；
+//   核对每个驻留字符串 id 先宣告后引用（中途开始的录制由第一帧补宣告）。
+// - core：新建同配置的 core，逐帧推送录制的 Host->Core 调用并 Tick（不需要 Host），测量 Core 逻辑；
+//   每遍之间用 BridgeCore_Reset 回收同一个 core。录制从 core 创建时开始时，先核对新建与 Reset 后
+//   各一遍产出的 stream 与录制逐帧一致（字符串按内容比较）。
+
+namespace
+{
+  static const char* FindOption(int argc, char** argv, const char* name)
+  {
+    for (int i = 1; i + 1 < argc; ++i)
+    {
+      if (std::strcmp(argv[i], name) == 0)
+      {
+        return argv[i + 1];
+      }
+    }
+    return nullptr;
+  }
+
+  static const char* ViewBytes(BridgeStringView view)
+  {
+    return reinterpret_cast<const char*>(static_cast<uintptr_t>(view.ptr));
+  }
+
+  // 回放 Host：读取每个字符串的内容（验证录制中的 view 可直接解引用），记下已宣告的 id，其余调用只计数。
+  struct ReplayHost
+  {
+    uint64_t stringBytes = 0;
+    uint64_t checksum = 0;
+    std::vector<uint8_t> defined;
+    uint64_t definedCount = 0;
+    uint64_t undefinedRefs = 0;
+
+    void Touch(BridgeStringView view)
+    {
+      const char* p = ViewBytes(view);
+      for (uint32_t i = 0; i < view.len; ++i)
+      {
+        checksum = checksum * 31u + static_cast<unsigned char>(p[i]);
+      }
+      stringBytes += view.len;
+    }
+
+    void Log(const demo_log::HostArgs_Log& args)
+    {
+      Touch(args.message);
+    }
+
+    void LoadAsset(const demo_asset::HostArgs_LoadAsset& args)
+    {
+      if (args.assetKey != 0 && (args.assetKey >= defined.size() || !defined[args.assetKey]))
+      {
+        undefinedRefs++;
+      }
+    }
+
+    void DefineString(const BridgeCmdDefineString& cmd)
+    {
+      Touch(cmd.utf8);
+      if (cmd.id >= defined.size())
+      {
+        defined.resize(static_cast<size_t>(cmd.id) + 1);
+      }
+      definedCount += defined[cmd.id] ? 0 : 1;
+      defined[cmd.id] = 1;
+    }
+  };
+
+  // 回放产出的 stream 与录制是否一致：录制中的字符串字段（relocs）按内容比较，其余字节逐一比较。
+  static bool SameStream(const BridgeRecordedFrame& recorded, const void* ptr, uint32_t len, std::vector<uint8_t>& scratch)
+  {
+    if (len != recorded.stream.len)
+    {
+      return false;
+    }
+    if (len == 0)
+    {
+      return true;
+    }
+
+    const auto* bytes = static_cast<const uint8_t*>(ptr);
+    const auto* expected = static_cast<const uint8_t*>(recorded.stream.ptr);
+    scratch.assign(bytes, bytes + len);
+    for (uint32_t i = 0; i < recorded.reloc_count; ++i)
+    {
+      const uint32_t field = recorded.relocs[i];
+      BridgeStringView want{};
+      BridgeStringView got{};
+      std::memcpy(&want, expected + field, sizeof(want));
+      std::memcpy(&got, scratch.data() + field, sizeof(got));
+      if (want.len != got.len || std::memcmp(ViewBytes(want), ViewBytes(got), want.len) != 0)
+      {
+        return false;
+      }
+      std::memcpy(scratch.data() + field, &want.ptr, sizeof(want.ptr));
+    }
+    return std::memcmp(scratch.data(), expected, len) == 0;
+  }
+
+  static double Seconds(std::chrono::steady_clock::time_point start)
+  {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  }
+
+  // minStrings：录制至少应宣告的驻留字符串数（中途开始的录制核对补宣告）。
+  static bool ReplayHostSide(const std::vector<BridgeRecordedFrame>& frames, int reps, uint64_t minStrings)
+  {
+    ReplayHost host;
+    uint64_t calls = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (int rep = 0; rep < reps; ++rep)
+    {
+      for (const BridgeRecordedFrame& frame : frames)
+      {
+        calls += bridge::DispatchFast(frame.stream.ptr, frame.stream.len, host);
+      }
+    }
+    const double elapsed = Seconds(start);
+
+    std::printf("host: strings_defined=%llu undefined_refs=%llu\n",
+      static_cast<unsigned long long>(host.definedCount), static_cast<unsigned long long>(host.undefinedRefs));
+    if (host.undefinedRefs != 0 || host.definedCount < minStrings)
+    {
+      std::printf("host: expected at least %llu defined strings and no undefined references\n", static_cast<unsigned long long>(minStrings));
+      return false;
+    }
+
+    std::printf("host: reps=%d calls=%llu string_bytes=%llu checksum=%016llx elapsed=%.3f s\n",
+      reps, static_cast<unsigned long long>(calls), static_cast<unsigned long long>(host.stringBytes),
+      static_cast<unsigned long long>(host.checksum), elapsed);
+    if (elapsed > 0.0)
+      std::printf("host: calls/sec: %.0f\n", static_cast<double>(calls) / elapsed);
+    return true;
+  }
+
+  // 在一个新建或刚 Reset 的 core 上回放一遍录制；verify 时逐帧核对，返回不一致的帧数。
+  static uint32_t RunCore(BridgeCore* core, const std::vector<BridgeRecordedFrame>& frames, bool verify)
+  {
+    std::vector<uint8_t> scratch;
+    uint32_t mismatched = 0;
+    for (size_t i = 0; i < frames.size(); ++i)
+    {
+      const BridgeRecordedFrame& frame = frames[i];
+      const void* ptr = nullptr;
+      uint32_t len = 0;
+      if (BridgeCore_PushCallsCore(core, frame.inbound.ptr, frame.inbound.len) != BRIDGE_OK ||
+          BridgeCore_TickAndGetCommandStream(core, frame.dt, &ptr, &len) != BRIDGE_OK)
+      {
+        mismatched++;
+        continue;
+      }
+      if (verify && !SameStream(frame, ptr, len, scratch))
+      {
+        if (mismatched == 0)
+          std::printf("core: first mismatch at frame %zu (recorded %u bytes, replayed %u bytes)\n", i, frame.stream.len, len);
+        mismatched++;
+      }
+      BridgeCore_ReleaseStream(core);
+    }
+    return mismatched;
+  }
+
+  static bool ReplayCoreSide(const BridgeRecordingHeader& header, const std::vector<BridgeRecordedFrame>& frames, int reps)
+  {
+    BridgeCore* core = BridgeCore_Create(header.config);
+    if (!core)
+    {
+      std::printf("core: BridgeCore_Create failed\n");
+      return false;
+    }
+
+    if (header.start_tick == 0)
+    {
+      const uint32_t fresh = RunCore(core, frames, /*verify*/ true);
+      const bool reset = BridgeCore_Reset(core, header.config) == BRIDGE_OK;
+      const uint32_t recycled = reset ? RunCore(core, frames, /*verify*/ true) : static_cast<uint32_t>(frames.size());
+      std::printf("core: verified %zu frames, mismatched=%u (fresh) %u (after reset)\n", frames.size(), fresh, recycled);
+      if (fresh != 0 || recycled != 0)
+      {
+        BridgeCore_Destroy(core);
+        return false;
+      }
+    }
+    else
+    {
+      std::printf("core: recording starts at tick %llu, output is not compared\n", static_cast<unsigned long long>(header.start_tick));
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int rep = 0; rep < reps; ++rep)
+    {
+      BridgeCore_Reset(core, header.config);
+      RunCore(core, frames, /*verify*/ false);
+    }
+    const double elapsed = Seconds(start);
+    BridgeCore_Destroy(core);
+
+    const uint64_t ticks = static_cast<uint64_t>(frames.size()) * static_cast<uint64_t>(reps);
+    std::printf("core: reps=%d ticks=%llu elapsed=%.3f s\n", reps, static_cast<unsigned long long>(ticks), elapsed);
+    if (elapsed > 0.0)
+      std::printf("core: ticks/sec: %.0f\n", static_cast<double>(ticks) / elapsed);
+    return true;
+  }
+}
+
+int main(int argc, char** argv)
+{
+  // bridge_replay <recording> [--mode host|core|both] [--reps N] [--min-strings N]
+  if (argc < 2)
+  {
+    std::printf("usage: bridge_replay <recording> [--mode host|core|both] [--reps N] [--min-strings N]\n");
+    return 1;
+  }
+
+  const char* path = argv[1];
+  const std::string mode = FindOption(argc, argv, "--mode") ? FindOption(argc, argv, "--mode") : "both";
+  int reps = 1;
+  if (const char* r = FindOption(argc, argv, "--reps")) reps = std::atoi(r);
+  uint64_t minStrings = 0;
+  if (const char* m = FindOption(argc, argv, "--min-strings")) minStrings = std::strtoull(m, nullptr, 10);
+  if (reps < 1 || (mode != "host" && mode != "core" && mode != "both"))
+  {
+    std::printf("invalid --mode/--reps\n");
+    return 1;
+  }
+
+  BridgeRecording* recording = BridgeRecording_Open(path);
+  if (!recording)
+  {
+    std::printf("cannot open recording %s\n", path);
+    return 1;
+  }
+
+  BridgeRecordingHeader header{};
+  BridgeRecording_GetHeader(recording, &header);
+  std::vector<BridgeRecordedFrame> frames(header.frame_count);
+  for (uint32_t i = 0; i < header.frame_count; ++i)
+  {
+    BridgeRecording_GetFrame(recording, i, &frames[i]);
+  }
+
+  std::printf("bridge_replay: %s frames=%u seed=%llu mode=%u flags=0x%x runtime=%u.%u.%u\n",
+    path, header.frame_count, static_cast<unsigned long long>(header.config.seed), header.config.mode, header.config.flags,
+    header.runtime_version.major, header.runtime_version.minor, header.runtime_version.patch);
+
+  bool ok = true;
+  if (mode != "core")
+  {
+    ok = ReplayHostSide(frames, reps, minStrings) && ok;
+  }
+  if (mode != "host")
+  {
+    ok = ReplayCoreSide(header, frames, reps) && ok;
+  }
+
+  BridgeRecording_Close(recording);
+  return ok ? 0 : 1;
+}
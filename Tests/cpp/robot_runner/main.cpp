@@ -1,64 +1,554 @@
 #include <bridge/bridge.h>
 
-#include <demo_asset_bindings.generated.h>
+#include <bridge_host_dispatcher.generated.h>
+#include <bridge_host_opcodes.generated.h>
 
+#include <algorithm>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <string>
+#include <thread>
 #include <vector>
 
 namespace
 {
-  struct CommandCursor
+  static std::string ReadUtf8(BridgeStringView view)
+  {
+    const char* p = reinterpret_cast<const char*>(static_cast<uintptr_t>(view.ptr));
+    if (!p || view.len == 0)
+    {
+      return std::string();
+    }
+    return std::string(p, p + view.len);
+  }
+
+  static uint64_t FakeHandleFromKey(const std::string& key)
+  {
+    // Simple FNV-1a 64-bit
+    uint64_t hash = 1469598103934665603ull;
+    for (unsigned char c : key)
+    {
+      hash ^= static_cast<uint64_t>(c);
+      hash *= 1099511628211ull;
+    }
+    return hash ? hash : 1ull;
+  }
+
+  // Host 侧驻留字符串表：id -> 内容（由 BRIDGE_CMD_DEFINE_STRING 填充，跨帧保留）。
+  static std::vector<std::string> g_strings;
+
+  static void RememberString(const BridgeCmdDefineString& cmd)
+  {
+    if (cmd.id >= g_strings.size())
+    {
+      g_strings.resize(static_cast<size_t>(cmd.id) + 1);
+    }
+    if (g_strings[cmd.id].empty())
+    {
+      g_strings[cmd.id] = ReadUtf8(cmd.utf8);
+    }
+  }
+
+  static const std::string& LookupString(BridgeStringId id)
+  {
+    static const std::string empty;
+    return id < g_strings.size() ? g_strings[id] : empty;
+  }
+
+  static const char* FindOption(int argc, char** argv, const char* name)
+  {
+    for (int i = 1; i + 1 < argc; ++i)
+    {
+      if (std::strcmp(argv[i], name) == 0)
+      {
+        return argv[i + 1];
+      }
+    }
+    return nullptr;
+  }
+
+  // 按 BridgeCallCoreHeader + payload（8 字节补齐）的格式追加一条 Host->Core 调用。
+  template <class T>
+  static void AppendCall(std::vector<uint8_t>& out, uint32_t funcId, const T& payload)
+  {
+    BridgeCallCoreHeader hdr{};
+    hdr.func_id = funcId;
+    hdr.payload_size = static_cast<uint32_t>(sizeof(T));
+
+    const size_t offset = out.size();
+    out.resize(offset + sizeof(hdr) + ((sizeof(T) + 7u) & ~size_t{7}));
+    std::memcpy(out.data() + offset, &hdr, sizeof(hdr));
+    std::memcpy(out.data() + offset + sizeof(hdr), &payload, sizeof(T));
+  }
+
+  static void HandleLoadAsset(std::vector<uint8_t>& inbound, const demo_asset::HostArgs_LoadAsset& args, uint64_t& totalAssetRequests)
+  {
+    ++totalAssetRequests;
+    uint64_t handle = FakeHandleFromKey(LookupString(args.assetKey));
+
+    demo_asset::CoreArgs_AssetLoaded evt{};
+    evt.requestId = args.requestId;
+    evt.handle = handle;
+    evt.status = BRIDGE_ASSET_STATUS_OK;
+
+    AppendCall(inbound, static_cast<uint32_t>(demo_asset::CoreFuncId::AssetLoaded), evt);
+  }
+
+  // 收集每个 core 本帧的回推调用，并在帧末提交：
+  // - 默认：BridgeCore_PushCallsMany 一次提交（一次跨边界调用），下一帧 Tick 时分发。
+  // - concurrent：交给后台线程逐 core 推送，与下一帧的 Tick 并发进行（要求 BRIDGE_CORE_FLAG_CONCURRENT_CALLS）；
+  //   推送早于某个 core 的 Tick 则在该帧分发，否则顺延一帧。
+  // - acquire：逐 core 用 BridgeCore_AcquireCallBuffer 预留区域、写入后 BridgeCore_CommitCalls，下一帧 Tick 时分发。
+  class InboundCalls
+  {
+  public:
+    InboundCalls(std::vector<BridgeCore*>& cores, bool concurrent, bool acquire)
+      : cores_(cores), concurrent_(concurrent), acquire_(acquire), inbound_(cores.size()), inflight_(cores.size()), buffers_(cores.size())
+    {
+    }
+
+    ~InboundCalls() { Join(); }
+
+    std::vector<uint8_t>& operator[](size_t i) { return inbound_[i]; }
+
+    bool Flush()
+    {
+      if (acquire_)
+      {
+        bool ok = true;
+        for (size_t i = 0; i < cores_.size(); ++i)
+        {
+          std::vector<uint8_t>& bytes = inbound_[i];
+          if (bytes.empty())
+          {
+            continue;
+          }
+          void* region = nullptr;
+          const uint32_t len = static_cast<uint32_t>(bytes.size());
+          if (BridgeCore_AcquireCallBuffer(cores_[i], len, &region) != BRIDGE_OK)
+          {
+            ok = false;
+            continue;
+          }
+          std::memcpy(region, bytes.data(), len);
+          ok = BridgeCore_CommitCalls(cores_[i], len) == BRIDGE_OK && ok;
+          bytes.clear();
+        }
+        return ok;
+      }
+
+      if (!concurrent_)
+      {
+        for (size_t i = 0; i < cores_.size(); ++i)
+        {
+          buffers_[i].ptr = inbound_[i].data();
+          buffers_[i].len = static_cast<uint32_t>(inbound_[i].size());
+        }
+        const BridgeResult result = BridgeCore_PushCallsMany(cores_.data(), buffers_.data(), static_cast<uint32_t>(cores_.size()));
+        for (auto& bytes : inbound_)
+        {
+          bytes.clear();
+        }
+        return result == BRIDGE_OK;
+      }
+
+      if (!Join())
+      {
+        return false;
+      }
+      inflight_.swap(inbound_);
+      for (auto& bytes : inbound_)
+      {
+        bytes.clear();
+      }
+      producer_ = std::thread([this]() {
+        for (size_t i = 0; i < cores_.size(); ++i)
+        {
+          if (BridgeCore_PushCallsCore(cores_[i], inflight_[i].data(), static_cast<uint32_t>(inflight_[i].size())) != BRIDGE_OK)
+          {
+            failed_ = true;
+          }
+        }
+      });
+      return true;
+    }
+
+    bool Join()
+    {
+      if (producer_.joinable())
+      {
+        producer_.join();
+      }
+      return !failed_;
+    }
+
+  private:
+    std::vector<BridgeCore*>& cores_;
+    bool concurrent_;
+    bool acquire_;
+    std::vector<std::vector<uint8_t>> inbound_;
+    std::vector<std::vector<uint8_t>> inflight_;
+    std::vector<BridgeCallBuffer> buffers_;
+    std::thread producer_;
+    bool failed_ = false;
+  };
+
+  // 稠密 opcode 握手：native 库的 opcode 表必须与本程序编译时生成的表逐项一致。
+  static bool HostOpcodesMatch()
+  {
+    const BridgeHostOpcode* entries = nullptr;
+    uint32_t count = 0;
+    if (Bridge_GetHostOpcodes(&entries, &count) != BRIDGE_OK || count != bridge::kGeneratedHostOpcodes.size())
+    {
+      return false;
+    }
+    for (uint32_t i = 0; i < count; ++i)
+    {
+      const BridgeHostOpcode& expected = bridge::kGeneratedHostOpcodes[i];
+      if (entries[i].opcode != expected.opcode || entries[i].func_id != expected.func_id)
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // 机器人 Host：只处理 LoadAsset（回执 AssetLoaded）与字符串宣告，其它调用由生成的分发器跳过。
+  struct RobotHost
   {
-    const uint8_t* p = nullptr;
-    const uint8_t* end = nullptr;
+    std::vector<uint8_t>& inbound;
+    uint64_t& totalAssetRequests;
+
+    void LoadAsset(const demo_asset::HostArgs_LoadAsset& args)
+    {
+      HandleLoadAsset(inbound, args, totalAssetRequests);
+    }
+
+    void DefineString(const BridgeCmdDefineString& cmd)
+    {
+      RememberString(cmd);
+    }
   };
 
-  static bool Next(CommandCursor& cur, const BridgeCommandHeader*& outHeader)
+  // --shared-assets：打印缓存计数并核对 Host 只收到一次启动资源请求（--clone 时一次也没有）。
+  // expectedFannedOut >= 0 时还核对转给其它 core 的结果条数（每个 core 都已跑过请求与回执的帧时）。
+  static bool CheckAssetCache(BridgeAssetCache* cache, uint64_t totalAssetRequests, bool clone, long long expectedFannedOut)
   {
-    if (!cur.p || cur.p >= cur.end)
+    BridgeAssetCacheStats s{};
+    if (BridgeAssetCache_GetStats(cache, &s) != BRIDGE_OK)
     {
+      std::printf("shared assets: stats query failed\n");
       return false;
     }
-    if (static_cast<size_t>(cur.end - cur.p) < sizeof(BridgeCommandHeader))
+    std::printf("shared assets: requests=%llu host_requests=%llu attached=%llu hits=%llu fanned_out=%llu entries=%u\n",
+      static_cast<unsigned long long>(s.requests), static_cast<unsigned long long>(s.host_requests),
+      static_cast<unsigned long long>(s.attached), static_cast<unsigned long long>(s.hits),
+      static_cast<unsigned long long>(s.fanned_out), s.entries);
+
+    if (totalAssetRequests != s.host_requests || totalAssetRequests != (clone ? 0u : 1u))
     {
+      std::printf("shared assets: host saw %llu asset requests\n", static_cast<unsigned long long>(totalAssetRequests));
       return false;
     }
-    const auto* header = reinterpret_cast<const BridgeCommandHeader*>(cur.p);
-    if (header->size < sizeof(BridgeCommandHeader) ||
-        static_cast<size_t>(cur.end - cur.p) < header->size)
+    if (expectedFannedOut >= 0 && s.fanned_out != static_cast<uint64_t>(expectedFannedOut) && !clone)
     {
+      std::printf("shared assets: expected %lld fanned-out results\n", expectedFannedOut);
       return false;
     }
-    outHeader = header;
-    cur.p += header->size;
     return true;
   }
 
-  static std::string ReadUtf8(BridgeStringView view)
+  static BridgeAssetCacheConfig AssetCacheConfig()
   {
-    const char* p = reinterpret_cast<const char*>(static_cast<uintptr_t>(view.ptr));
-    if (!p || view.len == 0)
+    BridgeAssetCacheConfig config{};
+    config.loaded_func_id = static_cast<uint32_t>(demo_asset::CoreFuncId::AssetLoaded);
+    config.payload_size = static_cast<uint32_t>(sizeof(demo_asset::CoreArgs_AssetLoaded));
+    config.status_offset = static_cast<uint32_t>(offsetof(demo_asset::CoreArgs_AssetLoaded, status));
+    return config;
+  }
+
+  // 按脚本回执的 Host：LoadAsset 一律回执 status（不带 handle），并按顺序记下 core 输出的日志级别。
+  struct ScriptedHost
+  {
+    ScriptedHost(std::vector<uint8_t>& inbound_, BridgeAssetStatus status_) : inbound(inbound_), status(status_) {}
+
+    std::vector<uint8_t>& inbound;
+    BridgeAssetStatus status;
+    uint64_t requests = 0;
+    uint64_t errors = 0;
+    uint64_t lastRequestId = 0;
+    std::vector<BridgeLogLevel> levels;
+
+    void LoadAsset(const demo_asset::HostArgs_LoadAsset& args)
     {
-      return std::string();
+      ++requests;
+      lastRequestId = args.requestId;
+      demo_asset::CoreArgs_AssetLoaded evt{};
+      evt.requestId = args.requestId;
+      evt.status = status;
+      AppendCall(inbound, static_cast<uint32_t>(demo_asset::CoreFuncId::AssetLoaded), evt);
     }
-    return std::string(p, p + view.len);
+
+    void Log(const demo_log::HostArgs_Log& args)
+    {
+      errors += args.level == BRIDGE_LOG_ERROR ? 1 : 0;
+      levels.push_back(args.level);
+    }
+
+    void DefineString(const BridgeCmdDefineString& cmd)
+    {
+      RememberString(cmd);
+    }
+  };
+
+  // 推送 inbound 后 Tick 一次 core，stream 交给 host。
+  static bool TickWith(BridgeCore* core, std::vector<uint8_t>& inbound, ScriptedHost& host, float dt)
+  {
+    const void* bytes = nullptr;
+    uint32_t len = 0;
+    if (BridgeCore_PushCallsCore(core, inbound.data(), static_cast<uint32_t>(inbound.size())) != BRIDGE_OK ||
+        BridgeCore_TickAndGetCommandStream(core, dt, &bytes, &len) != BRIDGE_OK)
+    {
+      return false;
+    }
+    inbound.clear();
+    bridge::DispatchFast(bytes, len, host);
+    BridgeCore_ReleaseStream(core);
+    return true;
   }
 
-  static uint64_t FakeHandleFromKey(const std::string& key)
+  static bool ExpectCacheState(BridgeAssetCache* cache, const char* step, uint64_t hostRequests, uint64_t fannedOut, uint32_t entries)
   {
-    // Simple FNV-1a 64-bit
-    uint64_t hash = 1469598103934665603ull;
-    for (unsigned char c : key)
+    BridgeAssetCacheStats s{};
+    if (BridgeAssetCache_GetStats(cache, &s) != BRIDGE_OK || s.host_requests != hostRequests || s.fanned_out != fannedOut ||
+        s.entries != entries)
     {
-      hash ^= static_cast<uint64_t>(c);
-      hash *= 1099511628211ull;
+      std::printf("shared assets: %s: host_requests=%llu fanned_out=%llu entries=%u, expected %llu/%llu/%u\n", step,
+        static_cast<unsigned long long>(s.host_requests), static_cast<unsigned long long>(s.fanned_out), s.entries,
+        static_cast<unsigned long long>(hostRequests), static_cast<unsigned long long>(fannedOut), entries);
+      return false;
     }
-    return hash ? hash : 1ull;
+    return true;
+  }
+
+  // --shared-assets：在一个新缓存上核对失败路径。
+  // - 回执失败（NOT_FOUND）：转给挂着的 core 后 key 移出缓存，下一个请求重新发给 Host；
+  // - 发出请求的 core 在回执前销毁：挂着的 core 收到 ERROR，并在下一帧重新请求。
+  static bool CheckAssetFailures(const BridgeCoreConfig& config, float dt)
+  {
+    BridgeAssetCacheConfig invalid = AssetCacheConfig();
+    invalid.status_offset = invalid.payload_size;
+    if (BridgeAssetCache* rejected = BridgeAssetCache_Create(invalid))
+    {
+      BridgeAssetCache_Destroy(rejected);
+      std::printf("shared assets: invalid config was accepted\n");
+      return false;
+    }
+
+    BridgeAssetCache* cache = BridgeAssetCache_Create(AssetCacheConfig());
+    BridgeCore* cores[4] = {};
+    for (BridgeCore*& core : cores)
+    {
+      core = BridgeCore_Create(config);
+    }
+    bool ok = cache && BridgeCore_SetAssetCache(cores, 4, cache) == BRIDGE_OK;
+
+    std::vector<uint8_t> inbound;
+    std::vector<uint8_t> none;
+    ScriptedHost host{inbound, BRIDGE_ASSET_STATUS_NOT_FOUND};
+
+    // core 0 请求、core 1 挂在上面；NOT_FOUND 转给 core 1 后不再缓存。
+    ok = ok && TickWith(cores[0], none, host, dt) && TickWith(cores[1], none, host, dt);
+    ok = ok && TickWith(cores[0], inbound, host, dt) && TickWith(cores[1], none, host, dt);
+    ok = ok && host.errors == 2 && ExpectCacheState(cache, "not found", 1, 1, 0);
+
+    // core 2 重新向 Host 请求、core 3 挂在上面；core 2 在回执前销毁，core 3 收到 ERROR 后重新请求。
+    ok = ok && TickWith(cores[2], none, host, dt) && TickWith(cores[3], none, host, dt);
+    ok = ok && host.requests == 2 && ExpectCacheState(cache, "re-request", 2, 1, 1);
+    inbound.clear();
+    BridgeCore_Destroy(cores[2]);
+    cores[2] = nullptr;
+    ok = ok && TickWith(cores[3], none, host, dt) && TickWith(cores[3], none, host, dt);
+    ok = ok && host.errors == 3 && host.requests == 3 && ExpectCacheState(cache, "abandoned", 3, 2, 1);
+
+    std::printf("shared assets: failure paths host_requests=%llu errors=%llu %s\n",
+      static_cast<unsigned long long>(host.requests), static_cast<unsigned long long>(host.errors), ok ? "ok" : "FAILED");
+
+    for (BridgeCore* core : cores)
+    {
+      BridgeCore_Destroy(core);
+    }
+    BridgeAssetCache_Destroy(cache);
+    return ok;
+  }
+
+  // --shared-assets：缓存转来的结果排在同一帧 Host 推送的调用之前分发。
+  // core 1 挂在 core 0 的请求上；结果（OK）到达后的那一帧，Host 再给 core 1 推一条同一 request id 的 NOT_FOUND
+  // （新建的 core 分配的第一个 request id 相同）。按顺序分发时 core 1 先记录“加载完成”（INFO），再记录失败（ERROR）。
+  static bool CheckAssetDeliveryOrder(const BridgeCoreConfig& config, float dt)
+  {
+    BridgeAssetCache* cache = BridgeAssetCache_Create(AssetCacheConfig());
+    BridgeCore* cores[2] = {BridgeCore_Create(config), BridgeCore_Create(config)};
+    bool ok = cache && BridgeCore_SetAssetCache(cores, 2, cache) == BRIDGE_OK;
+
+    std::vector<uint8_t> inbound;
+    std::vector<uint8_t> none;
+    ScriptedHost host{inbound, BRIDGE_ASSET_STATUS_OK};
+    ok = ok && TickWith(cores[0], none, host, dt) && TickWith(cores[1], none, host, dt);
+    ok = ok && TickWith(cores[0], inbound, host, dt) && ExpectCacheState(cache, "order", 1, 0, 1);
+
+    std::vector<uint8_t> pushed;
+    demo_asset::CoreArgs_AssetLoaded evt{};
+    evt.requestId = host.lastRequestId;
+    evt.status = BRIDGE_ASSET_STATUS_NOT_FOUND;
+    AppendCall(pushed, static_cast<uint32_t>(demo_asset::CoreFuncId::AssetLoaded), evt);
+
+    host.levels.clear();
+    ok = ok && TickWith(cores[1], pushed, host, dt) && ExpectCacheState(cache, "order", 1, 1, 1);
+    const bool ordered = host.levels.size() == 2 && host.levels[0] == BRIDGE_LOG_INFO && host.levels[1] == BRIDGE_LOG_ERROR;
+    std::printf("shared assets: delivery order %s\n", ordered ? "ok" : "FAILED (shared result was not dispatched first)");
+
+    for (BridgeCore* core : cores)
+    {
+      BridgeCore_Destroy(core);
+    }
+    BridgeAssetCache_Destroy(cache);
+    return ok && ordered;
+  }
+
+  // --acquire-calls：补齐到 8 字节后超出 uint32_t 的预留请求被拒绝，且不留下打开的区域。
+  static bool CheckAcquireBounds(BridgeCore* core)
+  {
+    bool ok = true;
+    for (uint32_t bytes : {UINT32_MAX, UINT32_MAX - 6u})
+    {
+      void* region = &region;
+      ok = BridgeCore_AcquireCallBuffer(core, bytes, &region) == BRIDGE_INVALID_ARGUMENT && region == nullptr && ok;
+    }
+
+    void* region = nullptr;
+    ok = ok && BridgeCore_AcquireCallBuffer(core, 16, &region) == BRIDGE_OK && region != nullptr;
+    ok = ok && BridgeCore_CommitCalls(core, 0) == BRIDGE_OK && BridgeCore_CommitCalls(core, 0) == BRIDGE_ERROR;
+    std::printf("acquire calls: oversized reservations %s\n", ok ? "rejected" : "FAILED");
+    return ok;
+  }
+
+  // 打印全部 core 的统计汇总；统计已编译时核对：stream 中的调用数（含 DEFINE_STRING）与本程序解析到的一致。
+  // 双缓冲模式结束时额外 Tick 了 core 0（见 main），因此不核对。
+  static bool PrintStats(std::vector<BridgeCore*>& cores, uint64_t totalCommands, bool doubleBuffer)
+  {
+    BridgeCoreStats total{};
+    const BridgeResult result = BridgeCore_GetStatsMany(cores.data(), static_cast<uint32_t>(cores.size()), nullptr, &total);
+    if (result == BRIDGE_ERROR)
+    {
+      std::printf("stats: not compiled in (BRIDGE_ENABLE_STATS=OFF)\n");
+      return true;
+    }
+    if (result != BRIDGE_OK)
+    {
+      std::printf("stats: query failed\n");
+      return false;
+    }
+
+    std::printf("stats: frames=%llu calls=%llu bytes=%llu strings_defined=%llu inbound_calls=%llu inbound_bytes=%llu\n",
+      static_cast<unsigned long long>(total.frames), static_cast<unsigned long long>(total.calls_emitted),
+      static_cast<unsigned long long>(total.bytes_emitted), static_cast<unsigned long long>(total.strings_defined),
+      static_cast<unsigned long long>(total.inbound_calls), static_cast<unsigned long long>(total.inbound_bytes));
+    std::printf("stats: peak_frame_bytes=%llu stream_reallocs=%llu call_buffer_reallocs=%llu stream_capacity=%llu max_tick_ns=%llu funcs=%llu\n",
+      static_cast<unsigned long long>(total.peak_frame_bytes), static_cast<unsigned long long>(total.stream_reallocs),
+      static_cast<unsigned long long>(total.call_buffer_reallocs), static_cast<unsigned long long>(total.stream_capacity_bytes),
+      static_cast<unsigned long long>(total.max_tick_ns), static_cast<unsigned long long>(total.func_count));
+
+    if (!doubleBuffer && total.calls_emitted + total.strings_defined != totalCommands)
+    {
+      std::printf("stats: emitted calls do not match parsed commands\n");
+      return false;
+    }
+    return true;
+  }
+
+  // 导出追踪文件并粗略核对：每次 Tick 对应一个 Core::Tick zone（环形缓冲写满后较早的 zone 会被覆盖，因此只检查上限）。
+  static bool DumpTrace(const char* path, uint64_t ticks)
+  {
+    if (Bridge_TraceDump(path) != BRIDGE_OK)
+    {
+      std::printf("trace: dump to %s failed\n", path);
+      return false;
+    }
+
+    std::FILE* f = std::fopen(path, "rb");
+    if (!f)
+    {
+      std::printf("trace: cannot reopen %s\n", path);
+      return false;
+    }
+    std::string json;
+    char chunk[4096];
+    size_t n = 0;
+    while ((n = std::fread(chunk, 1, sizeof(chunk), f)) > 0)
+    {
+      json.append(chunk, n);
+    }
+    std::fclose(f);
+
+    const std::string marker = "{\"name\":\"Core::Tick\",\"ph\":\"E\"";
+    uint64_t zones = 0;
+    for (size_t pos = json.find(marker); pos != std::string::npos; pos = json.find(marker, pos + marker.size()))
+    {
+      zones++;
+    }
+
+    std::printf("trace: %s bytes=%zu tick_zones=%llu\n", path, json.size(), static_cast<unsigned long long>(zones));
+    if (zones == 0 || zones > ticks)
+    {
+      std::printf("trace: unexpected Core::Tick zone count\n");
+      return false;
+    }
+    return true;
+  }
+
+  // 解析一个 core 本帧的 stream，并把 LoadAsset 的 AssetLoaded 回执编码进 inbound；返回解析的调用数（批量命令按条目计）。
+  static uint64_t DispatchStream(std::vector<uint8_t>& inbound, const void* bytes, uint32_t len, uint64_t& totalAssetRequests)
+  {
+    RobotHost host{inbound, totalAssetRequests};
+    return bridge::DispatchFast(bytes, len, host);
+  }
+
+  // --clone：模板 core 走完启动流程（LoadAsset → AssetLoaded 回执 → Spawn），之后每帧只输出 SetPosition。
+  static BridgeCore* WarmTemplate(const BridgeCoreConfig& config, float dt)
+  {
+    BridgeCore* core = BridgeCore_Create(config);
+    if (!core)
+    {
+      return nullptr;
+    }
+
+    uint64_t assetRequests = 0;
+    std::vector<uint8_t> inbound;
+    for (int tick = 0; tick < 3; ++tick)
+    {
+      const void* bytes = nullptr;
+      uint32_t len = 0;
+      if (BridgeCore_PushCallsCore(core, inbound.data(), static_cast<uint32_t>(inbound.size())) != BRIDGE_OK ||
+          BridgeCore_TickAndGetCommandStream(core, dt, &bytes, &len) != BRIDGE_OK)
+      {
+        BridgeCore_Destroy(core);
+        return nullptr;
+      }
+      inbound.clear();
+      DispatchStream(inbound, bytes, len, assetRequests);
+      BridgeCore_ReleaseStream(core);
+    }
+    if (assetRequests != 1)
+    {
+      BridgeCore_Destroy(core);
+      return nullptr;
+    }
+    return core;
   }
 }
 
@@ -72,76 +562,366 @@ int main(int argc, char** argv)
   if (argc >= 3) frames = std::atoi(argv[2]);
   if (argc >= 4) dt = static_cast<float>(std::atof(argv[3]));
 
-  std::printf("robot_runner: bots=%d frames=%d dt=%f\n", bots, frames, dt);
+  // --workers N：开启 TickMany 并行模式（N 个 worker 线程 + 主线程）。
+  int workers = 0;
+  if (const char* w = FindOption(argc, argv, "--workers")) workers = std::atoi(w);
+
+  // --async：使用 TickManyBegin/PollCompletedShards（可与 --workers 组合）。
+  // --group：使用 BridgeCoreGroup（所有 core 的命令写入一个连续 arena；可与 --workers 组合）。
+  // --double-buffer：双缓冲 stream，Tick 第 N+1 帧之后再分发并归还第 N 帧（单 core 串行路径）。
+  // --concurrent-calls：回推调用由后台线程推送，与下一帧 Tick 并发（可与其它选项组合）。
+  // --acquire-calls：回推调用用 BridgeCore_AcquireCallBuffer/CommitCalls 就地写入（不能与 --concurrent-calls 同用）。
+  // --dense-opcodes：握手通过后以 v0.3 稠密 opcode 格式输出命令（可与其它选项组合）。
+  // --virtual-buffer：命令缓冲使用预留的虚拟地址空间，按需提交（可与其它选项组合）。
+  // --stats：结束时打印 BridgeCore_GetStatsMany 的汇总，并与本程序解析到的调用数核对（需 BRIDGE_ENABLE_STATS=ON）。
+  // --trace <path>：对所有 core 开启帧追踪，结束时导出 Chrome trace JSON 到 path。
+  // --record <path>：把 core 0 每帧的 dt、分发的调用与 command stream 录制到 path（用 bridge_replay 回放）。
+  // --record-from N：先串行跑 N 帧再开始录制（录制中途开始，计入总帧数；不能与 --budget-us 同用）。
+  // --clone：先预热一个模板 core，再用 BridgeCore_CloneMany 复制出所有 bot（跳过各自的启动往返）。
+  // --budget-us N：每帧只给 Tick N 微秒（BridgeTickScheduler，轮转补帧；串行，忽略 --workers/--group）。
+  // --shared-assets：所有 core 挂到一个 BridgeAssetCache，启动 Prefab 只向 Host 请求一次（可与其它选项组合）。
+  bool async = false;
+  bool useGroup = false;
+  bool doubleBuffer = false;
+  bool concurrentCalls = false;
+  bool acquireCalls = false;
+  bool denseOpcodes = false;
+  bool virtualBuffer = false;
+  bool stats = false;
+  bool clone = false;
+  bool sharedAssets = false;
+  for (int i = 4; i < argc; ++i)
+  {
+    if (std::strcmp(argv[i], "--async") == 0) async = true;
+    if (std::strcmp(argv[i], "--group") == 0) useGroup = true;
+    if (std::strcmp(argv[i], "--double-buffer") == 0) doubleBuffer = true;
+    if (std::strcmp(argv[i], "--concurrent-calls") == 0) concurrentCalls = true;
+    if (std::strcmp(argv[i], "--acquire-calls") == 0) acquireCalls = true;
+    if (std::strcmp(argv[i], "--dense-opcodes") == 0) denseOpcodes = true;
+    if (std::strcmp(argv[i], "--virtual-buffer") == 0) virtualBuffer = true;
+    if (std::strcmp(argv[i], "--stats") == 0) stats = true;
+    if (std::strcmp(argv[i], "--clone") == 0) clone = true;
+    if (std::strcmp(argv[i], "--shared-assets") == 0) sharedAssets = true;
+  }
+  const char* tracePath = FindOption(argc, argv, "--trace");
+  const char* recordPath = FindOption(argc, argv, "--record");
+  int recordFrom = 0;
+  if (const char* r = FindOption(argc, argv, "--record-from")) recordFrom = std::atoi(r);
+  long long budgetUs = -1;
+  if (const char* b = FindOption(argc, argv, "--budget-us")) budgetUs = std::atoll(b);
+
+  std::printf("robot_runner: bots=%d frames=%d dt=%f workers=%d async=%d group=%d double_buffer=%d concurrent_calls=%d acquire_calls=%d dense_opcodes=%d virtual_buffer=%d clone=%d shared_assets=%d budget_us=%lld\n",
+    bots, frames, dt, workers, async ? 1 : 0, useGroup ? 1 : 0, doubleBuffer ? 1 : 0, concurrentCalls ? 1 : 0, acquireCalls ? 1 : 0, denseOpcodes ? 1 : 0,
+    virtualBuffer ? 1 : 0, clone ? 1 : 0, sharedAssets ? 1 : 0, budgetUs);
+
+  if (acquireCalls && concurrentCalls)
+  {
+    std::printf("--acquire-calls cannot be combined with --concurrent-calls\n");
+    return 1;
+  }
+
+  if (budgetUs >= 0 && (async || doubleBuffer))
+  {
+    std::printf("--budget-us cannot be combined with --async or --double-buffer\n");
+    return 1;
+  }
 
-  std::vector<BridgeCore*> cores;
-  cores.reserve(static_cast<size_t>(bots));
+  if (recordFrom < 0 || recordFrom > frames || (recordFrom > 0 && (!recordPath || budgetUs >= 0)))
+  {
+    std::printf("invalid --record-from: %d\n", recordFrom);
+    return 1;
+  }
 
+  if (denseOpcodes && !HostOpcodesMatch())
+  {
+    std::printf("opcode handshake failed: native table differs from generated bindings\n");
+    return 1;
+  }
+
+  if (workers > 0 && BridgeCore_SetTickWorkerCount(static_cast<uint32_t>(workers)) != BRIDGE_OK)
+  {
+    std::printf("invalid --workers: %d\n", workers);
+    return 1;
+  }
+
+  // 所有 bot 一次创建在同一块 slab 上（BridgeCore_CreateMany）。
+  std::vector<BridgeCoreConfig> configs(static_cast<size_t>(bots));
   for (int i = 0; i < bots; ++i)
   {
-    BridgeCoreConfig cfg{};
+    BridgeCoreConfig& cfg = configs[static_cast<size_t>(i)];
     cfg.seed = static_cast<uint64_t>(i + 1);
     cfg.mode = BRIDGE_MODE_ROBOT;
-    cores.push_back(BridgeCore_Create(cfg));
+    cfg.flags = BRIDGE_CORE_FLAG_NONE;
+    if (doubleBuffer) cfg.flags |= BRIDGE_CORE_FLAG_DOUBLE_BUFFERED;
+    if (concurrentCalls) cfg.flags |= BRIDGE_CORE_FLAG_CONCURRENT_CALLS;
+    if (denseOpcodes) cfg.flags |= BRIDGE_CORE_FLAG_DENSE_OPCODES;
+    if (virtualBuffer) cfg.flags |= BRIDGE_CORE_FLAG_VIRTUAL_COMMAND_BUFFER;
+  }
+
+  std::vector<BridgeCore*> cores(static_cast<size_t>(bots));
+  if (clone && bots > 0)
+  {
+    BridgeCore* source = WarmTemplate(configs[0], dt);
+    if (!source)
+    {
+      std::printf("clone: warming up the template core failed\n");
+      return 1;
+    }
+
+    std::vector<uint64_t> seeds(static_cast<size_t>(bots));
+    for (int i = 0; i < bots; ++i)
+    {
+      seeds[static_cast<size_t>(i)] = configs[static_cast<size_t>(i)].seed;
+    }
+    const auto cloneStart = std::chrono::high_resolution_clock::now();
+    const BridgeResult result = BridgeCore_CloneMany(source, seeds.data(), static_cast<uint32_t>(bots), cores.data());
+    const std::chrono::duration<double, std::milli> cloneElapsed = std::chrono::high_resolution_clock::now() - cloneStart;
+    BridgeCore_Destroy(source);
+    if (result != BRIDGE_OK)
+    {
+      std::printf("BridgeCore_CloneMany failed\n");
+      return 1;
+    }
+    std::printf("clone: %d cores in %.3f ms\n", bots, cloneElapsed.count());
+  }
+  else if (bots > 0 && BridgeCore_CreateMany(configs.data(), static_cast<uint32_t>(bots), cores.data()) != BRIDGE_OK)
+  {
+    std::printf("BridgeCore_CreateMany failed\n");
+    return 1;
   }
 
+  if (tracePath && BridgeCore_SetTraceEnabledMany(cores.data(), static_cast<uint32_t>(cores.size()), 1) != BRIDGE_OK)
+  {
+    std::printf("enabling trace failed\n");
+    return 1;
+  }
+
+  BridgeAssetCache* assetCache = nullptr;
+  if (sharedAssets && !cores.empty())
+  {
+    assetCache = BridgeAssetCache_Create(AssetCacheConfig());
+    if (BridgeCore_SetAssetCache(cores.data(), static_cast<uint32_t>(cores.size()), assetCache) != BRIDGE_OK)
+    {
+      std::printf("attaching the asset cache failed\n");
+      return 1;
+    }
+  }
+
+  BridgeCoreGroup* group = useGroup ? BridgeCoreGroup_Create() : nullptr;
+
+  if (acquireCalls && !cores.empty() && !CheckAcquireBounds(cores[0]))
+  {
+    return 1;
+  }
+
+  InboundCalls inbound(cores, concurrentCalls, acquireCalls);
+
   const auto start = std::chrono::high_resolution_clock::now();
 
   uint64_t totalCommands = 0;
   uint64_t totalAssetRequests = 0;
+  uint64_t ticks = static_cast<uint64_t>(bots) * static_cast<uint64_t>(frames);
 
-  for (int frame = 0; frame < frames; ++frame)
+  // 中途开始录制：前 recordFrom 帧串行 Tick（core 0 在此期间驻留的字符串由录制补宣告）。
+  for (int frame = 0; frame < recordFrom; ++frame)
   {
-    for (BridgeCore* core : cores)
+    for (size_t i = 0; i < cores.size(); ++i)
     {
-      BridgeCore_Tick(core, dt);
+      BridgeCore_Tick(cores[i], dt);
 
       const void* bytes = nullptr;
       uint32_t len = 0;
-      BridgeCore_GetCommandStream(core, &bytes, &len);
+      BridgeCore_GetCommandStream(cores[i], &bytes, &len);
+
+      totalCommands += DispatchStream(inbound[i], bytes, len, totalAssetRequests);
+    }
+    if (!inbound.Flush())
+    {
+      std::printf("pushing inbound calls failed (frame %d)\n", frame);
+      return 1;
+    }
+  }
+  frames -= recordFrom;
+
+  if (recordPath && !cores.empty() && BridgeCore_BeginRecording(cores[0], recordPath) != BRIDGE_OK)
+  {
+    std::printf("cannot record to %s\n", recordPath);
+    return 1;
+  }
 
-      CommandCursor cur{};
-      cur.p = reinterpret_cast<const uint8_t*>(bytes);
-      cur.end = cur.p ? (cur.p + len) : nullptr;
+  if (budgetUs >= 0)
+  {
+    // 时间预算路径：每帧只 Tick 预算内轮到的 core，其余的累计 dt，之后的帧从游标处继续。
+    BridgeTickScheduler* scheduler = BridgeTickScheduler_Create();
+    std::vector<BridgeCommandStream> streams(cores.size());
+    std::vector<float> dts(cores.size());
+    std::vector<uint8_t> everTicked(cores.size(), 0);
+    uint64_t maxElapsedNs = 0;
+    float maxOwedDt = 0.0f;
+    ticks = 0;
+    for (int frame = 0; frame < frames && !cores.empty(); ++frame)
+    {
+      BridgeTickBudgetResult result{};
+      if (BridgeTickScheduler_TickManyAndGetCommandStreams(scheduler, cores.data(), static_cast<uint32_t>(cores.size()), dt,
+            static_cast<uint64_t>(budgetUs) * 1000u, streams.data(), dts.data(), &result) != BRIDGE_OK ||
+          result.count == 0 || result.count > cores.size())
+      {
+        std::printf("budget: tick failed (frame %d)\n", frame);
+        return 1;
+      }
+      ticks += result.count;
+      maxElapsedNs = std::max(maxElapsedNs, result.elapsed_ns);
+      for (uint32_t k = 0; k < result.count; ++k)
+      {
+        const size_t i = (result.first + k) % cores.size();
+        everTicked[i] = 1;
+        maxOwedDt = std::max(maxOwedDt, dts[i]);
+        totalCommands += DispatchStream(inbound[i], streams[i].ptr, streams[i].len, totalAssetRequests);
+      }
+      if (!inbound.Flush())
+      {
+        std::printf("pushing inbound calls failed (frame %d)\n", frame);
+        return 1;
+      }
+    }
+    BridgeTickScheduler_Destroy(scheduler);
+
+    uint64_t ticked = 0;
+    for (uint8_t t : everTicked)
+    {
+      ticked += t;
+    }
+    std::printf("budget: core_ticks=%llu cores_ticked=%llu max_elapsed_us=%.1f max_dt=%.4f\n",
+      static_cast<unsigned long long>(ticks), static_cast<unsigned long long>(ticked),
+      static_cast<double>(maxElapsedNs) / 1000.0, static_cast<double>(maxOwedDt));
 
-      uint64_t commandsThisCore = 0;
+    // 每个 core 第一次轮到时请求一次启动资源（--clone 时不再请求，--shared-assets 时只有第一个 core 请求）。
+    if (!clone && !sharedAssets && totalAssetRequests != ticked)
+    {
+      std::printf("budget: asset requests do not match the cores that were ticked\n");
+      return 1;
+    }
+  }
+  else if (async)
+  {
+    // 异步批量路径：Begin 后按 shard 取回，边 Tick 边解析。
+    std::vector<BridgeCommandStream> streams(cores.size());
+    BridgeTickShard shards[64];
+    for (int frame = 0; frame < frames; ++frame)
+    {
+      BridgeCore_TickManyBegin(cores.data(), static_cast<uint32_t>(cores.size()), dt, streams.data());
 
-      const BridgeCommandHeader* header = nullptr;
-      while (Next(cur, header))
+      uint32_t remaining = static_cast<uint32_t>(cores.size());
+      while (remaining > 0)
       {
-        ++commandsThisCore;
-        if (header->type == BRIDGE_CMD_CALL_HOST &&
-            header->size >= sizeof(BridgeCmdCallHost))
+        uint32_t shardCount = 0;
+        BridgeCore_PollCompletedShards(shards, 64, &shardCount, &remaining);
+        for (uint32_t s = 0; s < shardCount; ++s)
         {
-          const auto* cmd = reinterpret_cast<const BridgeCmdCallHost*>(header);
-          const uint32_t payload_bytes = static_cast<uint32_t>(header->size) - static_cast<uint32_t>(sizeof(BridgeCmdCallHost));
-          if (cmd->func_id == static_cast<uint32_t>(demo_asset::HostFuncId::LoadAsset) &&
-              payload_bytes >= sizeof(demo_asset::HostArgs_LoadAsset))
+          for (uint32_t i = shards[s].begin; i < shards[s].begin + shards[s].count; ++i)
           {
-            ++totalAssetRequests;
-            const uint8_t* payload = reinterpret_cast<const uint8_t*>(cmd) + sizeof(BridgeCmdCallHost);
-            const auto* args = reinterpret_cast<const demo_asset::HostArgs_LoadAsset*>(payload);
-
-            std::string key = ReadUtf8(args->assetKey);
-            uint64_t handle = FakeHandleFromKey(key);
-
-            demo_asset::CoreArgs_AssetLoaded evt{};
-            evt.requestId = args->requestId;
-            evt.handle = handle;
-            evt.status = BRIDGE_ASSET_STATUS_OK;
-
-            BridgeCore_PushCallCore(core,
-              static_cast<uint32_t>(demo_asset::CoreFuncId::AssetLoaded),
-              &evt,
-              static_cast<uint32_t>(sizeof(evt)));
+            totalCommands += DispatchStream(inbound[i], streams[i].ptr, streams[i].len, totalAssetRequests);
           }
         }
       }
+      if (!inbound.Flush())
+      {
+        std::printf("pushing inbound calls failed (frame %d)\n", frame);
+        return 1;
+      }
+    }
+  }
+  else if (workers > 0 || group)
+  {
+    // 批量路径：TickMany（worker 池并行 / group 连续 arena）后再在主线程统一解析。
+    std::vector<BridgeCommandStream> streams(cores.size());
+    for (int frame = 0; frame < frames; ++frame)
+    {
+      if (group)
+        BridgeCoreGroup_TickManyAndGetCommandStreams(group, cores.data(), static_cast<uint32_t>(cores.size()), dt, streams.data());
+      else
+        BridgeCore_TickManyAndGetCommandStreams(cores.data(), static_cast<uint32_t>(cores.size()), dt, streams.data());
+      for (size_t i = 0; i < cores.size(); ++i)
+      {
+        totalCommands += DispatchStream(inbound[i], streams[i].ptr, streams[i].len, totalAssetRequests);
+      }
+      if (!inbound.Flush())
+      {
+        std::printf("pushing inbound calls failed (frame %d)\n", frame);
+        return 1;
+      }
+    }
+  }
+  else if (doubleBuffer)
+  {
+    // 上一帧的 stream 在本帧 Tick 之后仍然有效：先 Tick 第 N+1 帧，再分发并归还第 N 帧。
+    std::vector<BridgeCommandStream> previous(cores.size());
+    for (int frame = 0; frame <= frames; ++frame)
+    {
+      for (size_t i = 0; i < cores.size(); ++i)
+      {
+        BridgeCommandStream current{};
+        if (frame < frames &&
+            BridgeCore_TickAndGetCommandStream(cores[i], dt, &current.ptr, &current.len) != BRIDGE_OK)
+        {
+          std::printf("double buffer: tick refused (core %zu, frame %d)\n", i, frame);
+          return 1;
+        }
+        if (frame > 0)
+        {
+          totalCommands += DispatchStream(inbound[i], previous[i].ptr, previous[i].len, totalAssetRequests);
+          BridgeCore_ReleaseStream(cores[i]);
+        }
+        previous[i] = current;
+      }
+      if (!inbound.Flush())
+      {
+        std::printf("pushing inbound calls failed (frame %d)\n", frame);
+        return 1;
+      }
+    }
+
+    // 两帧都未归还时，第三次 Tick 必须被拒绝（否则会覆盖 Host 仍在读取的 stream）。
+    if (!cores.empty())
+    {
+      BridgeCommandStream probe{};
+      BridgeCore_TickAndGetCommandStream(cores[0], dt, &probe.ptr, &probe.len);
+      BridgeCore_TickAndGetCommandStream(cores[0], dt, &probe.ptr, &probe.len);
+      if (BridgeCore_TickAndGetCommandStream(cores[0], dt, &probe.ptr, &probe.len) != BRIDGE_ERROR)
+      {
+        std::printf("double buffer: tick was not refused while both streams are held\n");
+        return 1;
+      }
+    }
+  }
+  else
+  {
+    for (int frame = 0; frame < frames; ++frame)
+    {
+      for (size_t i = 0; i < cores.size(); ++i)
+      {
+        BridgeCore_Tick(cores[i], dt);
+
+        const void* bytes = nullptr;
+        uint32_t len = 0;
+        BridgeCore_GetCommandStream(cores[i], &bytes, &len);
 
-      totalCommands += commandsThisCore;
+        totalCommands += DispatchStream(inbound[i], bytes, len, totalAssetRequests);
+      }
+      if (!inbound.Flush())
+      {
+        std::printf("pushing inbound calls failed (frame %d)\n", frame);
+        return 1;
+      }
     }
   }
 
+  if (!inbound.Join())
+  {
+    std::printf("pushing inbound calls failed\n");
+    return 1;
+  }
+
   const auto end = std::chrono::high_resolution_clock::now();
   const std::chrono::duration<double> elapsed = end - start;
 
@@ -150,13 +930,53 @@ int main(int argc, char** argv)
   if (elapsed.count() > 0.0)
     std::printf("commands/sec: %.0f\n", static_cast<double>(totalCommands) / elapsed.count());
   std::printf("total asset requests: %llu\n", static_cast<unsigned long long>(totalAssetRequests));
-  std::printf("ticks: %llu\n",
-    static_cast<unsigned long long>(static_cast<uint64_t>(bots) * static_cast<uint64_t>(frames)));
+  std::printf("ticks: %llu\n", static_cast<unsigned long long>(ticks));
+
+  // 副本继承了模板已完成的启动流程，不应再请求资源。
+  if (clone && totalAssetRequests != 0)
+  {
+    std::printf("clone: cloned cores requested assets again\n");
+    return 1;
+  }
+
+  if (assetCache && !CheckAssetCache(assetCache, totalAssetRequests, clone, budgetUs >= 0 || frames + recordFrom < 3 ? -1 : bots - 1))
+  {
+    return 1;
+  }
+
+  if (assetCache && (!CheckAssetFailures(configs[0], dt) || !CheckAssetDeliveryOrder(configs[0], dt)))
+  {
+    return 1;
+  }
+
+  if (stats && !PrintStats(cores, totalCommands, doubleBuffer))
+  {
+    return 1;
+  }
+
+  // 双缓冲模式结束时额外 Tick 了 core 0（见上），上限按多 3 次计。
+  if (tracePath && !DumpTrace(tracePath, ticks + (doubleBuffer ? 3 : 0)))
+  {
+    return 1;
+  }
+
+  if (recordPath && !cores.empty())
+  {
+    if (BridgeCore_EndRecording(cores[0]) != BRIDGE_OK)
+    {
+      std::printf("recording to %s failed\n", recordPath);
+      return 1;
+    }
+    std::printf("recorded core 0 to %s\n", recordPath);
+  }
 
   for (BridgeCore* core : cores)
   {
     BridgeCore_Destroy(core);
   }
+  BridgeCoreGroup_Destroy(group);
+  BridgeAssetCache_Destroy(assetCache);
+  BridgeCore_SetTickWorkerCount(0);
 
   return 0;
 }
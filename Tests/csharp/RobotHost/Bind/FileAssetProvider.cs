@@ -5,7 +5,7 @@ sealed class FileAssetProvider
 {
     private readonly string _root;
     private readonly Dictionary<string, ulong> _handleCache = new(StringComparer.Ordinal);
-    private readonly Dictionary<ulong, ulong> _handleCacheByKeyHash = new();
+    private readonly Dictionary<uint, ulong> _handleCacheById = new();
 
     public FileAssetProvider(string root)
     {
@@ -33,17 +33,16 @@ sealed class FileAssetProvider
         return true;
     }
 
-    public bool TryGetHandle(BridgeStringView assetKey, out ulong handle)
+    public bool TryGetHandle(BridgeStringId assetKey, out ulong handle)
     {
-        ulong keyHash = assetKey.Fnv1a64();
-        if (keyHash != 0 && _handleCacheByKeyHash.TryGetValue(keyHash, out handle))
+        if (_handleCacheById.TryGetValue(assetKey.Value, out handle))
             return handle != 0;
 
         string key = assetKey.ToManagedString();
         bool ok = TryGetHandle(key, out handle);
 
-        if (keyHash != 0)
-            _handleCacheByKeyHash[keyHash] = ok ? handle : 0;
+        if (!assetKey.IsEmpty)
+            _handleCacheById[assetKey.Value] = ok ? handle : 0;
 
         return ok;
     }
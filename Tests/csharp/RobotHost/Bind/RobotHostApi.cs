@@ -4,7 +4,8 @@ using DemoAsset.Bindings;
 
 sealed class RobotHostApi : BridgeAllHostApiBase, IRobotHostApi
 {
-    private readonly BridgeCore _core;
+    // AssetLoaded 回执先写入 inbound，由 Program 每帧用 BridgeCore.PushCallsMany 统一提交。
+    private readonly BridgeCallWriter _inbound;
     private readonly WorldState _world;
     private readonly FileAssetProvider _assets;
 
@@ -15,9 +16,9 @@ sealed class RobotHostApi : BridgeAllHostApiBase, IRobotHostApi
     public ulong Transforms { get; private set; }
     public ulong Destroys { get; private set; }
 
-    public RobotHostApi(BridgeCore core, WorldState world, FileAssetProvider assets)
+    public RobotHostApi(BridgeCallWriter inbound, WorldState world, FileAssetProvider assets)
     {
-        _core = core;
+        _inbound = inbound;
         _world = world;
         _assets = assets;
     }
@@ -29,7 +30,7 @@ sealed class RobotHostApi : BridgeAllHostApiBase, IRobotHostApi
         _world.OnLog(level, message);
     }
 
-    public override void LoadAsset(ulong requestId, BridgeAssetType assetType, BridgeStringView assetKey)
+    public override void LoadAsset(ulong requestId, BridgeAssetType assetType, BridgeStringId assetKey)
     {
         _ = assetType;
 
@@ -37,9 +38,9 @@ sealed class RobotHostApi : BridgeAllHostApiBase, IRobotHostApi
         AssetRequests++;
 
         if (_assets.TryGetHandle(assetKey, out ulong handle))
-            _core.AssetLoaded(requestId, handle, BridgeAssetStatus.Ok);
+            _inbound.AssetLoaded(requestId, handle, BridgeAssetStatus.Ok);
         else
-            _core.AssetLoaded(requestId, 0, BridgeAssetStatus.NotFound);
+            _inbound.AssetLoaded(requestId, 0, BridgeAssetStatus.NotFound);
     }
 
     public override void SpawnEntity(ulong entityId, ulong prefabHandle, in BridgeTransform transform, uint flags)
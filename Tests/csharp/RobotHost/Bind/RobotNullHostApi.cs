@@ -4,7 +4,8 @@ using DemoAsset.Bindings;
 
 sealed class RobotNullHostApi : BridgeAllHostApiBase, IRobotHostApi
 {
-    private readonly BridgeCore _core;
+    // AssetLoaded 回执先写入 inbound，由 Program 每帧用 BridgeCore.PushCallsMany 统一提交。
+    private readonly BridgeCallWriter _inbound;
 
     public ulong Commands { get; private set; }
     public ulong AssetRequests { get; private set; }
@@ -13,9 +14,9 @@ sealed class RobotNullHostApi : BridgeAllHostApiBase, IRobotHostApi
     public ulong Transforms { get; private set; }
     public ulong Destroys { get; private set; }
 
-    public RobotNullHostApi(BridgeCore core, FileAssetProvider assets)
+    public RobotNullHostApi(BridgeCallWriter inbound, FileAssetProvider assets)
     {
-        _core = core;
+        _inbound = inbound;
         _ = assets;
     }
 
@@ -27,17 +28,17 @@ sealed class RobotNullHostApi : BridgeAllHostApiBase, IRobotHostApi
         Logs++;
     }
 
-    public override void LoadAsset(ulong requestId, BridgeAssetType assetType, BridgeStringView assetKey)
+    public override void LoadAsset(ulong requestId, BridgeAssetType assetType, BridgeStringId assetKey)
     {
         _ = assetType;
 
         Commands++;
         AssetRequests++;
 
-        ulong handle = assetKey.Fnv1a64();
+        ulong handle = assetKey.Value;
         if (handle == 0)
             handle = 1;
-        _core.AssetLoaded(requestId, handle, BridgeAssetStatus.Ok);
+        _inbound.AssetLoaded(requestId, handle, BridgeAssetStatus.Ok);
     }
 
     public override void SpawnEntity(ulong entityId, ulong prefabHandle, in BridgeTransform transform, uint flags)
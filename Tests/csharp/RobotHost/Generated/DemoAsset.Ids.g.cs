@@ -13,4 +13,9 @@ namespace DemoAsset.Bindings
     {
         AssetLoaded = 0x2442BC8Au,
     }
+
+    public enum HostOpcode : ushort
+    {
+        LoadAsset = 0x0100,
+    }
 }
@@ -69,11 +69,41 @@ static class Program
 
         bool nullHost = string.Equals(hostMode, "null", StringComparison.OrdinalIgnoreCase);
 
+        // --dense-opcodes：与 native 库握手通过后，以稠密 opcode 格式输出命令。
+        var flags = BridgeCoreFlags.None;
+        if (Array.Exists(args, a => string.Equals(a, "--dense-opcodes", StringComparison.OrdinalIgnoreCase)))
+        {
+            if (!BridgeAllCommandDispatcher.VerifyHostOpcodes())
+            {
+                Console.WriteLine("opcode handshake failed: native table differs from generated bindings");
+                return 1;
+            }
+            flags |= BridgeCoreFlags.DenseOpcodes;
+        }
+
+        // --virtual-buffer：命令缓冲使用预留的虚拟地址空间（增长时不搬移）。
+        if (Array.Exists(args, a => string.Equals(a, "--virtual-buffer", StringComparison.OrdinalIgnoreCase)))
+            flags |= BridgeCoreFlags.VirtualCommandBuffer;
+
+        // --replay <path>：只回放 Host——把录制的每帧 command stream 交给本程序的分发器，不运行 Core。
+        string? replayPath = FindOption(args, "--replay");
+        if (replayPath != null)
+        {
+            Console.WriteLine($"RobotHost: replay={replayPath}");
+            Console.WriteLine($"hostMode: {(nullHost ? "null" : "full")}");
+            PrintRun("replay", Replay(replayPath, assetsRoot, nullHost));
+            return 0;
+        }
+
+        // --record <path>：把 core 0 的每帧输入/输出录制到 path（可用 --replay 或 bridge_replay 回放）。
+        string? recordPath = FindOption(args, "--record");
+
         Console.WriteLine($"RobotHost: bots={bots} frames={frames} dt={dt}");
         Console.WriteLine($"assetsRoot: {assetsRoot}");
         Console.WriteLine($"hostMode: {(nullHost ? "null" : "full")}");
+        Console.WriteLine($"flags: {flags}");
 
-        var r = Run(bots, frames, dt, assetsRoot, nullHost: nullHost);
+        var r = Run(bots, frames, dt, assetsRoot, nullHost: nullHost, flags, recordPath);
         PrintRun("all", r);
 
         return 0;
@@ -89,25 +119,41 @@ static class Program
         return null;
     }
 
-    private static RunResult Run(int bots, int frames, float dt, string assetsRoot, bool nullHost)
+    // 本帧所有 bot 的回推调用一次跨边界提交，然后清空以便下一帧复用。
+    private static void FlushInbound(IntPtr[] coreHandles, BridgeCallWriter[] inbound)
+    {
+        BridgeCore.PushCallsMany(coreHandles, inbound);
+        for (int i = 0; i < inbound.Length; i++)
+            inbound[i].Clear();
+    }
+
+    private static RunResult Run(int bots, int frames, float dt, string assetsRoot, bool nullHost, BridgeCoreFlags flags, string? recordPath)
     {
         var assetProvider = new FileAssetProvider(assetsRoot);
         _ = assetProvider.TryGetHandle("Main/Prefabs/Bot", out _);
 
-        var cores = new BridgeCore[bots];
+        // 所有 bot 一次创建在同一块 slab 上（BridgeCore_CreateMany）。
+        var configs = new BridgeCoreConfig[bots];
+        for (int i = 0; i < bots; i++)
+            configs[i] = BridgeCore.CreateConfig(seed: (ulong)(i + 1), robotMode: true, flags);
+        var cores = BridgeCore.CreateMany(configs);
         var coreHandles = new IntPtr[bots];
+        var inbound = new BridgeCallWriter[bots];
+        for (int i = 0; i < bots; i++)
+            inbound[i] = new BridgeCallWriter();
 
         if (nullHost)
         {
             var hosts = new RobotNullHostApi[bots];
             for (int i = 0; i < bots; i++)
             {
-                var core = new BridgeCore(seed: (ulong)(i + 1), robotMode: true);
-                cores[i] = core;
-                coreHandles[i] = core.UnsafeHandle;
-                hosts[i] = new RobotNullHostApi(core, assetProvider);
+                coreHandles[i] = cores[i].UnsafeHandle;
+                hosts[i] = new RobotNullHostApi(inbound[i], assetProvider);
             }
 
+            if (recordPath != null && bots > 0)
+                cores[0].BeginRecording(recordPath);
+
             var streams = new CommandStream[bots];
 
             BridgeCore.PrepareTickManyCache(bots);
@@ -119,6 +165,7 @@ static class Program
                 BridgeCore.TickManyAndGetCommandStreams(coreHandles, dt, streams);
                 for (int i = 0; i < cores.Length; i++)
                     BridgeAllCommandDispatcher.Dispatch(streams[i], hosts[i]);
+                FlushInbound(coreHandles, inbound);
             }
 
             ulong baseCommands = 0;
@@ -148,6 +195,7 @@ static class Program
                     BridgeCore.TickManyAndGetCommandStreams(coreHandles, dt, streams);
                     for (int i = 0; i < cores.Length; i++)
                         BridgeAllCommandDispatcher.Dispatch(streams[i], hosts[i]);
+                    FlushInbound(coreHandles, inbound);
                 }
             }
             finally
@@ -197,14 +245,15 @@ static class Program
             var hosts = new RobotHostApi[bots];
             for (int i = 0; i < bots; i++)
             {
-                var core = new BridgeCore(seed: (ulong)(i + 1), robotMode: true);
-                cores[i] = core;
-                coreHandles[i] = core.UnsafeHandle;
+                coreHandles[i] = cores[i].UnsafeHandle;
 
                 var world = new WorldState();
-                hosts[i] = new RobotHostApi(core, world, assetProvider);
+                hosts[i] = new RobotHostApi(inbound[i], world, assetProvider);
             }
 
+            if (recordPath != null && bots > 0)
+                cores[0].BeginRecording(recordPath);
+
             var streams = new CommandStream[bots];
 
             BridgeCore.PrepareTickManyCache(bots);
@@ -216,6 +265,7 @@ static class Program
                 BridgeCore.TickManyAndGetCommandStreams(coreHandles, dt, streams);
                 for (int i = 0; i < cores.Length; i++)
                     BridgeAllCommandDispatcher.Dispatch(streams[i], hosts[i]);
+                FlushInbound(coreHandles, inbound);
             }
 
             ulong baseCommands = 0;
@@ -245,6 +295,7 @@ static class Program
                     BridgeCore.TickManyAndGetCommandStreams(coreHandles, dt, streams);
                     for (int i = 0; i < cores.Length; i++)
                         BridgeAllCommandDispatcher.Dispatch(streams[i], hosts[i]);
+                    FlushInbound(coreHandles, inbound);
                 }
             }
             finally
@@ -291,6 +342,44 @@ static class Program
         }
     }
 
+    private static RunResult Replay(string path, string assetsRoot, bool nullHost)
+    {
+        var assetProvider = new FileAssetProvider(assetsRoot);
+        _ = assetProvider.TryGetHandle("Main/Prefabs/Bot", out _);
+
+        // 回推调用只是被编码，不会提交给任何 core：每帧清空。
+        var inbound = new BridgeCallWriter();
+        IRobotHostApi api = nullHost
+            ? new RobotNullHostApi(inbound, assetProvider)
+            : new RobotHostApi(inbound, new WorldState(), assetProvider);
+
+        using var recording = BridgeRecording.Open(path);
+        int frames = recording.FrameCount;
+        var streams = new CommandStream[frames];
+        for (int frame = 0; frame < frames; frame++)
+            streams[frame] = recording.GetFrame(frame).Stream;
+
+        long allocBefore = GC.GetAllocatedBytesForCurrentThread();
+        var sw = Stopwatch.StartNew();
+        for (int frame = 0; frame < frames; frame++)
+        {
+            BridgeAllCommandDispatcher.Dispatch(streams[frame], api);
+            inbound.Clear();
+        }
+        sw.Stop();
+        long allocAfter = GC.GetAllocatedBytesForCurrentThread();
+
+        return new RunResult(
+            elapsedSeconds: sw.Elapsed.TotalSeconds,
+            allocatedBytes: allocAfter - allocBefore,
+            totalCommands: api.Commands,
+            totalAssetRequests: api.AssetRequests,
+            totalLogs: api.Logs,
+            totalSpawns: api.Spawns,
+            totalTransforms: api.Transforms,
+            totalDestroys: api.Destroys);
+    }
+
     private static void PrintRun(string label, RunResult r)
     {
         Console.WriteLine($"[{label}] elapsed: {r.ElapsedSeconds:F3} s");
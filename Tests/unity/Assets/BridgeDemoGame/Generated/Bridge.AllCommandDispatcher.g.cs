@@ -12,22 +12,92 @@ namespace Bridge.Bindings
     public abstract class BridgeAllHostApiBase
         : DemoAsset.Bindings.IDemoAssetHostApi, DemoEntity.Bindings.IDemoEntityHostApi, DemoLog.Bindings.IDemoLogHostApi
     {
-        public abstract void LoadAsset(ulong requestId, BridgeAssetType assetType, BridgeStringView assetKey);
+        public abstract void LoadAsset(ulong requestId, BridgeAssetType assetType, BridgeStringId assetKey);
         public abstract void SpawnEntity(ulong entityId, ulong prefabHandle, in BridgeTransform transform, uint flags);
         public abstract void SetTransform(ulong entityId, uint mask, in BridgeTransform transform);
         public abstract void SetPosition(ulong entityId, BridgeVec3 position);
         public abstract void DestroyEntity(ulong entityId);
         public abstract void Log(BridgeLogLevel level, BridgeStringView message);
+
+        public virtual void LoadAssetBatch(HostCallBatch<DemoAsset.Bindings.HostArgs_LoadAsset> calls)
+        {
+            for (int i = 0; i < calls.Count; i++)
+            {
+                ref readonly DemoAsset.Bindings.HostArgs_LoadAsset a = ref calls[i];
+                LoadAsset(a.RequestId, a.AssetType, a.AssetKey);
+            }
+        }
+
+        public virtual void SpawnEntityBatch(HostCallBatch<DemoEntity.Bindings.HostArgs_SpawnEntity> calls)
+        {
+            for (int i = 0; i < calls.Count; i++)
+            {
+                ref readonly DemoEntity.Bindings.HostArgs_SpawnEntity a = ref calls[i];
+                SpawnEntity(a.EntityId, a.PrefabHandle, in a.Transform, a.Flags);
+            }
+        }
+
+        public virtual void SetTransformBatch(HostCallBatch<DemoEntity.Bindings.HostArgs_SetTransform> calls)
+        {
+            for (int i = 0; i < calls.Count; i++)
+            {
+                ref readonly DemoEntity.Bindings.HostArgs_SetTransform a = ref calls[i];
+                SetTransform(a.EntityId, a.Mask, in a.Transform);
+            }
+        }
+
+        public virtual void SetPositionBatch(HostCallBatch<DemoEntity.Bindings.HostArgs_SetPosition> calls)
+        {
+            for (int i = 0; i < calls.Count; i++)
+            {
+                ref readonly DemoEntity.Bindings.HostArgs_SetPosition a = ref calls[i];
+                SetPosition(a.EntityId, a.Position);
+            }
+        }
+
+        public virtual void DestroyEntityBatch(HostCallBatch<DemoEntity.Bindings.HostArgs_DestroyEntity> calls)
+        {
+            for (int i = 0; i < calls.Count; i++)
+            {
+                ref readonly DemoEntity.Bindings.HostArgs_DestroyEntity a = ref calls[i];
+                DestroyEntity(a.EntityId);
+            }
+        }
+
+        public virtual void LogBatch(HostCallBatch<DemoLog.Bindings.HostArgs_Log> calls)
+        {
+            for (int i = 0; i < calls.Count; i++)
+            {
+                ref readonly DemoLog.Bindings.HostArgs_Log a = ref calls[i];
+                Log(a.Level, a.Message);
+            }
+        }
     }
 
     /// <summary>
-    /// 单次扫描 command stream，并按 func_id 分发到各模块 Host API。
+    /// 单次扫描 command stream，并按 func_id（或稠密 opcode）分发到各模块 Host API。
     /// </summary>
     public static class BridgeAllCommandDispatcher
     {
-        public static unsafe void DispatchFast<THost>(CommandStream stream, THost host)
-            where THost : BridgeAllHostApiBase
-        {
+        // 本次生成分配的 Host opcode：下标 = opcode - BridgeCmdCallOp.OpcodeBase，值为对应 func_id。
+        private static readonly uint[] s_hostOpcodeFuncIds =
+        {
+            0x82A5E93Au, // DemoAsset.LoadAsset
+            0xBCAA331Du, // DemoEntity.SpawnEntity
+            0x20DA0B6Fu, // DemoEntity.SetTransform
+            0x5B16AE9Eu, // DemoEntity.SetPosition
+            0xC7C1C59Cu, // DemoEntity.DestroyEntity
+            0xDA3184A2u, // DemoLog.Log
+        };
+
+        /// <summary>
+        /// 与 native 库握手：opcode 表完全一致时返回 true，此时才可为 core 打开 <see cref="BridgeCoreFlags.DenseOpcodes"/>。
+        /// </summary>
+        public static bool VerifyHostOpcodes() => BridgeCore.MatchHostOpcodes(s_hostOpcodeFuncIds);
+
+        public static unsafe void DispatchFast<THost>(CommandStream stream, THost host)
+            where THost : BridgeAllHostApiBase
+        {
             if (host == null || stream.Ptr == System.IntPtr.Zero || stream.Length == 0)
                 return;
 
@@ -45,149 +115,325 @@ namespace Bridge.Bindings
                 if ((uint)size < (uint)sizeof(BridgeCommandHeader) || (uint)size > (uint)remaining)
                     break;
 
-                if (header->Type == (ushort)BridgeCommandType.CallHost && size >= sizeof(BridgeCmdCallHost))
-                {
-                    var cmd = (BridgeCmdCallHost*)cursor;
-                    uint payloadBytes = (uint)(size - sizeof(BridgeCmdCallHost));
-                    byte* payloadPtr = cursor + sizeof(BridgeCmdCallHost);
-
-                    switch (cmd->FuncId)
-                    {
-                        case 0x82A5E93Au:
-                        {
-                            if (payloadBytes >= (uint)sizeof(DemoAsset.Bindings.HostArgs_LoadAsset))
-                            {
-                                ref readonly DemoAsset.Bindings.HostArgs_LoadAsset a = ref *((DemoAsset.Bindings.HostArgs_LoadAsset*)payloadPtr);
-                                host.LoadAsset(a.RequestId, a.AssetType, a.AssetKey);
-                            }
-                            break;
-                        }
-                        case 0xBCAA331Du:
-                        {
-                            if (payloadBytes >= (uint)sizeof(DemoEntity.Bindings.HostArgs_SpawnEntity))
-                            {
-                                ref readonly DemoEntity.Bindings.HostArgs_SpawnEntity a = ref *((DemoEntity.Bindings.HostArgs_SpawnEntity*)payloadPtr);
-                                host.SpawnEntity(a.EntityId, a.PrefabHandle, in a.Transform, a.Flags);
-                            }
-                            break;
-                        }
-                        case 0x20DA0B6Fu:
-                        {
-                            if (payloadBytes >= (uint)sizeof(DemoEntity.Bindings.HostArgs_SetTransform))
-                            {
-                                ref readonly DemoEntity.Bindings.HostArgs_SetTransform a = ref *((DemoEntity.Bindings.HostArgs_SetTransform*)payloadPtr);
-                                host.SetTransform(a.EntityId, a.Mask, in a.Transform);
-                            }
-                            break;
-                        }
-                        case 0x5B16AE9Eu:
-                        {
-                            if (payloadBytes >= (uint)sizeof(DemoEntity.Bindings.HostArgs_SetPosition))
-                            {
-                                ref readonly DemoEntity.Bindings.HostArgs_SetPosition a = ref *((DemoEntity.Bindings.HostArgs_SetPosition*)payloadPtr);
-                                host.SetPosition(a.EntityId, a.Position);
-                            }
-                            break;
-                        }
-                        case 0xC7C1C59Cu:
-                        {
-                            if (payloadBytes >= (uint)sizeof(DemoEntity.Bindings.HostArgs_DestroyEntity))
-                            {
-                                ref readonly DemoEntity.Bindings.HostArgs_DestroyEntity a = ref *((DemoEntity.Bindings.HostArgs_DestroyEntity*)payloadPtr);
-                                host.DestroyEntity(a.EntityId);
-                            }
-                            break;
-                        }
-                        case 0xDA3184A2u:
-                        {
-                            if (payloadBytes >= (uint)sizeof(DemoLog.Bindings.HostArgs_Log))
-                            {
-                                ref readonly DemoLog.Bindings.HostArgs_Log a = ref *((DemoLog.Bindings.HostArgs_Log*)payloadPtr);
-                                host.Log(a.Level, a.Message);
-                            }
-                            break;
-                        }
-                    }
-                }
-
-                cursor += size;
-            }
-        }
-
-        public static unsafe void DispatchFastUnchecked<THost>(CommandStream stream, THost host)
-            where THost : BridgeAllHostApiBase
-        {
-            if (host == null || stream.Ptr == System.IntPtr.Zero || stream.Length == 0)
-                return;
-
-            byte* cursor = (byte*)stream.Ptr;
-            byte* end = cursor + (int)stream.Length;
-
-            while (cursor < end)
-            {
-                int remaining = (int)(end - cursor);
-                if (remaining < (int)sizeof(BridgeCmdCallHost))
-                    break;
-
-                var cmd = (BridgeCmdCallHost*)cursor;
-                int size = cmd->Header.Size;
-                if ((uint)size < (uint)sizeof(BridgeCmdCallHost) || (uint)size > (uint)remaining)
-                    break;
-
-                byte* payloadPtr = cursor + sizeof(BridgeCmdCallHost);
-
-                switch (cmd->FuncId)
-                {
-                    case 0x82A5E93Au:
-                    {
-                        ref readonly DemoAsset.Bindings.HostArgs_LoadAsset a = ref *((DemoAsset.Bindings.HostArgs_LoadAsset*)payloadPtr);
-                        host.LoadAsset(a.RequestId, a.AssetType, a.AssetKey);
-                        break;
-                    }
-                    case 0xBCAA331Du:
-                    {
-                        ref readonly DemoEntity.Bindings.HostArgs_SpawnEntity a = ref *((DemoEntity.Bindings.HostArgs_SpawnEntity*)payloadPtr);
-                        host.SpawnEntity(a.EntityId, a.PrefabHandle, in a.Transform, a.Flags);
-                        break;
-                    }
-                    case 0x20DA0B6Fu:
-                    {
-                        ref readonly DemoEntity.Bindings.HostArgs_SetTransform a = ref *((DemoEntity.Bindings.HostArgs_SetTransform*)payloadPtr);
-                        host.SetTransform(a.EntityId, a.Mask, in a.Transform);
-                        break;
-                    }
-                    case 0x5B16AE9Eu:
-                    {
-                        ref readonly DemoEntity.Bindings.HostArgs_SetPosition a = ref *((DemoEntity.Bindings.HostArgs_SetPosition*)payloadPtr);
-                        host.SetPosition(a.EntityId, a.Position);
-                        break;
-                    }
-                    case 0xC7C1C59Cu:
-                    {
-                        ref readonly DemoEntity.Bindings.HostArgs_DestroyEntity a = ref *((DemoEntity.Bindings.HostArgs_DestroyEntity*)payloadPtr);
-                        host.DestroyEntity(a.EntityId);
-                        break;
-                    }
-                    case 0xDA3184A2u:
-                    {
-                        ref readonly DemoLog.Bindings.HostArgs_Log a = ref *((DemoLog.Bindings.HostArgs_Log*)payloadPtr);
-                        host.Log(a.Level, a.Message);
-                        break;
-                    }
-                }
-
-                cursor += size;
-            }
-        }
-
-        public static unsafe void DispatchFastUnchecked(CommandStream stream, BridgeAllHostApiBase host)
-            => DispatchFastUnchecked<BridgeAllHostApiBase>(stream, host);
-
-        public static unsafe void DispatchFast(CommandStream stream, BridgeAllHostApiBase host)
-            => DispatchFast<BridgeAllHostApiBase>(stream, host);
-
-        public static unsafe void Dispatch<THost>(CommandStream stream, THost host)
-            where THost : class, DemoAsset.Bindings.IDemoAssetHostApi, DemoEntity.Bindings.IDemoEntityHostApi, DemoLog.Bindings.IDemoLogHostApi
+                if (header->Type >= BridgeCmdCallOp.OpcodeBase && size >= sizeof(BridgeCmdCallOp))
+                {
+                    DispatchOp(host, (BridgeCmdCallOp*)cursor, size - sizeof(BridgeCmdCallOp));
+                }
+                else if (header->Type == (ushort)BridgeCommandType.CallHost && size >= sizeof(BridgeCmdCallHost))
+                {
+                    var cmd = (BridgeCmdCallHost*)cursor;
+                    uint payloadBytes = (uint)(size - sizeof(BridgeCmdCallHost));
+                    byte* payloadPtr = cursor + sizeof(BridgeCmdCallHost);
+
+                    switch (cmd->FuncId)
+                    {
+                            case 0x82A5E93Au:
+                            {
+                                if (payloadBytes >= (uint)sizeof(DemoAsset.Bindings.HostArgs_LoadAsset))
+                                {
+                                    ref readonly DemoAsset.Bindings.HostArgs_LoadAsset a = ref *((DemoAsset.Bindings.HostArgs_LoadAsset*)payloadPtr);
+                                    host.LoadAsset(a.RequestId, a.AssetType, a.AssetKey);
+                                }
+                                break;
+                            }
+                            case 0xBCAA331Du:
+                            {
+                                if (payloadBytes >= (uint)sizeof(DemoEntity.Bindings.HostArgs_SpawnEntity))
+                                {
+                                    ref readonly DemoEntity.Bindings.HostArgs_SpawnEntity a = ref *((DemoEntity.Bindings.HostArgs_SpawnEntity*)payloadPtr);
+                                    host.SpawnEntity(a.EntityId, a.PrefabHandle, in a.Transform, a.Flags);
+                                }
+                                break;
+                            }
+                            case 0x20DA0B6Fu:
+                            {
+                                if (payloadBytes >= (uint)sizeof(DemoEntity.Bindings.HostArgs_SetTransform))
+                                {
+                                    ref readonly DemoEntity.Bindings.HostArgs_SetTransform a = ref *((DemoEntity.Bindings.HostArgs_SetTransform*)payloadPtr);
+                                    host.SetTransform(a.EntityId, a.Mask, in a.Transform);
+                                }
+                                break;
+                            }
+                            case 0x5B16AE9Eu:
+                            {
+                                if (payloadBytes >= (uint)sizeof(DemoEntity.Bindings.HostArgs_SetPosition))
+                                {
+                                    ref readonly DemoEntity.Bindings.HostArgs_SetPosition a = ref *((DemoEntity.Bindings.HostArgs_SetPosition*)payloadPtr);
+                                    host.SetPosition(a.EntityId, a.Position);
+                                }
+                                break;
+                            }
+                            case 0xC7C1C59Cu:
+                            {
+                                if (payloadBytes >= (uint)sizeof(DemoEntity.Bindings.HostArgs_DestroyEntity))
+                                {
+                                    ref readonly DemoEntity.Bindings.HostArgs_DestroyEntity a = ref *((DemoEntity.Bindings.HostArgs_DestroyEntity*)payloadPtr);
+                                    host.DestroyEntity(a.EntityId);
+                                }
+                                break;
+                            }
+                            case 0xDA3184A2u:
+                            {
+                                if (payloadBytes >= (uint)sizeof(DemoLog.Bindings.HostArgs_Log))
+                                {
+                                    ref readonly DemoLog.Bindings.HostArgs_Log a = ref *((DemoLog.Bindings.HostArgs_Log*)payloadPtr);
+                                    host.Log(a.Level, a.Message);
+                                }
+                                break;
+                            }
+                    }
+                }
+                else if (header->Type == (ushort)BridgeCommandType.DefineString && size >= sizeof(BridgeCmdDefineString))
+                {
+                    BridgeStringTable.Define(in *(BridgeCmdDefineString*)cursor);
+                }
+                else if (header->Type == (ushort)BridgeCommandType.CallHostBatch && size >= sizeof(BridgeCmdCallHostBatch))
+                {
+                    var batch = (BridgeCmdCallHostBatch*)cursor;
+                    if ((ulong)batch->Count * batch->Stride > (ulong)(size - sizeof(BridgeCmdCallHostBatch)))
+                        break;
+
+                    DispatchBatch(host, batch);
+                }
+
+                cursor += size;
+            }
+        }
+
+        public static unsafe void DispatchFastUnchecked<THost>(CommandStream stream, THost host)
+            where THost : BridgeAllHostApiBase
+        {
+            if (host == null || stream.Ptr == System.IntPtr.Zero || stream.Length == 0)
+                return;
+
+            byte* cursor = (byte*)stream.Ptr;
+            byte* end = cursor + (int)stream.Length;
+
+            while (cursor < end)
+            {
+                int remaining = (int)(end - cursor);
+                if (remaining < (int)sizeof(BridgeCmdCallHost))
+                    break;
+
+                var cmd = (BridgeCmdCallHost*)cursor;
+                int size = cmd->Header.Size;
+                if ((uint)size < (uint)sizeof(BridgeCmdCallHost) || (uint)size > (uint)remaining)
+                    break;
+
+                if (cmd->Header.Type >= BridgeCmdCallOp.OpcodeBase)
+                {
+                    DispatchOp(host, (BridgeCmdCallOp*)cursor, size - sizeof(BridgeCmdCallOp));
+                    cursor += size;
+                    continue;
+                }
+
+                if (cmd->Header.Type == (ushort)BridgeCommandType.DefineString)
+                {
+                    BridgeStringTable.Define(in *(BridgeCmdDefineString*)cursor);
+                    cursor += size;
+                    continue;
+                }
+
+                if (cmd->Header.Type == (ushort)BridgeCommandType.CallHostBatch)
+                {
+                    DispatchBatch(host, (BridgeCmdCallHostBatch*)cursor);
+                    cursor += size;
+                    continue;
+                }
+
+                byte* payloadPtr = cursor + sizeof(BridgeCmdCallHost);
+
+                switch (cmd->FuncId)
+                {
+                    case 0x82A5E93Au:
+                    {
+                        ref readonly DemoAsset.Bindings.HostArgs_LoadAsset a = ref *((DemoAsset.Bindings.HostArgs_LoadAsset*)payloadPtr);
+                        host.LoadAsset(a.RequestId, a.AssetType, a.AssetKey);
+                        break;
+                    }
+                    case 0xBCAA331Du:
+                    {
+                        ref readonly DemoEntity.Bindings.HostArgs_SpawnEntity a = ref *((DemoEntity.Bindings.HostArgs_SpawnEntity*)payloadPtr);
+                        host.SpawnEntity(a.EntityId, a.PrefabHandle, in a.Transform, a.Flags);
+                        break;
+                    }
+                    case 0x20DA0B6Fu:
+                    {
+                        ref readonly DemoEntity.Bindings.HostArgs_SetTransform a = ref *((DemoEntity.Bindings.HostArgs_SetTransform*)payloadPtr);
+                        host.SetTransform(a.EntityId, a.Mask, in a.Transform);
+                        break;
+                    }
+                    case 0x5B16AE9Eu:
+                    {
+                        ref readonly DemoEntity.Bindings.HostArgs_SetPosition a = ref *((DemoEntity.Bindings.HostArgs_SetPosition*)payloadPtr);
+                        host.SetPosition(a.EntityId, a.Position);
+                        break;
+                    }
+                    case 0xC7C1C59Cu:
+                    {
+                        ref readonly DemoEntity.Bindings.HostArgs_DestroyEntity a = ref *((DemoEntity.Bindings.HostArgs_DestroyEntity*)payloadPtr);
+                        host.DestroyEntity(a.EntityId);
+                        break;
+                    }
+                    case 0xDA3184A2u:
+                    {
+                        ref readonly DemoLog.Bindings.HostArgs_Log a = ref *((DemoLog.Bindings.HostArgs_Log*)payloadPtr);
+                        host.Log(a.Level, a.Message);
+                        break;
+                    }
+                }
+
+                cursor += size;
+            }
+        }
+
+        public static unsafe void DispatchFastUnchecked(CommandStream stream, BridgeAllHostApiBase host)
+            => DispatchFastUnchecked<BridgeAllHostApiBase>(stream, host);
+
+        public static unsafe void DispatchFast(CommandStream stream, BridgeAllHostApiBase host)
+            => DispatchFast<BridgeAllHostApiBase>(stream, host);
+
+        private static unsafe void DispatchBatch<THost>(THost host, BridgeCmdCallHostBatch* batch)
+            where THost : BridgeAllHostApiBase
+        {
+            byte* payloadPtr = (byte*)batch + sizeof(BridgeCmdCallHostBatch);
+            switch (batch->FuncId)
+            {
+                case 0x82A5E93Au:
+                    if (batch->Stride >= (uint)sizeof(DemoAsset.Bindings.HostArgs_LoadAsset))
+                        host.LoadAssetBatch(new HostCallBatch<DemoAsset.Bindings.HostArgs_LoadAsset>(payloadPtr, (int)batch->Count, (int)batch->Stride));
+                    break;
+                case 0xBCAA331Du:
+                    if (batch->Stride >= (uint)sizeof(DemoEntity.Bindings.HostArgs_SpawnEntity))
+                        host.SpawnEntityBatch(new HostCallBatch<DemoEntity.Bindings.HostArgs_SpawnEntity>(payloadPtr, (int)batch->Count, (int)batch->Stride));
+                    break;
+                case 0x20DA0B6Fu:
+                    if (batch->Stride >= (uint)sizeof(DemoEntity.Bindings.HostArgs_SetTransform))
+                        host.SetTransformBatch(new HostCallBatch<DemoEntity.Bindings.HostArgs_SetTransform>(payloadPtr, (int)batch->Count, (int)batch->Stride));
+                    break;
+                case 0x5B16AE9Eu:
+                    if (batch->Stride >= (uint)sizeof(DemoEntity.Bindings.HostArgs_SetPosition))
+                        host.SetPositionBatch(new HostCallBatch<DemoEntity.Bindings.HostArgs_SetPosition>(payloadPtr, (int)batch->Count, (int)batch->Stride));
+                    break;
+                case 0xC7C1C59Cu:
+                    if (batch->Stride >= (uint)sizeof(DemoEntity.Bindings.HostArgs_DestroyEntity))
+                        host.DestroyEntityBatch(new HostCallBatch<DemoEntity.Bindings.HostArgs_DestroyEntity>(payloadPtr, (int)batch->Count, (int)batch->Stride));
+                    break;
+                case 0xDA3184A2u:
+                    if (batch->Stride >= (uint)sizeof(DemoLog.Bindings.HostArgs_Log))
+                        host.LogBatch(new HostCallBatch<DemoLog.Bindings.HostArgs_Log>(payloadPtr, (int)batch->Count, (int)batch->Stride));
+                    break;
+            }
+        }
+
+        private static unsafe void DispatchOp<THost>(THost host, BridgeCmdCallOp* op, int payloadBytes)
+            where THost : BridgeAllHostApiBase
+        {
+            byte* payloadPtr = (byte*)op + sizeof(BridgeCmdCallOp);
+            int count = (int)op->Count;
+            switch (op->Header.Type)
+            {
+                case 0x0100:
+                {
+                    int stride = (sizeof(DemoAsset.Bindings.HostArgs_LoadAsset) + 7) & ~7;
+                    if (count <= 0 || (long)count * stride > payloadBytes)
+                        break;
+                    if (count == 1)
+                    {
+                        ref readonly DemoAsset.Bindings.HostArgs_LoadAsset a = ref *((DemoAsset.Bindings.HostArgs_LoadAsset*)payloadPtr);
+                        host.LoadAsset(a.RequestId, a.AssetType, a.AssetKey);
+                    }
+                    else
+                    {
+                        host.LoadAssetBatch(new HostCallBatch<DemoAsset.Bindings.HostArgs_LoadAsset>(payloadPtr, count, stride));
+                    }
+                    break;
+                }
+                case 0x0101:
+                {
+                    int stride = (sizeof(DemoEntity.Bindings.HostArgs_SpawnEntity) + 7) & ~7;
+                    if (count <= 0 || (long)count * stride > payloadBytes)
+                        break;
+                    if (count == 1)
+                    {
+                        ref readonly DemoEntity.Bindings.HostArgs_SpawnEntity a = ref *((DemoEntity.Bindings.HostArgs_SpawnEntity*)payloadPtr);
+                        host.SpawnEntity(a.EntityId, a.PrefabHandle, in a.Transform, a.Flags);
+                    }
+                    else
+                    {
+                        host.SpawnEntityBatch(new HostCallBatch<DemoEntity.Bindings.HostArgs_SpawnEntity>(payloadPtr, count, stride));
+                    }
+                    break;
+                }
+                case 0x0102:
+                {
+                    int stride = (sizeof(DemoEntity.Bindings.HostArgs_SetTransform) + 7) & ~7;
+                    if (count <= 0 || (long)count * stride > payloadBytes)
+                        break;
+                    if (count == 1)
+                    {
+                        ref readonly DemoEntity.Bindings.HostArgs_SetTransform a = ref *((DemoEntity.Bindings.HostArgs_SetTransform*)payloadPtr);
+                        host.SetTransform(a.EntityId, a.Mask, in a.Transform);
+                    }
+                    else
+                    {
+                        host.SetTransformBatch(new HostCallBatch<DemoEntity.Bindings.HostArgs_SetTransform>(payloadPtr, count, stride));
+                    }
+                    break;
+                }
+                case 0x0103:
+                {
+                    int stride = (sizeof(DemoEntity.Bindings.HostArgs_SetPosition) + 7) & ~7;
+                    if (count <= 0 || (long)count * stride > payloadBytes)
+                        break;
+                    if (count == 1)
+                    {
+                        ref readonly DemoEntity.Bindings.HostArgs_SetPosition a = ref *((DemoEntity.Bindings.HostArgs_SetPosition*)payloadPtr);
+                        host.SetPosition(a.EntityId, a.Position);
+                    }
+                    else
+                    {
+                        host.SetPositionBatch(new HostCallBatch<DemoEntity.Bindings.HostArgs_SetPosition>(payloadPtr, count, stride));
+                    }
+                    break;
+                }
+                case 0x0104:
+                {
+                    int stride = (sizeof(DemoEntity.Bindings.HostArgs_DestroyEntity) + 7) & ~7;
+                    if (count <= 0 || (long)count * stride > payloadBytes)
+                        break;
+                    if (count == 1)
+                    {
+                        ref readonly DemoEntity.Bindings.HostArgs_DestroyEntity a = ref *((DemoEntity.Bindings.HostArgs_DestroyEntity*)payloadPtr);
+                        host.DestroyEntity(a.EntityId);
+                    }
+                    else
+                    {
+                        host.DestroyEntityBatch(new HostCallBatch<DemoEntity.Bindings.HostArgs_DestroyEntity>(payloadPtr, count, stride));
+                    }
+                    break;
+                }
+                case 0x0105:
+                {
+                    int stride = (sizeof(DemoLog.Bindings.HostArgs_Log) + 7) & ~7;
+                    if (count <= 0 || (long)count * stride > payloadBytes)
+                        break;
+                    if (count == 1)
+                    {
+                        ref readonly DemoLog.Bindings.HostArgs_Log a = ref *((DemoLog.Bindings.HostArgs_Log*)payloadPtr);
+                        host.Log(a.Level, a.Message);
+                    }
+                    else
+                    {
+                        host.LogBatch(new HostCallBatch<DemoLog.Bindings.HostArgs_Log>(payloadPtr, count, stride));
+                    }
+                    break;
+                }
+            }
+        }
+
+        public static unsafe void Dispatch<THost>(CommandStream stream, THost host)
+            where THost : class, DemoAsset.Bindings.IDemoAssetHostApi, DemoEntity.Bindings.IDemoEntityHostApi, DemoLog.Bindings.IDemoLogHostApi
         {
             if (stream.IsEmpty || host == null)
                 return;
@@ -206,73 +452,251 @@ namespace Bridge.Bindings
                 if ((uint)size < (uint)sizeof(BridgeCommandHeader) || (uint)size > (uint)remaining)
                     break;
 
-                if (header->Type == (ushort)BridgeCommandType.CallHost && size >= sizeof(BridgeCmdCallHost))
-                {
-                    var cmd = (BridgeCmdCallHost*)cursor;
-                    uint payloadBytes = (uint)(size - sizeof(BridgeCmdCallHost));
-                    byte* payloadPtr = cursor + sizeof(BridgeCmdCallHost);
-
-                    switch (cmd->FuncId)
-                    {
-                        case 0x82A5E93Au:
-                        {
-                            if (payloadBytes >= (uint)sizeof(DemoAsset.Bindings.HostArgs_LoadAsset))
-                            {
-                                ref readonly DemoAsset.Bindings.HostArgs_LoadAsset a = ref *((DemoAsset.Bindings.HostArgs_LoadAsset*)payloadPtr);
-                                host.LoadAsset(a.RequestId, a.AssetType, a.AssetKey);
-                            }
-                            break;
-                        }
-                        case 0xBCAA331Du:
-                        {
-                            if (payloadBytes >= (uint)sizeof(DemoEntity.Bindings.HostArgs_SpawnEntity))
-                            {
-                                ref readonly DemoEntity.Bindings.HostArgs_SpawnEntity a = ref *((DemoEntity.Bindings.HostArgs_SpawnEntity*)payloadPtr);
-                                host.SpawnEntity(a.EntityId, a.PrefabHandle, in a.Transform, a.Flags);
-                            }
-                            break;
-                        }
-                        case 0x20DA0B6Fu:
-                        {
-                            if (payloadBytes >= (uint)sizeof(DemoEntity.Bindings.HostArgs_SetTransform))
-                            {
-                                ref readonly DemoEntity.Bindings.HostArgs_SetTransform a = ref *((DemoEntity.Bindings.HostArgs_SetTransform*)payloadPtr);
-                                host.SetTransform(a.EntityId, a.Mask, in a.Transform);
-                            }
-                            break;
-                        }
-                        case 0x5B16AE9Eu:
-                        {
-                            if (payloadBytes >= (uint)sizeof(DemoEntity.Bindings.HostArgs_SetPosition))
-                            {
-                                ref readonly DemoEntity.Bindings.HostArgs_SetPosition a = ref *((DemoEntity.Bindings.HostArgs_SetPosition*)payloadPtr);
-                                host.SetPosition(a.EntityId, a.Position);
-                            }
-                            break;
-                        }
-                        case 0xC7C1C59Cu:
-                        {
-                            if (payloadBytes >= (uint)sizeof(DemoEntity.Bindings.HostArgs_DestroyEntity))
-                            {
-                                ref readonly DemoEntity.Bindings.HostArgs_DestroyEntity a = ref *((DemoEntity.Bindings.HostArgs_DestroyEntity*)payloadPtr);
-                                host.DestroyEntity(a.EntityId);
-                            }
-                            break;
-                        }
-                        case 0xDA3184A2u:
-                        {
-                            if (payloadBytes >= (uint)sizeof(DemoLog.Bindings.HostArgs_Log))
-                            {
-                                ref readonly DemoLog.Bindings.HostArgs_Log a = ref *((DemoLog.Bindings.HostArgs_Log*)payloadPtr);
-                                host.Log(a.Level, a.Message);
-                            }
-                            break;
-                        }
-                    }
-                }
-
-                cursor += size;
-            }
-        }
+                if (header->Type >= BridgeCmdCallOp.OpcodeBase && size >= sizeof(BridgeCmdCallOp))
+                {
+                    byte* payloadPtr = cursor + sizeof(BridgeCmdCallOp);
+                    int count = (int)((BridgeCmdCallOp*)cursor)->Count;
+                    int payloadBytes = size - sizeof(BridgeCmdCallOp);
+
+                    switch (header->Type)
+                    {
+                            case 0x0100:
+                            {
+                                int stride = (sizeof(DemoAsset.Bindings.HostArgs_LoadAsset) + 7) & ~7;
+                                if ((long)count * stride <= payloadBytes)
+                                {
+                                    for (int i = 0; i < count; i++)
+                                    {
+                                        ref readonly DemoAsset.Bindings.HostArgs_LoadAsset a = ref *((DemoAsset.Bindings.HostArgs_LoadAsset*)(payloadPtr + (long)i * stride));
+                                        host.LoadAsset(a.RequestId, a.AssetType, a.AssetKey);
+                                    }
+                                }
+                                break;
+                            }
+                            case 0x0101:
+                            {
+                                int stride = (sizeof(DemoEntity.Bindings.HostArgs_SpawnEntity) + 7) & ~7;
+                                if ((long)count * stride <= payloadBytes)
+                                {
+                                    for (int i = 0; i < count; i++)
+                                    {
+                                        ref readonly DemoEntity.Bindings.HostArgs_SpawnEntity a = ref *((DemoEntity.Bindings.HostArgs_SpawnEntity*)(payloadPtr + (long)i * stride));
+                                        host.SpawnEntity(a.EntityId, a.PrefabHandle, in a.Transform, a.Flags);
+                                    }
+                                }
+                                break;
+                            }
+                            case 0x0102:
+                            {
+                                int stride = (sizeof(DemoEntity.Bindings.HostArgs_SetTransform) + 7) & ~7;
+                                if ((long)count * stride <= payloadBytes)
+                                {
+                                    for (int i = 0; i < count; i++)
+                                    {
+                                        ref readonly DemoEntity.Bindings.HostArgs_SetTransform a = ref *((DemoEntity.Bindings.HostArgs_SetTransform*)(payloadPtr + (long)i * stride));
+                                        host.SetTransform(a.EntityId, a.Mask, in a.Transform);
+                                    }
+                                }
+                                break;
+                            }
+                            case 0x0103:
+                            {
+                                int stride = (sizeof(DemoEntity.Bindings.HostArgs_SetPosition) + 7) & ~7;
+                                if ((long)count * stride <= payloadBytes)
+                                {
+                                    for (int i = 0; i < count; i++)
+                                    {
+                                        ref readonly DemoEntity.Bindings.HostArgs_SetPosition a = ref *((DemoEntity.Bindings.HostArgs_SetPosition*)(payloadPtr + (long)i * stride));
+                                        host.SetPosition(a.EntityId, a.Position);
+                                    }
+                                }
+                                break;
+                            }
+                            case 0x0104:
+                            {
+                                int stride = (sizeof(DemoEntity.Bindings.HostArgs_DestroyEntity) + 7) & ~7;
+                                if ((long)count * stride <= payloadBytes)
+                                {
+                                    for (int i = 0; i < count; i++)
+                                    {
+                                        ref readonly DemoEntity.Bindings.HostArgs_DestroyEntity a = ref *((DemoEntity.Bindings.HostArgs_DestroyEntity*)(payloadPtr + (long)i * stride));
+                                        host.DestroyEntity(a.EntityId);
+                                    }
+                                }
+                                break;
+                            }
+                            case 0x0105:
+                            {
+                                int stride = (sizeof(DemoLog.Bindings.HostArgs_Log) + 7) & ~7;
+                                if ((long)count * stride <= payloadBytes)
+                                {
+                                    for (int i = 0; i < count; i++)
+                                    {
+                                        ref readonly DemoLog.Bindings.HostArgs_Log a = ref *((DemoLog.Bindings.HostArgs_Log*)(payloadPtr + (long)i * stride));
+                                        host.Log(a.Level, a.Message);
+                                    }
+                                }
+                                break;
+                            }
+                    }
+                }
+                else if (header->Type == (ushort)BridgeCommandType.CallHost && size >= sizeof(BridgeCmdCallHost))
+                {
+                    var cmd = (BridgeCmdCallHost*)cursor;
+                    uint payloadBytes = (uint)(size - sizeof(BridgeCmdCallHost));
+                    byte* payloadPtr = cursor + sizeof(BridgeCmdCallHost);
+
+                    switch (cmd->FuncId)
+                    {
+                            case 0x82A5E93Au:
+                            {
+                                if (payloadBytes >= (uint)sizeof(DemoAsset.Bindings.HostArgs_LoadAsset))
+                                {
+                                    ref readonly DemoAsset.Bindings.HostArgs_LoadAsset a = ref *((DemoAsset.Bindings.HostArgs_LoadAsset*)payloadPtr);
+                                    host.LoadAsset(a.RequestId, a.AssetType, a.AssetKey);
+                                }
+                                break;
+                            }
+                            case 0xBCAA331Du:
+                            {
+                                if (payloadBytes >= (uint)sizeof(DemoEntity.Bindings.HostArgs_SpawnEntity))
+                                {
+                                    ref readonly DemoEntity.Bindings.HostArgs_SpawnEntity a = ref *((DemoEntity.Bindings.HostArgs_SpawnEntity*)payloadPtr);
+                                    host.SpawnEntity(a.EntityId, a.PrefabHandle, in a.Transform, a.Flags);
+                                }
+                                break;
+                            }
+                            case 0x20DA0B6Fu:
+                            {
+                                if (payloadBytes >= (uint)sizeof(DemoEntity.Bindings.HostArgs_SetTransform))
+                                {
+                                    ref readonly DemoEntity.Bindings.HostArgs_SetTransform a = ref *((DemoEntity.Bindings.HostArgs_SetTransform*)payloadPtr);
+                                    host.SetTransform(a.EntityId, a.Mask, in a.Transform);
+                                }
+                                break;
+                            }
+                            case 0x5B16AE9Eu:
+                            {
+                                if (payloadBytes >= (uint)sizeof(DemoEntity.Bindings.HostArgs_SetPosition))
+                                {
+                                    ref readonly DemoEntity.Bindings.HostArgs_SetPosition a = ref *((DemoEntity.Bindings.HostArgs_SetPosition*)payloadPtr);
+                                    host.SetPosition(a.EntityId, a.Position);
+                                }
+                                break;
+                            }
+                            case 0xC7C1C59Cu:
+                            {
+                                if (payloadBytes >= (uint)sizeof(DemoEntity.Bindings.HostArgs_DestroyEntity))
+                                {
+                                    ref readonly DemoEntity.Bindings.HostArgs_DestroyEntity a = ref *((DemoEntity.Bindings.HostArgs_DestroyEntity*)payloadPtr);
+                                    host.DestroyEntity(a.EntityId);
+                                }
+                                break;
+                            }
+                            case 0xDA3184A2u:
+                            {
+                                if (payloadBytes >= (uint)sizeof(DemoLog.Bindings.HostArgs_Log))
+                                {
+                                    ref readonly DemoLog.Bindings.HostArgs_Log a = ref *((DemoLog.Bindings.HostArgs_Log*)payloadPtr);
+                                    host.Log(a.Level, a.Message);
+                                }
+                                break;
+                            }
+                    }
+                }
+                else if (header->Type == (ushort)BridgeCommandType.DefineString && size >= sizeof(BridgeCmdDefineString))
+                {
+                    BridgeStringTable.Define(in *(BridgeCmdDefineString*)cursor);
+                }
+                else if (header->Type == (ushort)BridgeCommandType.CallHostBatch && size >= sizeof(BridgeCmdCallHostBatch))
+                {
+                    var batch = (BridgeCmdCallHostBatch*)cursor;
+                    if ((ulong)batch->Count * batch->Stride > (ulong)(size - sizeof(BridgeCmdCallHostBatch)))
+                        break;
+
+                    byte* payloadPtr = cursor + sizeof(BridgeCmdCallHostBatch);
+                    int count = (int)batch->Count;
+                    int stride = (int)batch->Stride;
+
+                    switch (batch->FuncId)
+                    {
+                            case 0x82A5E93Au:
+                            {
+                                if (stride >= sizeof(DemoAsset.Bindings.HostArgs_LoadAsset))
+                                {
+                                    for (int i = 0; i < count; i++)
+                                    {
+                                        ref readonly DemoAsset.Bindings.HostArgs_LoadAsset a = ref *((DemoAsset.Bindings.HostArgs_LoadAsset*)(payloadPtr + (long)i * stride));
+                                        host.LoadAsset(a.RequestId, a.AssetType, a.AssetKey);
+                                    }
+                                }
+                                break;
+                            }
+                            case 0xBCAA331Du:
+                            {
+                                if (stride >= sizeof(DemoEntity.Bindings.HostArgs_SpawnEntity))
+                                {
+                                    for (int i = 0; i < count; i++)
+                                    {
+                                        ref readonly DemoEntity.Bindings.HostArgs_SpawnEntity a = ref *((DemoEntity.Bindings.HostArgs_SpawnEntity*)(payloadPtr + (long)i * stride));
+                                        host.SpawnEntity(a.EntityId, a.PrefabHandle, in a.Transform, a.Flags);
+                                    }
+                                }
+                                break;
+                            }
+                            case 0x20DA0B6Fu:
+                            {
+                                if (stride >= sizeof(DemoEntity.Bindings.HostArgs_SetTransform))
+                                {
+                                    for (int i = 0; i < count; i++)
+                                    {
+                                        ref readonly DemoEntity.Bindings.HostArgs_SetTransform a = ref *((DemoEntity.Bindings.HostArgs_SetTransform*)(payloadPtr + (long)i * stride));
+                                        host.SetTransform(a.EntityId, a.Mask, in a.Transform);
+                                    }
+                                }
+                                break;
+                            }
+                            case 0x5B16AE9Eu:
+                            {
+                                if (stride >= sizeof(DemoEntity.Bindings.HostArgs_SetPosition))
+                                {
+                                    for (int i = 0; i < count; i++)
+                                    {
+                                        ref readonly DemoEntity.Bindings.HostArgs_SetPosition a = ref *((DemoEntity.Bindings.HostArgs_SetPosition*)(payloadPtr + (long)i * stride));
+                                        host.SetPosition(a.EntityId, a.Position);
+                                    }
+                                }
+                                break;
+                            }
+                            case 0xC7C1C59Cu:
+                            {
+                                if (stride >= sizeof(DemoEntity.Bindings.HostArgs_DestroyEntity))
+                                {
+                                    for (int i = 0; i < count; i++)
+                                    {
+                                        ref readonly DemoEntity.Bindings.HostArgs_DestroyEntity a = ref *((DemoEntity.Bindings.HostArgs_DestroyEntity*)(payloadPtr + (long)i * stride));
+                                        host.DestroyEntity(a.EntityId);
+                                    }
+                                }
+                                break;
+                            }
+                            case 0xDA3184A2u:
+                            {
+                                if (stride >= sizeof(DemoLog.Bindings.HostArgs_Log))
+                                {
+                                    for (int i = 0; i < count; i++)
+                                    {
+                                        ref readonly DemoLog.Bindings.HostArgs_Log a = ref *((DemoLog.Bindings.HostArgs_Log*)(payloadPtr + (long)i * stride));
+                                        host.Log(a.Level, a.Message);
+                                    }
+                                }
+                                break;
+                            }
+                    }
+                }
+
+                cursor += size;
+            }
+        }
     }
 }
@@ -19,5 +19,16 @@ namespace DemoAsset.Bindings
             core.PushCallCore((uint)CoreFuncId.AssetLoaded, a);
         }
 
+        public static void AssetLoaded(this BridgeCallWriter calls, ulong requestId, ulong handle, BridgeAssetStatus status)
+        {
+            var a = new CoreArgs_AssetLoaded
+            {
+                RequestId = requestId,
+                Handle = handle,
+                Status = status,
+            };
+            calls.Append((uint)CoreFuncId.AssetLoaded, a);
+        }
+
     }
 }
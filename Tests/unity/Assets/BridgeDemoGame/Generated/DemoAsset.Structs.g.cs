@@ -12,7 +12,7 @@ namespace DemoAsset.Bindings
     {
         public ulong RequestId;
         public BridgeAssetType AssetType;
-        public BridgeStringView AssetKey;
+        public BridgeStringId AssetKey;
     }
 
     [StructLayout(LayoutKind.Sequential)]
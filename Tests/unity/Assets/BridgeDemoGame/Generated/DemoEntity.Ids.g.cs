@@ -15,4 +15,12 @@ namespace DemoEntity.Bindings
     public enum CoreFuncId : uint
     {
     }
+
+    public enum HostOpcode : ushort
+    {
+        SpawnEntity = 0x0101,
+        SetTransform = 0x0102,
+        SetPosition = 0x0103,
+        DestroyEntity = 0x0104,
+    }
 }
@@ -12,4 +12,9 @@ namespace DemoLog.Bindings
     public enum CoreFuncId : uint
     {
     }
+
+    public enum HostOpcode : ushort
+    {
+        Log = 0x0105,
+    }
 }
@@ -22,7 +22,7 @@ namespace BridgeDemoGame.PlayModeTests
                 _core = core;
             }
 
-            public void LoadAsset(ulong requestId, BridgeAssetType assetType, BridgeStringView assetKey)
+            public void LoadAsset(ulong requestId, BridgeAssetType assetType, BridgeStringId assetKey)
             {
                 _ = assetType;
                 _ = assetKey;
@@ -24,7 +24,7 @@ namespace BridgeDemoGame.PlayModeTests
                 _core = core;
             }
 
-            public override void LoadAsset(ulong requestId, BridgeAssetType assetType, BridgeStringView assetKey)
+            public override void LoadAsset(ulong requestId, BridgeAssetType assetType, BridgeStringId assetKey)
             {
                 _ = assetType;
                 _ = assetKey;
@@ -9,7 +9,6 @@ namespace BridgeDemoGame
 {
     public sealed class DemoGameUnityAssetService : MonoBehaviour
     {
-        private readonly Dictionary<ulong, string> _assetKeyIntern = new Dictionary<ulong, string>();
         private readonly Dictionary<string, PendingAssetLoad> _pending = new Dictionary<string, PendingAssetLoad>(StringComparer.Ordinal);
         private readonly Dictionary<string, ulong> _assetKeyToHandle = new Dictionary<string, ulong>(StringComparer.Ordinal);
         private readonly Dictionary<ulong, TextAsset> _handleToAsset = new Dictionary<ulong, TextAsset>();
@@ -19,7 +18,7 @@ namespace BridgeDemoGame
             return _handleToAsset.TryGetValue(handle, out asset);
         }
 
-        public void RequestLoad(BridgeCore core, ulong requestId, BridgeAssetType assetType, BridgeStringView assetKey)
+        public void RequestLoad(BridgeCore core, ulong requestId, BridgeAssetType assetType, BridgeStringId assetKey)
         {
             if (core == null)
                 return;
@@ -30,13 +29,14 @@ namespace BridgeDemoGame
                 return;
             }
 
-            if (assetKey.Ptr == 0 || assetKey.Len == 0)
+            if (assetKey.IsEmpty)
             {
                 core.AssetLoaded(requestId, 0, BridgeAssetStatus.NotFound);
                 return;
             }
 
-            string key = InternKey(assetKey);
+            // 驻留字符串由 BridgeStringTable 统一解码缓存，这里拿到的是同一个 string 实例。
+            string key = assetKey.ToManagedString();
             if (_assetKeyToHandle.TryGetValue(key, out ulong cachedHandle) && cachedHandle != 0)
             {
                 core.AssetLoaded(requestId, cachedHandle, BridgeAssetStatus.Ok);
@@ -55,18 +55,6 @@ namespace BridgeDemoGame
             StartCoroutine(LoadCoroutine(pending));
         }
 
-        private string InternKey(BridgeStringView key)
-        {
-            ulong hash = key.Fnv1a64();
-            if (hash != 0 && _assetKeyIntern.TryGetValue(hash, out string cached) && !string.IsNullOrEmpty(cached))
-                return cached;
-
-            string s = key.ToManagedString();
-            if (hash != 0 && !string.IsNullOrEmpty(s))
-                _assetKeyIntern[hash] = s;
-            return s;
-        }
-
         private IEnumerator LoadCoroutine(PendingAssetLoad pending)
         {
             ResourceRequest req = Resources.LoadAsync<TextAsset>(pending.AssetKey);
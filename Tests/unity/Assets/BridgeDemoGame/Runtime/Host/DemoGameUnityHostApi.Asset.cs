@@ -5,7 +5,7 @@ namespace BridgeDemoGame
 {
     public sealed partial class DemoGameUnityHostApi
     {
-        public override void LoadAsset(ulong requestId, BridgeAssetType assetType, BridgeStringView assetKey)
+        public override void LoadAsset(ulong requestId, BridgeAssetType assetType, BridgeStringId assetKey)
         {
             Commands++;
             AssetRequests++;
@@ -20,6 +20,7 @@ param(
     [switch]$NoUnity,
     [switch]$NoUnityEditMode,
     [switch]$NoUnityIl2cpp,
+    [switch]$NoBench,
 
     [switch]$NoBuild
 )
@@ -761,6 +762,30 @@ else
     $steps.robot_runner = [ordered]@{ ok = $false; error = "missing: $robotExe" }
 }
 
+if (-not $NoBench)
+{
+    $benchExe = Join-Path $repoRoot "build\\bin\\Release\\bridge_bench.exe"
+    $benchJson = Join-Path $runDir "bridge_bench.json"
+    if (Test-Path $benchExe)
+    {
+        $steps.bridge_bench = Invoke-External `
+            -Name "bridge_bench" `
+            -FilePath $benchExe `
+            -ArgumentList @("--json", $benchJson) `
+            -WorkDir $repoRoot `
+            -OutputFile (Join-Path $runDir "bridge_bench.txt")
+
+        if ($steps.bridge_bench.ok -and (Test-Path $benchJson))
+        {
+            $results.bridge_bench = Get-Content $benchJson -Raw | ConvertFrom-Json
+        }
+    }
+    else
+    {
+        $steps.bridge_bench = [ordered]@{ ok = $false; error = "missing: $benchExe" }
+    }
+}
+
 $unity = $null
 if (-not $NoUnity)
 {